@@ -1,5 +1,8 @@
 #include <algorithm>
+#include <string>
 #include <vector>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stddef.h>
 #include "gl_core_4_3.hpp"
@@ -100,7 +103,48 @@ namespace gl
 {
 	namespace exts
 	{
+		LoadTest var_ARB_buffer_storage;
+		LoadTest var_ARB_parallel_shader_compile;
+		LoadTest var_KHR_parallel_shader_compile;
+		
 	} //namespace exts
+	
+	// Extension: ARB_buffer_storage
+	typedef void (CODEGEN_FUNCPTR *PFNBUFFERSTORAGE)(GLenum, GLsizeiptr, const void *, GLbitfield);
+	PFNBUFFERSTORAGE BufferStorage = 0;
+	
+	static int Load_ARB_buffer_storage()
+	{
+		int numFailed = 0;
+		BufferStorage = reinterpret_cast<PFNBUFFERSTORAGE>(IntGetProcAddress("glBufferStorage"));
+		if(!BufferStorage) ++numFailed;
+		return numFailed;
+	}
+	
+	// Extension: ARB_parallel_shader_compile
+	typedef void (CODEGEN_FUNCPTR *PFNMAXSHADERCOMPILERTHREADSARB)(GLuint);
+	PFNMAXSHADERCOMPILERTHREADSARB MaxShaderCompilerThreadsARB = 0;
+	
+	static int Load_ARB_parallel_shader_compile()
+	{
+		int numFailed = 0;
+		MaxShaderCompilerThreadsARB = reinterpret_cast<PFNMAXSHADERCOMPILERTHREADSARB>(IntGetProcAddress("glMaxShaderCompilerThreadsARB"));
+		if(!MaxShaderCompilerThreadsARB) ++numFailed;
+		return numFailed;
+	}
+	
+	// Extension: KHR_parallel_shader_compile
+	typedef void (CODEGEN_FUNCPTR *PFNMAXSHADERCOMPILERTHREADSKHR)(GLuint);
+	PFNMAXSHADERCOMPILERTHREADSKHR MaxShaderCompilerThreadsKHR = 0;
+	
+	static int Load_KHR_parallel_shader_compile()
+	{
+		int numFailed = 0;
+		MaxShaderCompilerThreadsKHR = reinterpret_cast<PFNMAXSHADERCOMPILERTHREADSKHR>(IntGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+		if(!MaxShaderCompilerThreadsKHR) ++numFailed;
+		return numFailed;
+	}
+	
 	typedef void (CODEGEN_FUNCPTR *PFNBLENDFUNC)(GLenum, GLenum);
 	PFNBLENDFUNC BlendFunc = 0;
 	typedef void (CODEGEN_FUNCPTR *PFNCLEAR)(GLbitfield);
@@ -2382,94 +2426,3582 @@ namespace gl
 		if(!VertexBindingDivisor) ++numFailed;
 		return numFailed;
 	}
+	// Lazy loading: each core function starts as a trampoline which looks the real
+	// function up on its first call and replaces itself, so startup skips the lookups
+	// of functions the program never calls.
+	typedef void (CODEGEN_FUNCPTR *PFNGENERIC)();
 	
-	namespace sys
+	static PFNGENERIC ResolveCoreFunction(int index);
+	
+	static void CODEGEN_FUNCPTR Switch_BlendFunc(GLenum a0, GLenum a1)
 	{
-		namespace 
-		{
-			typedef int (*PFN_LOADEXTENSION)();
-			struct MapEntry
-			{
-				MapEntry(const char *_extName, exts::LoadTest *_extVariable)
-					: extName(_extName)
-					, extVariable(_extVariable)
-					, loaderFunc(0)
-					{}
-					
-				MapEntry(const char *_extName, exts::LoadTest *_extVariable, PFN_LOADEXTENSION _loaderFunc)
-					: extName(_extName)
-					, extVariable(_extVariable)
-					, loaderFunc(_loaderFunc)
-					{}
-				
-				const char *extName;
-				exts::LoadTest *extVariable;
-				PFN_LOADEXTENSION loaderFunc;
-			};
-			
-			struct MapCompare
-			{
-				MapCompare(const char *test_) : test(test_) {}
-				bool operator()(const MapEntry &other) { return strcmp(test, other.extName) == 0; }
-				const char *test;
-			};
-			
-			void InitializeMappingTable(std::vector<MapEntry> &table)
-			{
-				table.reserve(0);
-			}
-			
-			void ClearExtensionVars()
-			{
-			}
-			
-			void LoadExtByName(std::vector<MapEntry> &table, const char *extensionName)
-			{
-				std::vector<MapEntry>::iterator entry = std::find_if(table.begin(), table.end(), MapCompare(extensionName));
-				
-				if(entry != table.end())
-				{
-					if(entry->loaderFunc)
-						(*entry->extVariable) = exts::LoadTest(true, entry->loaderFunc());
-					else
-						(*entry->extVariable) = exts::LoadTest(true, 0);
-				}
-			}
-		} //namespace 
-		
-		
-		namespace 
-		{
-			static void ProcExtsFromExtList(std::vector<MapEntry> &table)
-			{
-				GLint iLoop;
-				GLint iNumExtensions = 0;
-				gl::GetIntegerv(gl::NUM_EXTENSIONS, &iNumExtensions);
-			
-				for(iLoop = 0; iLoop < iNumExtensions; iLoop++)
-				{
-					const char *strExtensionName = (const char *)gl::GetStringi(gl::EXTENSIONS, iLoop);
-					LoadExtByName(table, strExtensionName);
-				}
-			}
-			
-		} //namespace 
-		
-		exts::LoadTest LoadFunctions()
-		{
-			ClearExtensionVars();
-			std::vector<MapEntry> table;
-			InitializeMappingTable(table);
-			
-			GetIntegerv = reinterpret_cast<PFNGETINTEGERV>(IntGetProcAddress("glGetIntegerv"));
-			if(!GetIntegerv) return exts::LoadTest();
-			GetStringi = reinterpret_cast<PFNGETSTRINGI>(IntGetProcAddress("glGetStringi"));
-			if(!GetStringi) return exts::LoadTest();
-			
-			ProcExtsFromExtList(table);
-			
-			int numFailed = LoadCoreFunctions();
-			return exts::LoadTest(true, numFailed);
+		return reinterpret_cast<PFNBLENDFUNC>(ResolveCoreFunction(0))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Clear(GLbitfield a0)
+	{
+		return reinterpret_cast<PFNCLEAR>(ResolveCoreFunction(1))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearColor(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3)
+	{
+		return reinterpret_cast<PFNCLEARCOLOR>(ResolveCoreFunction(2))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearDepth(GLdouble a0)
+	{
+		return reinterpret_cast<PFNCLEARDEPTH>(ResolveCoreFunction(3))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearStencil(GLint a0)
+	{
+		return reinterpret_cast<PFNCLEARSTENCIL>(ResolveCoreFunction(4))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ColorMask(GLboolean a0, GLboolean a1, GLboolean a2, GLboolean a3)
+	{
+		return reinterpret_cast<PFNCOLORMASK>(ResolveCoreFunction(5))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CullFace(GLenum a0)
+	{
+		return reinterpret_cast<PFNCULLFACE>(ResolveCoreFunction(6))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DepthFunc(GLenum a0)
+	{
+		return reinterpret_cast<PFNDEPTHFUNC>(ResolveCoreFunction(7))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DepthMask(GLboolean a0)
+	{
+		return reinterpret_cast<PFNDEPTHMASK>(ResolveCoreFunction(8))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DepthRange(GLdouble a0, GLdouble a1)
+	{
+		return reinterpret_cast<PFNDEPTHRANGE>(ResolveCoreFunction(9))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Disable(GLenum a0)
+	{
+		return reinterpret_cast<PFNDISABLE>(ResolveCoreFunction(10))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawBuffer(GLenum a0)
+	{
+		return reinterpret_cast<PFNDRAWBUFFER>(ResolveCoreFunction(11))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Enable(GLenum a0)
+	{
+		return reinterpret_cast<PFNENABLE>(ResolveCoreFunction(12))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Finish()
+	{
+		return reinterpret_cast<PFNFINISH>(ResolveCoreFunction(13))();
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Flush()
+	{
+		return reinterpret_cast<PFNFLUSH>(ResolveCoreFunction(14))();
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_FrontFace(GLenum a0)
+	{
+		return reinterpret_cast<PFNFRONTFACE>(ResolveCoreFunction(15))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetBooleanv(GLenum a0, GLboolean *a1)
+	{
+		return reinterpret_cast<PFNGETBOOLEANV>(ResolveCoreFunction(16))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetDoublev(GLenum a0, GLdouble *a1)
+	{
+		return reinterpret_cast<PFNGETDOUBLEV>(ResolveCoreFunction(17))(a0, a1);
+	}
+	
+	static GLenum CODEGEN_FUNCPTR Switch_GetError()
+	{
+		return reinterpret_cast<PFNGETERROR>(ResolveCoreFunction(18))();
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetFloatv(GLenum a0, GLfloat *a1)
+	{
+		return reinterpret_cast<PFNGETFLOATV>(ResolveCoreFunction(19))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetIntegerv(GLenum a0, GLint *a1)
+	{
+		return reinterpret_cast<PFNGETINTEGERV>(ResolveCoreFunction(20))(a0, a1);
+	}
+	
+	static const GLubyte * CODEGEN_FUNCPTR Switch_GetString(GLenum a0)
+	{
+		return reinterpret_cast<PFNGETSTRING>(ResolveCoreFunction(21))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetTexImage(GLenum a0, GLint a1, GLenum a2, GLenum a3, GLvoid *a4)
+	{
+		return reinterpret_cast<PFNGETTEXIMAGE>(ResolveCoreFunction(22))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetTexLevelParameterfv(GLenum a0, GLint a1, GLenum a2, GLfloat *a3)
+	{
+		return reinterpret_cast<PFNGETTEXLEVELPARAMETERFV>(ResolveCoreFunction(23))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetTexLevelParameteriv(GLenum a0, GLint a1, GLenum a2, GLint *a3)
+	{
+		return reinterpret_cast<PFNGETTEXLEVELPARAMETERIV>(ResolveCoreFunction(24))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetTexParameterfv(GLenum a0, GLenum a1, GLfloat *a2)
+	{
+		return reinterpret_cast<PFNGETTEXPARAMETERFV>(ResolveCoreFunction(25))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetTexParameteriv(GLenum a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETTEXPARAMETERIV>(ResolveCoreFunction(26))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Hint(GLenum a0, GLenum a1)
+	{
+		return reinterpret_cast<PFNHINT>(ResolveCoreFunction(27))(a0, a1);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsEnabled(GLenum a0)
+	{
+		return reinterpret_cast<PFNISENABLED>(ResolveCoreFunction(28))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_LineWidth(GLfloat a0)
+	{
+		return reinterpret_cast<PFNLINEWIDTH>(ResolveCoreFunction(29))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_LogicOp(GLenum a0)
+	{
+		return reinterpret_cast<PFNLOGICOP>(ResolveCoreFunction(30))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PixelStoref(GLenum a0, GLfloat a1)
+	{
+		return reinterpret_cast<PFNPIXELSTOREF>(ResolveCoreFunction(31))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PixelStorei(GLenum a0, GLint a1)
+	{
+		return reinterpret_cast<PFNPIXELSTOREI>(ResolveCoreFunction(32))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PointSize(GLfloat a0)
+	{
+		return reinterpret_cast<PFNPOINTSIZE>(ResolveCoreFunction(33))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PolygonMode(GLenum a0, GLenum a1)
+	{
+		return reinterpret_cast<PFNPOLYGONMODE>(ResolveCoreFunction(34))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ReadBuffer(GLenum a0)
+	{
+		return reinterpret_cast<PFNREADBUFFER>(ResolveCoreFunction(35))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ReadPixels(GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, GLvoid *a6)
+	{
+		return reinterpret_cast<PFNREADPIXELS>(ResolveCoreFunction(36))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Scissor(GLint a0, GLint a1, GLsizei a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNSCISSOR>(ResolveCoreFunction(37))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_StencilFunc(GLenum a0, GLint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNSTENCILFUNC>(ResolveCoreFunction(38))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_StencilMask(GLuint a0)
+	{
+		return reinterpret_cast<PFNSTENCILMASK>(ResolveCoreFunction(39))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_StencilOp(GLenum a0, GLenum a1, GLenum a2)
+	{
+		return reinterpret_cast<PFNSTENCILOP>(ResolveCoreFunction(40))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLint a4, GLenum a5, GLenum a6, const GLvoid *a7)
+	{
+		return reinterpret_cast<PFNTEXIMAGE1D>(ResolveCoreFunction(41))(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexImage2D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const GLvoid *a8)
+	{
+		return reinterpret_cast<PFNTEXIMAGE2D>(ResolveCoreFunction(42))(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexParameterf(GLenum a0, GLenum a1, GLfloat a2)
+	{
+		return reinterpret_cast<PFNTEXPARAMETERF>(ResolveCoreFunction(43))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexParameterfv(GLenum a0, GLenum a1, const GLfloat *a2)
+	{
+		return reinterpret_cast<PFNTEXPARAMETERFV>(ResolveCoreFunction(44))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexParameteri(GLenum a0, GLenum a1, GLint a2)
+	{
+		return reinterpret_cast<PFNTEXPARAMETERI>(ResolveCoreFunction(45))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexParameteriv(GLenum a0, GLenum a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNTEXPARAMETERIV>(ResolveCoreFunction(46))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Viewport(GLint a0, GLint a1, GLsizei a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNVIEWPORT>(ResolveCoreFunction(47))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindTexture(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNBINDTEXTURE>(ResolveCoreFunction(48))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CopyTexImage1D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLint a6)
+	{
+		return reinterpret_cast<PFNCOPYTEXIMAGE1D>(ResolveCoreFunction(49))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CopyTexImage2D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLint a7)
+	{
+		return reinterpret_cast<PFNCOPYTEXIMAGE2D>(ResolveCoreFunction(50))(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CopyTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5)
+	{
+		return reinterpret_cast<PFNCOPYTEXSUBIMAGE1D>(ResolveCoreFunction(51))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CopyTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7)
+	{
+		return reinterpret_cast<PFNCOPYTEXSUBIMAGE2D>(ResolveCoreFunction(52))(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteTextures(GLsizei a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNDELETETEXTURES>(ResolveCoreFunction(53))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawArrays(GLenum a0, GLint a1, GLsizei a2)
+	{
+		return reinterpret_cast<PFNDRAWARRAYS>(ResolveCoreFunction(54))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawElements(GLenum a0, GLsizei a1, GLenum a2, const GLvoid *a3)
+	{
+		return reinterpret_cast<PFNDRAWELEMENTS>(ResolveCoreFunction(55))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenTextures(GLsizei a0, GLuint *a1)
+	{
+		return reinterpret_cast<PFNGENTEXTURES>(ResolveCoreFunction(56))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetPointerv(GLenum a0, GLvoid **a1)
+	{
+		return reinterpret_cast<PFNGETPOINTERV>(ResolveCoreFunction(57))(a0, a1);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsTexture(GLuint a0)
+	{
+		return reinterpret_cast<PFNISTEXTURE>(ResolveCoreFunction(58))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PolygonOffset(GLfloat a0, GLfloat a1)
+	{
+		return reinterpret_cast<PFNPOLYGONOFFSET>(ResolveCoreFunction(59))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const GLvoid *a6)
+	{
+		return reinterpret_cast<PFNTEXSUBIMAGE1D>(ResolveCoreFunction(60))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const GLvoid *a8)
+	{
+		return reinterpret_cast<PFNTEXSUBIMAGE2D>(ResolveCoreFunction(61))(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BlendColor(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3)
+	{
+		return reinterpret_cast<PFNBLENDCOLOR>(ResolveCoreFunction(62))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BlendEquation(GLenum a0)
+	{
+		return reinterpret_cast<PFNBLENDEQUATION>(ResolveCoreFunction(63))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CopyTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8)
+	{
+		return reinterpret_cast<PFNCOPYTEXSUBIMAGE3D>(ResolveCoreFunction(64))(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawRangeElements(GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const GLvoid *a5)
+	{
+		return reinterpret_cast<PFNDRAWRANGEELEMENTS>(ResolveCoreFunction(65))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexImage3D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const GLvoid *a9)
+	{
+		return reinterpret_cast<PFNTEXIMAGE3D>(ResolveCoreFunction(66))(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const GLvoid *a10)
+	{
+		return reinterpret_cast<PFNTEXSUBIMAGE3D>(ResolveCoreFunction(67))(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ActiveTexture(GLenum a0)
+	{
+		return reinterpret_cast<PFNACTIVETEXTURE>(ResolveCoreFunction(68))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CompressedTexImage1D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const GLvoid *a6)
+	{
+		return reinterpret_cast<PFNCOMPRESSEDTEXIMAGE1D>(ResolveCoreFunction(69))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CompressedTexImage2D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const GLvoid *a7)
+	{
+		return reinterpret_cast<PFNCOMPRESSEDTEXIMAGE2D>(ResolveCoreFunction(70))(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CompressedTexImage3D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const GLvoid *a8)
+	{
+		return reinterpret_cast<PFNCOMPRESSEDTEXIMAGE3D>(ResolveCoreFunction(71))(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CompressedTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const GLvoid *a6)
+	{
+		return reinterpret_cast<PFNCOMPRESSEDTEXSUBIMAGE1D>(ResolveCoreFunction(72))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CompressedTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const GLvoid *a8)
+	{
+		return reinterpret_cast<PFNCOMPRESSEDTEXSUBIMAGE2D>(ResolveCoreFunction(73))(a0, a1, a2, a3, a4, a5, a6, a7, a8);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CompressedTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const GLvoid *a10)
+	{
+		return reinterpret_cast<PFNCOMPRESSEDTEXSUBIMAGE3D>(ResolveCoreFunction(74))(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetCompressedTexImage(GLenum a0, GLint a1, GLvoid *a2)
+	{
+		return reinterpret_cast<PFNGETCOMPRESSEDTEXIMAGE>(ResolveCoreFunction(75))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SampleCoverage(GLfloat a0, GLboolean a1)
+	{
+		return reinterpret_cast<PFNSAMPLECOVERAGE>(ResolveCoreFunction(76))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BlendFuncSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+	{
+		return reinterpret_cast<PFNBLENDFUNCSEPARATE>(ResolveCoreFunction(77))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiDrawArrays(GLenum a0, const GLint *a1, const GLsizei *a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNMULTIDRAWARRAYS>(ResolveCoreFunction(78))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiDrawElements(GLenum a0, const GLsizei *a1, GLenum a2, const GLvoid *const*a3, GLsizei a4)
+	{
+		return reinterpret_cast<PFNMULTIDRAWELEMENTS>(ResolveCoreFunction(79))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PointParameterf(GLenum a0, GLfloat a1)
+	{
+		return reinterpret_cast<PFNPOINTPARAMETERF>(ResolveCoreFunction(80))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PointParameterfv(GLenum a0, const GLfloat *a1)
+	{
+		return reinterpret_cast<PFNPOINTPARAMETERFV>(ResolveCoreFunction(81))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PointParameteri(GLenum a0, GLint a1)
+	{
+		return reinterpret_cast<PFNPOINTPARAMETERI>(ResolveCoreFunction(82))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PointParameteriv(GLenum a0, const GLint *a1)
+	{
+		return reinterpret_cast<PFNPOINTPARAMETERIV>(ResolveCoreFunction(83))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BeginQuery(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNBEGINQUERY>(ResolveCoreFunction(84))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindBuffer(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNBINDBUFFER>(ResolveCoreFunction(85))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BufferData(GLenum a0, GLsizeiptr a1, const GLvoid *a2, GLenum a3)
+	{
+		return reinterpret_cast<PFNBUFFERDATA>(ResolveCoreFunction(86))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, const GLvoid *a3)
+	{
+		return reinterpret_cast<PFNBUFFERSUBDATA>(ResolveCoreFunction(87))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteBuffers(GLsizei a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNDELETEBUFFERS>(ResolveCoreFunction(88))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteQueries(GLsizei a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNDELETEQUERIES>(ResolveCoreFunction(89))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_EndQuery(GLenum a0)
+	{
+		return reinterpret_cast<PFNENDQUERY>(ResolveCoreFunction(90))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenBuffers(GLsizei a0, GLuint *a1)
+	{
+		return reinterpret_cast<PFNGENBUFFERS>(ResolveCoreFunction(91))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenQueries(GLsizei a0, GLuint *a1)
+	{
+		return reinterpret_cast<PFNGENQUERIES>(ResolveCoreFunction(92))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetBufferParameteriv(GLenum a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETBUFFERPARAMETERIV>(ResolveCoreFunction(93))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetBufferPointerv(GLenum a0, GLenum a1, GLvoid **a2)
+	{
+		return reinterpret_cast<PFNGETBUFFERPOINTERV>(ResolveCoreFunction(94))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetBufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, GLvoid *a3)
+	{
+		return reinterpret_cast<PFNGETBUFFERSUBDATA>(ResolveCoreFunction(95))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjectiv(GLuint a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETQUERYOBJECTIV>(ResolveCoreFunction(96))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjectuiv(GLuint a0, GLenum a1, GLuint *a2)
+	{
+		return reinterpret_cast<PFNGETQUERYOBJECTUIV>(ResolveCoreFunction(97))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetQueryiv(GLenum a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETQUERYIV>(ResolveCoreFunction(98))(a0, a1, a2);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsBuffer(GLuint a0)
+	{
+		return reinterpret_cast<PFNISBUFFER>(ResolveCoreFunction(99))(a0);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsQuery(GLuint a0)
+	{
+		return reinterpret_cast<PFNISQUERY>(ResolveCoreFunction(100))(a0);
+	}
+	
+	static void * CODEGEN_FUNCPTR Switch_MapBuffer(GLenum a0, GLenum a1)
+	{
+		return reinterpret_cast<PFNMAPBUFFER>(ResolveCoreFunction(101))(a0, a1);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_UnmapBuffer(GLenum a0)
+	{
+		return reinterpret_cast<PFNUNMAPBUFFER>(ResolveCoreFunction(102))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_AttachShader(GLuint a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNATTACHSHADER>(ResolveCoreFunction(103))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindAttribLocation(GLuint a0, GLuint a1, const GLchar *a2)
+	{
+		return reinterpret_cast<PFNBINDATTRIBLOCATION>(ResolveCoreFunction(104))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BlendEquationSeparate(GLenum a0, GLenum a1)
+	{
+		return reinterpret_cast<PFNBLENDEQUATIONSEPARATE>(ResolveCoreFunction(105))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CompileShader(GLuint a0)
+	{
+		return reinterpret_cast<PFNCOMPILESHADER>(ResolveCoreFunction(106))(a0);
+	}
+	
+	static GLuint CODEGEN_FUNCPTR Switch_CreateProgram()
+	{
+		return reinterpret_cast<PFNCREATEPROGRAM>(ResolveCoreFunction(107))();
+	}
+	
+	static GLuint CODEGEN_FUNCPTR Switch_CreateShader(GLenum a0)
+	{
+		return reinterpret_cast<PFNCREATESHADER>(ResolveCoreFunction(108))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteProgram(GLuint a0)
+	{
+		return reinterpret_cast<PFNDELETEPROGRAM>(ResolveCoreFunction(109))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteShader(GLuint a0)
+	{
+		return reinterpret_cast<PFNDELETESHADER>(ResolveCoreFunction(110))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DetachShader(GLuint a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNDETACHSHADER>(ResolveCoreFunction(111))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DisableVertexAttribArray(GLuint a0)
+	{
+		return reinterpret_cast<PFNDISABLEVERTEXATTRIBARRAY>(ResolveCoreFunction(112))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawBuffers(GLsizei a0, const GLenum *a1)
+	{
+		return reinterpret_cast<PFNDRAWBUFFERS>(ResolveCoreFunction(113))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_EnableVertexAttribArray(GLuint a0)
+	{
+		return reinterpret_cast<PFNENABLEVERTEXATTRIBARRAY>(ResolveCoreFunction(114))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveAttrib(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLint *a4, GLenum *a5, GLchar *a6)
+	{
+		return reinterpret_cast<PFNGETACTIVEATTRIB>(ResolveCoreFunction(115))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniform(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLint *a4, GLenum *a5, GLchar *a6)
+	{
+		return reinterpret_cast<PFNGETACTIVEUNIFORM>(ResolveCoreFunction(116))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetAttachedShaders(GLuint a0, GLsizei a1, GLsizei *a2, GLuint *a3)
+	{
+		return reinterpret_cast<PFNGETATTACHEDSHADERS>(ResolveCoreFunction(117))(a0, a1, a2, a3);
+	}
+	
+	static GLint CODEGEN_FUNCPTR Switch_GetAttribLocation(GLuint a0, const GLchar *a1)
+	{
+		return reinterpret_cast<PFNGETATTRIBLOCATION>(ResolveCoreFunction(118))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetProgramInfoLog(GLuint a0, GLsizei a1, GLsizei *a2, GLchar *a3)
+	{
+		return reinterpret_cast<PFNGETPROGRAMINFOLOG>(ResolveCoreFunction(119))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetProgramiv(GLuint a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETPROGRAMIV>(ResolveCoreFunction(120))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetShaderInfoLog(GLuint a0, GLsizei a1, GLsizei *a2, GLchar *a3)
+	{
+		return reinterpret_cast<PFNGETSHADERINFOLOG>(ResolveCoreFunction(121))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetShaderSource(GLuint a0, GLsizei a1, GLsizei *a2, GLchar *a3)
+	{
+		return reinterpret_cast<PFNGETSHADERSOURCE>(ResolveCoreFunction(122))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetShaderiv(GLuint a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETSHADERIV>(ResolveCoreFunction(123))(a0, a1, a2);
+	}
+	
+	static GLint CODEGEN_FUNCPTR Switch_GetUniformLocation(GLuint a0, const GLchar *a1)
+	{
+		return reinterpret_cast<PFNGETUNIFORMLOCATION>(ResolveCoreFunction(124))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetUniformfv(GLuint a0, GLint a1, GLfloat *a2)
+	{
+		return reinterpret_cast<PFNGETUNIFORMFV>(ResolveCoreFunction(125))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetUniformiv(GLuint a0, GLint a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETUNIFORMIV>(ResolveCoreFunction(126))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribPointerv(GLuint a0, GLenum a1, GLvoid **a2)
+	{
+		return reinterpret_cast<PFNGETVERTEXATTRIBPOINTERV>(ResolveCoreFunction(127))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribdv(GLuint a0, GLenum a1, GLdouble *a2)
+	{
+		return reinterpret_cast<PFNGETVERTEXATTRIBDV>(ResolveCoreFunction(128))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribfv(GLuint a0, GLenum a1, GLfloat *a2)
+	{
+		return reinterpret_cast<PFNGETVERTEXATTRIBFV>(ResolveCoreFunction(129))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribiv(GLuint a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETVERTEXATTRIBIV>(ResolveCoreFunction(130))(a0, a1, a2);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsProgram(GLuint a0)
+	{
+		return reinterpret_cast<PFNISPROGRAM>(ResolveCoreFunction(131))(a0);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsShader(GLuint a0)
+	{
+		return reinterpret_cast<PFNISSHADER>(ResolveCoreFunction(132))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_LinkProgram(GLuint a0)
+	{
+		return reinterpret_cast<PFNLINKPROGRAM>(ResolveCoreFunction(133))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ShaderSource(GLuint a0, GLsizei a1, const GLchar *const*a2, const GLint *a3)
+	{
+		return reinterpret_cast<PFNSHADERSOURCE>(ResolveCoreFunction(134))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_StencilFuncSeparate(GLenum a0, GLenum a1, GLint a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNSTENCILFUNCSEPARATE>(ResolveCoreFunction(135))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_StencilMaskSeparate(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNSTENCILMASKSEPARATE>(ResolveCoreFunction(136))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_StencilOpSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3)
+	{
+		return reinterpret_cast<PFNSTENCILOPSEPARATE>(ResolveCoreFunction(137))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform1f(GLint a0, GLfloat a1)
+	{
+		return reinterpret_cast<PFNUNIFORM1F>(ResolveCoreFunction(138))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform1fv(GLint a0, GLsizei a1, const GLfloat *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM1FV>(ResolveCoreFunction(139))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform1i(GLint a0, GLint a1)
+	{
+		return reinterpret_cast<PFNUNIFORM1I>(ResolveCoreFunction(140))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform1iv(GLint a0, GLsizei a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM1IV>(ResolveCoreFunction(141))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform2f(GLint a0, GLfloat a1, GLfloat a2)
+	{
+		return reinterpret_cast<PFNUNIFORM2F>(ResolveCoreFunction(142))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform2fv(GLint a0, GLsizei a1, const GLfloat *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM2FV>(ResolveCoreFunction(143))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform2i(GLint a0, GLint a1, GLint a2)
+	{
+		return reinterpret_cast<PFNUNIFORM2I>(ResolveCoreFunction(144))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform2iv(GLint a0, GLsizei a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM2IV>(ResolveCoreFunction(145))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform3f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+	{
+		return reinterpret_cast<PFNUNIFORM3F>(ResolveCoreFunction(146))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform3fv(GLint a0, GLsizei a1, const GLfloat *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM3FV>(ResolveCoreFunction(147))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform3i(GLint a0, GLint a1, GLint a2, GLint a3)
+	{
+		return reinterpret_cast<PFNUNIFORM3I>(ResolveCoreFunction(148))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform3iv(GLint a0, GLsizei a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM3IV>(ResolveCoreFunction(149))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform4f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+	{
+		return reinterpret_cast<PFNUNIFORM4F>(ResolveCoreFunction(150))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform4fv(GLint a0, GLsizei a1, const GLfloat *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM4FV>(ResolveCoreFunction(151))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform4i(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+	{
+		return reinterpret_cast<PFNUNIFORM4I>(ResolveCoreFunction(152))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform4iv(GLint a0, GLsizei a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM4IV>(ResolveCoreFunction(153))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX2FV>(ResolveCoreFunction(154))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX3FV>(ResolveCoreFunction(155))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX4FV>(ResolveCoreFunction(156))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UseProgram(GLuint a0)
+	{
+		return reinterpret_cast<PFNUSEPROGRAM>(ResolveCoreFunction(157))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ValidateProgram(GLuint a0)
+	{
+		return reinterpret_cast<PFNVALIDATEPROGRAM>(ResolveCoreFunction(158))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1d(GLuint a0, GLdouble a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB1D>(ResolveCoreFunction(159))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1dv(GLuint a0, const GLdouble *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB1DV>(ResolveCoreFunction(160))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1f(GLuint a0, GLfloat a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB1F>(ResolveCoreFunction(161))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1fv(GLuint a0, const GLfloat *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB1FV>(ResolveCoreFunction(162))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1s(GLuint a0, GLshort a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB1S>(ResolveCoreFunction(163))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib1sv(GLuint a0, const GLshort *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB1SV>(ResolveCoreFunction(164))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2d(GLuint a0, GLdouble a1, GLdouble a2)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB2D>(ResolveCoreFunction(165))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2dv(GLuint a0, const GLdouble *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB2DV>(ResolveCoreFunction(166))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2f(GLuint a0, GLfloat a1, GLfloat a2)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB2F>(ResolveCoreFunction(167))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2fv(GLuint a0, const GLfloat *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB2FV>(ResolveCoreFunction(168))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2s(GLuint a0, GLshort a1, GLshort a2)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB2S>(ResolveCoreFunction(169))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib2sv(GLuint a0, const GLshort *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB2SV>(ResolveCoreFunction(170))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB3D>(ResolveCoreFunction(171))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3dv(GLuint a0, const GLdouble *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB3DV>(ResolveCoreFunction(172))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB3F>(ResolveCoreFunction(173))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3fv(GLuint a0, const GLfloat *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB3FV>(ResolveCoreFunction(174))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3s(GLuint a0, GLshort a1, GLshort a2, GLshort a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB3S>(ResolveCoreFunction(175))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib3sv(GLuint a0, const GLshort *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB3SV>(ResolveCoreFunction(176))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nbv(GLuint a0, const GLbyte *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4NBV>(ResolveCoreFunction(177))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Niv(GLuint a0, const GLint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4NIV>(ResolveCoreFunction(178))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nsv(GLuint a0, const GLshort *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4NSV>(ResolveCoreFunction(179))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nub(GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4NUB>(ResolveCoreFunction(180))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nubv(GLuint a0, const GLubyte *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4NUBV>(ResolveCoreFunction(181))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nuiv(GLuint a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4NUIV>(ResolveCoreFunction(182))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4Nusv(GLuint a0, const GLushort *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4NUSV>(ResolveCoreFunction(183))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4bv(GLuint a0, const GLbyte *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4BV>(ResolveCoreFunction(184))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4D>(ResolveCoreFunction(185))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4dv(GLuint a0, const GLdouble *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4DV>(ResolveCoreFunction(186))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4F>(ResolveCoreFunction(187))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4fv(GLuint a0, const GLfloat *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4FV>(ResolveCoreFunction(188))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4iv(GLuint a0, const GLint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4IV>(ResolveCoreFunction(189))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4s(GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4S>(ResolveCoreFunction(190))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4sv(GLuint a0, const GLshort *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4SV>(ResolveCoreFunction(191))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4ubv(GLuint a0, const GLubyte *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4UBV>(ResolveCoreFunction(192))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4uiv(GLuint a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4UIV>(ResolveCoreFunction(193))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttrib4usv(GLuint a0, const GLushort *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIB4USV>(ResolveCoreFunction(194))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribPointer(GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const GLvoid *a5)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBPOINTER>(ResolveCoreFunction(195))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x3fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX2X3FV>(ResolveCoreFunction(196))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x4fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX2X4FV>(ResolveCoreFunction(197))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x2fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX3X2FV>(ResolveCoreFunction(198))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x4fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX3X4FV>(ResolveCoreFunction(199))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x2fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX4X2FV>(ResolveCoreFunction(200))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x3fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX4X3FV>(ResolveCoreFunction(201))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BeginConditionalRender(GLuint a0, GLenum a1)
+	{
+		return reinterpret_cast<PFNBEGINCONDITIONALRENDER>(ResolveCoreFunction(202))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BeginTransformFeedback(GLenum a0)
+	{
+		return reinterpret_cast<PFNBEGINTRANSFORMFEEDBACK>(ResolveCoreFunction(203))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindBufferBase(GLenum a0, GLuint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNBINDBUFFERBASE>(ResolveCoreFunction(204))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindBufferRange(GLenum a0, GLuint a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+	{
+		return reinterpret_cast<PFNBINDBUFFERRANGE>(ResolveCoreFunction(205))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindFragDataLocation(GLuint a0, GLuint a1, const GLchar *a2)
+	{
+		return reinterpret_cast<PFNBINDFRAGDATALOCATION>(ResolveCoreFunction(206))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindFramebuffer(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNBINDFRAMEBUFFER>(ResolveCoreFunction(207))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindRenderbuffer(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNBINDRENDERBUFFER>(ResolveCoreFunction(208))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindVertexArray(GLuint a0)
+	{
+		return reinterpret_cast<PFNBINDVERTEXARRAY>(ResolveCoreFunction(209))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BlitFramebuffer(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9)
+	{
+		return reinterpret_cast<PFNBLITFRAMEBUFFER>(ResolveCoreFunction(210))(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9);
+	}
+	
+	static GLenum CODEGEN_FUNCPTR Switch_CheckFramebufferStatus(GLenum a0)
+	{
+		return reinterpret_cast<PFNCHECKFRAMEBUFFERSTATUS>(ResolveCoreFunction(211))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClampColor(GLenum a0, GLenum a1)
+	{
+		return reinterpret_cast<PFNCLAMPCOLOR>(ResolveCoreFunction(212))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearBufferfi(GLenum a0, GLint a1, GLfloat a2, GLint a3)
+	{
+		return reinterpret_cast<PFNCLEARBUFFERFI>(ResolveCoreFunction(213))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearBufferfv(GLenum a0, GLint a1, const GLfloat *a2)
+	{
+		return reinterpret_cast<PFNCLEARBUFFERFV>(ResolveCoreFunction(214))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearBufferiv(GLenum a0, GLint a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNCLEARBUFFERIV>(ResolveCoreFunction(215))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearBufferuiv(GLenum a0, GLint a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNCLEARBUFFERUIV>(ResolveCoreFunction(216))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ColorMaski(GLuint a0, GLboolean a1, GLboolean a2, GLboolean a3, GLboolean a4)
+	{
+		return reinterpret_cast<PFNCOLORMASKI>(ResolveCoreFunction(217))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteFramebuffers(GLsizei a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNDELETEFRAMEBUFFERS>(ResolveCoreFunction(218))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteRenderbuffers(GLsizei a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNDELETERENDERBUFFERS>(ResolveCoreFunction(219))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteVertexArrays(GLsizei a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNDELETEVERTEXARRAYS>(ResolveCoreFunction(220))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Disablei(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNDISABLEI>(ResolveCoreFunction(221))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Enablei(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNENABLEI>(ResolveCoreFunction(222))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_EndConditionalRender()
+	{
+		return reinterpret_cast<PFNENDCONDITIONALRENDER>(ResolveCoreFunction(223))();
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_EndTransformFeedback()
+	{
+		return reinterpret_cast<PFNENDTRANSFORMFEEDBACK>(ResolveCoreFunction(224))();
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_FlushMappedBufferRange(GLenum a0, GLintptr a1, GLsizeiptr a2)
+	{
+		return reinterpret_cast<PFNFLUSHMAPPEDBUFFERRANGE>(ResolveCoreFunction(225))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_FramebufferRenderbuffer(GLenum a0, GLenum a1, GLenum a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNFRAMEBUFFERRENDERBUFFER>(ResolveCoreFunction(226))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture1D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+	{
+		return reinterpret_cast<PFNFRAMEBUFFERTEXTURE1D>(ResolveCoreFunction(227))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture2D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4)
+	{
+		return reinterpret_cast<PFNFRAMEBUFFERTEXTURE2D>(ResolveCoreFunction(228))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture3D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5)
+	{
+		return reinterpret_cast<PFNFRAMEBUFFERTEXTURE3D>(ResolveCoreFunction(229))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_FramebufferTextureLayer(GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4)
+	{
+		return reinterpret_cast<PFNFRAMEBUFFERTEXTURELAYER>(ResolveCoreFunction(230))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenFramebuffers(GLsizei a0, GLuint *a1)
+	{
+		return reinterpret_cast<PFNGENFRAMEBUFFERS>(ResolveCoreFunction(231))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenRenderbuffers(GLsizei a0, GLuint *a1)
+	{
+		return reinterpret_cast<PFNGENRENDERBUFFERS>(ResolveCoreFunction(232))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenVertexArrays(GLsizei a0, GLuint *a1)
+	{
+		return reinterpret_cast<PFNGENVERTEXARRAYS>(ResolveCoreFunction(233))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenerateMipmap(GLenum a0)
+	{
+		return reinterpret_cast<PFNGENERATEMIPMAP>(ResolveCoreFunction(234))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetBooleani_v(GLenum a0, GLuint a1, GLboolean *a2)
+	{
+		return reinterpret_cast<PFNGETBOOLEANI_V>(ResolveCoreFunction(235))(a0, a1, a2);
+	}
+	
+	static GLint CODEGEN_FUNCPTR Switch_GetFragDataLocation(GLuint a0, const GLchar *a1)
+	{
+		return reinterpret_cast<PFNGETFRAGDATALOCATION>(ResolveCoreFunction(236))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetFramebufferAttachmentParameteriv(GLenum a0, GLenum a1, GLenum a2, GLint *a3)
+	{
+		return reinterpret_cast<PFNGETFRAMEBUFFERATTACHMENTPARAMETERIV>(ResolveCoreFunction(237))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetIntegeri_v(GLenum a0, GLuint a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETINTEGERI_V>(ResolveCoreFunction(238))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetRenderbufferParameteriv(GLenum a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETRENDERBUFFERPARAMETERIV>(ResolveCoreFunction(239))(a0, a1, a2);
+	}
+	
+	static const GLubyte * CODEGEN_FUNCPTR Switch_GetStringi(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNGETSTRINGI>(ResolveCoreFunction(240))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetTexParameterIiv(GLenum a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETTEXPARAMETERIIV>(ResolveCoreFunction(241))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetTexParameterIuiv(GLenum a0, GLenum a1, GLuint *a2)
+	{
+		return reinterpret_cast<PFNGETTEXPARAMETERIUIV>(ResolveCoreFunction(242))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetTransformFeedbackVarying(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLsizei *a4, GLenum *a5, GLchar *a6)
+	{
+		return reinterpret_cast<PFNGETTRANSFORMFEEDBACKVARYING>(ResolveCoreFunction(243))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetUniformuiv(GLuint a0, GLint a1, GLuint *a2)
+	{
+		return reinterpret_cast<PFNGETUNIFORMUIV>(ResolveCoreFunction(244))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribIiv(GLuint a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETVERTEXATTRIBIIV>(ResolveCoreFunction(245))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribIuiv(GLuint a0, GLenum a1, GLuint *a2)
+	{
+		return reinterpret_cast<PFNGETVERTEXATTRIBIUIV>(ResolveCoreFunction(246))(a0, a1, a2);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsEnabledi(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNISENABLEDI>(ResolveCoreFunction(247))(a0, a1);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsFramebuffer(GLuint a0)
+	{
+		return reinterpret_cast<PFNISFRAMEBUFFER>(ResolveCoreFunction(248))(a0);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsRenderbuffer(GLuint a0)
+	{
+		return reinterpret_cast<PFNISRENDERBUFFER>(ResolveCoreFunction(249))(a0);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsVertexArray(GLuint a0)
+	{
+		return reinterpret_cast<PFNISVERTEXARRAY>(ResolveCoreFunction(250))(a0);
+	}
+	
+	static void * CODEGEN_FUNCPTR Switch_MapBufferRange(GLenum a0, GLintptr a1, GLsizeiptr a2, GLbitfield a3)
+	{
+		return reinterpret_cast<PFNMAPBUFFERRANGE>(ResolveCoreFunction(251))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_RenderbufferStorage(GLenum a0, GLenum a1, GLsizei a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNRENDERBUFFERSTORAGE>(ResolveCoreFunction(252))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_RenderbufferStorageMultisample(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+	{
+		return reinterpret_cast<PFNRENDERBUFFERSTORAGEMULTISAMPLE>(ResolveCoreFunction(253))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexParameterIiv(GLenum a0, GLenum a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNTEXPARAMETERIIV>(ResolveCoreFunction(254))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexParameterIuiv(GLenum a0, GLenum a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNTEXPARAMETERIUIV>(ResolveCoreFunction(255))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TransformFeedbackVaryings(GLuint a0, GLsizei a1, const GLchar *const*a2, GLenum a3)
+	{
+		return reinterpret_cast<PFNTRANSFORMFEEDBACKVARYINGS>(ResolveCoreFunction(256))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform1ui(GLint a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNUNIFORM1UI>(ResolveCoreFunction(257))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform1uiv(GLint a0, GLsizei a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM1UIV>(ResolveCoreFunction(258))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform2ui(GLint a0, GLuint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNUNIFORM2UI>(ResolveCoreFunction(259))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform2uiv(GLint a0, GLsizei a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM2UIV>(ResolveCoreFunction(260))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform3ui(GLint a0, GLuint a1, GLuint a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNUNIFORM3UI>(ResolveCoreFunction(261))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform3uiv(GLint a0, GLsizei a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM3UIV>(ResolveCoreFunction(262))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform4ui(GLint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+	{
+		return reinterpret_cast<PFNUNIFORM4UI>(ResolveCoreFunction(263))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform4uiv(GLint a0, GLsizei a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM4UIV>(ResolveCoreFunction(264))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1i(GLuint a0, GLint a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI1I>(ResolveCoreFunction(265))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1iv(GLuint a0, const GLint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI1IV>(ResolveCoreFunction(266))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1ui(GLuint a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI1UI>(ResolveCoreFunction(267))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI1uiv(GLuint a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI1UIV>(ResolveCoreFunction(268))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2i(GLuint a0, GLint a1, GLint a2)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI2I>(ResolveCoreFunction(269))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2iv(GLuint a0, const GLint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI2IV>(ResolveCoreFunction(270))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2ui(GLuint a0, GLuint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI2UI>(ResolveCoreFunction(271))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI2uiv(GLuint a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI2UIV>(ResolveCoreFunction(272))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3i(GLuint a0, GLint a1, GLint a2, GLint a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI3I>(ResolveCoreFunction(273))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3iv(GLuint a0, const GLint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI3IV>(ResolveCoreFunction(274))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3ui(GLuint a0, GLuint a1, GLuint a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI3UI>(ResolveCoreFunction(275))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI3uiv(GLuint a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI3UIV>(ResolveCoreFunction(276))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4bv(GLuint a0, const GLbyte *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI4BV>(ResolveCoreFunction(277))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4i(GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI4I>(ResolveCoreFunction(278))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4iv(GLuint a0, const GLint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI4IV>(ResolveCoreFunction(279))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4sv(GLuint a0, const GLshort *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI4SV>(ResolveCoreFunction(280))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4ubv(GLuint a0, const GLubyte *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI4UBV>(ResolveCoreFunction(281))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4ui(GLuint a0, GLuint a1, GLuint a2, GLuint a3, GLuint a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI4UI>(ResolveCoreFunction(282))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4uiv(GLuint a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI4UIV>(ResolveCoreFunction(283))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribI4usv(GLuint a0, const GLushort *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBI4USV>(ResolveCoreFunction(284))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribIPointer(GLuint a0, GLint a1, GLenum a2, GLsizei a3, const GLvoid *a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBIPOINTER>(ResolveCoreFunction(285))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CopyBufferSubData(GLenum a0, GLenum a1, GLintptr a2, GLintptr a3, GLsizeiptr a4)
+	{
+		return reinterpret_cast<PFNCOPYBUFFERSUBDATA>(ResolveCoreFunction(286))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawArraysInstanced(GLenum a0, GLint a1, GLsizei a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNDRAWARRAYSINSTANCED>(ResolveCoreFunction(287))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstanced(GLenum a0, GLsizei a1, GLenum a2, const GLvoid *a3, GLsizei a4)
+	{
+		return reinterpret_cast<PFNDRAWELEMENTSINSTANCED>(ResolveCoreFunction(288))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformBlockName(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLchar *a4)
+	{
+		return reinterpret_cast<PFNGETACTIVEUNIFORMBLOCKNAME>(ResolveCoreFunction(289))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformBlockiv(GLuint a0, GLuint a1, GLenum a2, GLint *a3)
+	{
+		return reinterpret_cast<PFNGETACTIVEUNIFORMBLOCKIV>(ResolveCoreFunction(290))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformName(GLuint a0, GLuint a1, GLsizei a2, GLsizei *a3, GLchar *a4)
+	{
+		return reinterpret_cast<PFNGETACTIVEUNIFORMNAME>(ResolveCoreFunction(291))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveUniformsiv(GLuint a0, GLsizei a1, const GLuint *a2, GLenum a3, GLint *a4)
+	{
+		return reinterpret_cast<PFNGETACTIVEUNIFORMSIV>(ResolveCoreFunction(292))(a0, a1, a2, a3, a4);
+	}
+	
+	static GLuint CODEGEN_FUNCPTR Switch_GetUniformBlockIndex(GLuint a0, const GLchar *a1)
+	{
+		return reinterpret_cast<PFNGETUNIFORMBLOCKINDEX>(ResolveCoreFunction(293))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetUniformIndices(GLuint a0, GLsizei a1, const GLchar *const*a2, GLuint *a3)
+	{
+		return reinterpret_cast<PFNGETUNIFORMINDICES>(ResolveCoreFunction(294))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PrimitiveRestartIndex(GLuint a0)
+	{
+		return reinterpret_cast<PFNPRIMITIVERESTARTINDEX>(ResolveCoreFunction(295))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexBuffer(GLenum a0, GLenum a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNTEXBUFFER>(ResolveCoreFunction(296))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformBlockBinding(GLuint a0, GLuint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNUNIFORMBLOCKBINDING>(ResolveCoreFunction(297))(a0, a1, a2);
+	}
+	
+	static GLenum CODEGEN_FUNCPTR Switch_ClientWaitSync(GLsync a0, GLbitfield a1, GLuint64 a2)
+	{
+		return reinterpret_cast<PFNCLIENTWAITSYNC>(ResolveCoreFunction(298))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteSync(GLsync a0)
+	{
+		return reinterpret_cast<PFNDELETESYNC>(ResolveCoreFunction(299))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawElementsBaseVertex(GLenum a0, GLsizei a1, GLenum a2, const GLvoid *a3, GLint a4)
+	{
+		return reinterpret_cast<PFNDRAWELEMENTSBASEVERTEX>(ResolveCoreFunction(300))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstancedBaseVertex(GLenum a0, GLsizei a1, GLenum a2, const GLvoid *a3, GLsizei a4, GLint a5)
+	{
+		return reinterpret_cast<PFNDRAWELEMENTSINSTANCEDBASEVERTEX>(ResolveCoreFunction(301))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawRangeElementsBaseVertex(GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const GLvoid *a5, GLint a6)
+	{
+		return reinterpret_cast<PFNDRAWRANGEELEMENTSBASEVERTEX>(ResolveCoreFunction(302))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static GLsync CODEGEN_FUNCPTR Switch_FenceSync(GLenum a0, GLbitfield a1)
+	{
+		return reinterpret_cast<PFNFENCESYNC>(ResolveCoreFunction(303))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_FramebufferTexture(GLenum a0, GLenum a1, GLuint a2, GLint a3)
+	{
+		return reinterpret_cast<PFNFRAMEBUFFERTEXTURE>(ResolveCoreFunction(304))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetBufferParameteri64v(GLenum a0, GLenum a1, GLint64 *a2)
+	{
+		return reinterpret_cast<PFNGETBUFFERPARAMETERI64V>(ResolveCoreFunction(305))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetInteger64i_v(GLenum a0, GLuint a1, GLint64 *a2)
+	{
+		return reinterpret_cast<PFNGETINTEGER64I_V>(ResolveCoreFunction(306))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetInteger64v(GLenum a0, GLint64 *a1)
+	{
+		return reinterpret_cast<PFNGETINTEGER64V>(ResolveCoreFunction(307))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetMultisamplefv(GLenum a0, GLuint a1, GLfloat *a2)
+	{
+		return reinterpret_cast<PFNGETMULTISAMPLEFV>(ResolveCoreFunction(308))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetSynciv(GLsync a0, GLenum a1, GLsizei a2, GLsizei *a3, GLint *a4)
+	{
+		return reinterpret_cast<PFNGETSYNCIV>(ResolveCoreFunction(309))(a0, a1, a2, a3, a4);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsSync(GLsync a0)
+	{
+		return reinterpret_cast<PFNISSYNC>(ResolveCoreFunction(310))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiDrawElementsBaseVertex(GLenum a0, const GLsizei *a1, GLenum a2, const GLvoid *const*a3, GLsizei a4, const GLint *a5)
+	{
+		return reinterpret_cast<PFNMULTIDRAWELEMENTSBASEVERTEX>(ResolveCoreFunction(311))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProvokingVertex(GLenum a0)
+	{
+		return reinterpret_cast<PFNPROVOKINGVERTEX>(ResolveCoreFunction(312))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SampleMaski(GLuint a0, GLbitfield a1)
+	{
+		return reinterpret_cast<PFNSAMPLEMASKI>(ResolveCoreFunction(313))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexImage2DMultisample(GLenum a0, GLsizei a1, GLint a2, GLsizei a3, GLsizei a4, GLboolean a5)
+	{
+		return reinterpret_cast<PFNTEXIMAGE2DMULTISAMPLE>(ResolveCoreFunction(314))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexImage3DMultisample(GLenum a0, GLsizei a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+	{
+		return reinterpret_cast<PFNTEXIMAGE3DMULTISAMPLE>(ResolveCoreFunction(315))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_WaitSync(GLsync a0, GLbitfield a1, GLuint64 a2)
+	{
+		return reinterpret_cast<PFNWAITSYNC>(ResolveCoreFunction(316))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindFragDataLocationIndexed(GLuint a0, GLuint a1, GLuint a2, const GLchar *a3)
+	{
+		return reinterpret_cast<PFNBINDFRAGDATALOCATIONINDEXED>(ResolveCoreFunction(317))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindSampler(GLuint a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNBINDSAMPLER>(ResolveCoreFunction(318))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ColorP3ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNCOLORP3UI>(ResolveCoreFunction(319))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ColorP3uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNCOLORP3UIV>(ResolveCoreFunction(320))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ColorP4ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNCOLORP4UI>(ResolveCoreFunction(321))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ColorP4uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNCOLORP4UIV>(ResolveCoreFunction(322))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteSamplers(GLsizei a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNDELETESAMPLERS>(ResolveCoreFunction(323))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenSamplers(GLsizei a0, GLuint *a1)
+	{
+		return reinterpret_cast<PFNGENSAMPLERS>(ResolveCoreFunction(324))(a0, a1);
+	}
+	
+	static GLint CODEGEN_FUNCPTR Switch_GetFragDataIndex(GLuint a0, const GLchar *a1)
+	{
+		return reinterpret_cast<PFNGETFRAGDATAINDEX>(ResolveCoreFunction(325))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjecti64v(GLuint a0, GLenum a1, GLint64 *a2)
+	{
+		return reinterpret_cast<PFNGETQUERYOBJECTI64V>(ResolveCoreFunction(326))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetQueryObjectui64v(GLuint a0, GLenum a1, GLuint64 *a2)
+	{
+		return reinterpret_cast<PFNGETQUERYOBJECTUI64V>(ResolveCoreFunction(327))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameterIiv(GLuint a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETSAMPLERPARAMETERIIV>(ResolveCoreFunction(328))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameterIuiv(GLuint a0, GLenum a1, GLuint *a2)
+	{
+		return reinterpret_cast<PFNGETSAMPLERPARAMETERIUIV>(ResolveCoreFunction(329))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameterfv(GLuint a0, GLenum a1, GLfloat *a2)
+	{
+		return reinterpret_cast<PFNGETSAMPLERPARAMETERFV>(ResolveCoreFunction(330))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetSamplerParameteriv(GLuint a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETSAMPLERPARAMETERIV>(ResolveCoreFunction(331))(a0, a1, a2);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsSampler(GLuint a0)
+	{
+		return reinterpret_cast<PFNISSAMPLER>(ResolveCoreFunction(332))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiTexCoordP1ui(GLenum a0, GLenum a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNMULTITEXCOORDP1UI>(ResolveCoreFunction(333))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiTexCoordP1uiv(GLenum a0, GLenum a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNMULTITEXCOORDP1UIV>(ResolveCoreFunction(334))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiTexCoordP2ui(GLenum a0, GLenum a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNMULTITEXCOORDP2UI>(ResolveCoreFunction(335))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiTexCoordP2uiv(GLenum a0, GLenum a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNMULTITEXCOORDP2UIV>(ResolveCoreFunction(336))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiTexCoordP3ui(GLenum a0, GLenum a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNMULTITEXCOORDP3UI>(ResolveCoreFunction(337))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiTexCoordP3uiv(GLenum a0, GLenum a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNMULTITEXCOORDP3UIV>(ResolveCoreFunction(338))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiTexCoordP4ui(GLenum a0, GLenum a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNMULTITEXCOORDP4UI>(ResolveCoreFunction(339))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiTexCoordP4uiv(GLenum a0, GLenum a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNMULTITEXCOORDP4UIV>(ResolveCoreFunction(340))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_NormalP3ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNNORMALP3UI>(ResolveCoreFunction(341))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_NormalP3uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNNORMALP3UIV>(ResolveCoreFunction(342))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_QueryCounter(GLuint a0, GLenum a1)
+	{
+		return reinterpret_cast<PFNQUERYCOUNTER>(ResolveCoreFunction(343))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterIiv(GLuint a0, GLenum a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNSAMPLERPARAMETERIIV>(ResolveCoreFunction(344))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterIuiv(GLuint a0, GLenum a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNSAMPLERPARAMETERIUIV>(ResolveCoreFunction(345))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterf(GLuint a0, GLenum a1, GLfloat a2)
+	{
+		return reinterpret_cast<PFNSAMPLERPARAMETERF>(ResolveCoreFunction(346))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SamplerParameterfv(GLuint a0, GLenum a1, const GLfloat *a2)
+	{
+		return reinterpret_cast<PFNSAMPLERPARAMETERFV>(ResolveCoreFunction(347))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SamplerParameteri(GLuint a0, GLenum a1, GLint a2)
+	{
+		return reinterpret_cast<PFNSAMPLERPARAMETERI>(ResolveCoreFunction(348))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SamplerParameteriv(GLuint a0, GLenum a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNSAMPLERPARAMETERIV>(ResolveCoreFunction(349))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SecondaryColorP3ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNSECONDARYCOLORP3UI>(ResolveCoreFunction(350))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_SecondaryColorP3uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNSECONDARYCOLORP3UIV>(ResolveCoreFunction(351))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexCoordP1ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNTEXCOORDP1UI>(ResolveCoreFunction(352))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexCoordP1uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNTEXCOORDP1UIV>(ResolveCoreFunction(353))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexCoordP2ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNTEXCOORDP2UI>(ResolveCoreFunction(354))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexCoordP2uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNTEXCOORDP2UIV>(ResolveCoreFunction(355))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexCoordP3ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNTEXCOORDP3UI>(ResolveCoreFunction(356))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexCoordP3uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNTEXCOORDP3UIV>(ResolveCoreFunction(357))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexCoordP4ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNTEXCOORDP4UI>(ResolveCoreFunction(358))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexCoordP4uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNTEXCOORDP4UIV>(ResolveCoreFunction(359))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribDivisor(GLuint a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBDIVISOR>(ResolveCoreFunction(360))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP1ui(GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBP1UI>(ResolveCoreFunction(361))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP1uiv(GLuint a0, GLenum a1, GLboolean a2, const GLuint *a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBP1UIV>(ResolveCoreFunction(362))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP2ui(GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBP2UI>(ResolveCoreFunction(363))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP2uiv(GLuint a0, GLenum a1, GLboolean a2, const GLuint *a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBP2UIV>(ResolveCoreFunction(364))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP3ui(GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBP3UI>(ResolveCoreFunction(365))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP3uiv(GLuint a0, GLenum a1, GLboolean a2, const GLuint *a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBP3UIV>(ResolveCoreFunction(366))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP4ui(GLuint a0, GLenum a1, GLboolean a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBP4UI>(ResolveCoreFunction(367))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribP4uiv(GLuint a0, GLenum a1, GLboolean a2, const GLuint *a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBP4UIV>(ResolveCoreFunction(368))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexP2ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNVERTEXP2UI>(ResolveCoreFunction(369))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexP2uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXP2UIV>(ResolveCoreFunction(370))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexP3ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNVERTEXP3UI>(ResolveCoreFunction(371))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexP3uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXP3UIV>(ResolveCoreFunction(372))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexP4ui(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNVERTEXP4UI>(ResolveCoreFunction(373))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexP4uiv(GLenum a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNVERTEXP4UIV>(ResolveCoreFunction(374))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BeginQueryIndexed(GLenum a0, GLuint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNBEGINQUERYINDEXED>(ResolveCoreFunction(375))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindTransformFeedback(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNBINDTRANSFORMFEEDBACK>(ResolveCoreFunction(376))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BlendEquationSeparatei(GLuint a0, GLenum a1, GLenum a2)
+	{
+		return reinterpret_cast<PFNBLENDEQUATIONSEPARATEI>(ResolveCoreFunction(377))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BlendEquationi(GLuint a0, GLenum a1)
+	{
+		return reinterpret_cast<PFNBLENDEQUATIONI>(ResolveCoreFunction(378))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BlendFuncSeparatei(GLuint a0, GLenum a1, GLenum a2, GLenum a3, GLenum a4)
+	{
+		return reinterpret_cast<PFNBLENDFUNCSEPARATEI>(ResolveCoreFunction(379))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BlendFunci(GLuint a0, GLenum a1, GLenum a2)
+	{
+		return reinterpret_cast<PFNBLENDFUNCI>(ResolveCoreFunction(380))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteTransformFeedbacks(GLsizei a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNDELETETRANSFORMFEEDBACKS>(ResolveCoreFunction(381))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawArraysIndirect(GLenum a0, const GLvoid *a1)
+	{
+		return reinterpret_cast<PFNDRAWARRAYSINDIRECT>(ResolveCoreFunction(382))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawElementsIndirect(GLenum a0, GLenum a1, const GLvoid *a2)
+	{
+		return reinterpret_cast<PFNDRAWELEMENTSINDIRECT>(ResolveCoreFunction(383))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawTransformFeedback(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNDRAWTRANSFORMFEEDBACK>(ResolveCoreFunction(384))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawTransformFeedbackStream(GLenum a0, GLuint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNDRAWTRANSFORMFEEDBACKSTREAM>(ResolveCoreFunction(385))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_EndQueryIndexed(GLenum a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNENDQUERYINDEXED>(ResolveCoreFunction(386))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenTransformFeedbacks(GLsizei a0, GLuint *a1)
+	{
+		return reinterpret_cast<PFNGENTRANSFORMFEEDBACKS>(ResolveCoreFunction(387))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveSubroutineName(GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei *a4, GLchar *a5)
+	{
+		return reinterpret_cast<PFNGETACTIVESUBROUTINENAME>(ResolveCoreFunction(388))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveSubroutineUniformName(GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei *a4, GLchar *a5)
+	{
+		return reinterpret_cast<PFNGETACTIVESUBROUTINEUNIFORMNAME>(ResolveCoreFunction(389))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveSubroutineUniformiv(GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLint *a4)
+	{
+		return reinterpret_cast<PFNGETACTIVESUBROUTINEUNIFORMIV>(ResolveCoreFunction(390))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetProgramStageiv(GLuint a0, GLenum a1, GLenum a2, GLint *a3)
+	{
+		return reinterpret_cast<PFNGETPROGRAMSTAGEIV>(ResolveCoreFunction(391))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetQueryIndexediv(GLenum a0, GLuint a1, GLenum a2, GLint *a3)
+	{
+		return reinterpret_cast<PFNGETQUERYINDEXEDIV>(ResolveCoreFunction(392))(a0, a1, a2, a3);
+	}
+	
+	static GLuint CODEGEN_FUNCPTR Switch_GetSubroutineIndex(GLuint a0, GLenum a1, const GLchar *a2)
+	{
+		return reinterpret_cast<PFNGETSUBROUTINEINDEX>(ResolveCoreFunction(393))(a0, a1, a2);
+	}
+	
+	static GLint CODEGEN_FUNCPTR Switch_GetSubroutineUniformLocation(GLuint a0, GLenum a1, const GLchar *a2)
+	{
+		return reinterpret_cast<PFNGETSUBROUTINEUNIFORMLOCATION>(ResolveCoreFunction(394))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetUniformSubroutineuiv(GLenum a0, GLint a1, GLuint *a2)
+	{
+		return reinterpret_cast<PFNGETUNIFORMSUBROUTINEUIV>(ResolveCoreFunction(395))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetUniformdv(GLuint a0, GLint a1, GLdouble *a2)
+	{
+		return reinterpret_cast<PFNGETUNIFORMDV>(ResolveCoreFunction(396))(a0, a1, a2);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsTransformFeedback(GLuint a0)
+	{
+		return reinterpret_cast<PFNISTRANSFORMFEEDBACK>(ResolveCoreFunction(397))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MinSampleShading(GLfloat a0)
+	{
+		return reinterpret_cast<PFNMINSAMPLESHADING>(ResolveCoreFunction(398))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PatchParameterfv(GLenum a0, const GLfloat *a1)
+	{
+		return reinterpret_cast<PFNPATCHPARAMETERFV>(ResolveCoreFunction(399))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PatchParameteri(GLenum a0, GLint a1)
+	{
+		return reinterpret_cast<PFNPATCHPARAMETERI>(ResolveCoreFunction(400))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PauseTransformFeedback()
+	{
+		return reinterpret_cast<PFNPAUSETRANSFORMFEEDBACK>(ResolveCoreFunction(401))();
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ResumeTransformFeedback()
+	{
+		return reinterpret_cast<PFNRESUMETRANSFORMFEEDBACK>(ResolveCoreFunction(402))();
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform1d(GLint a0, GLdouble a1)
+	{
+		return reinterpret_cast<PFNUNIFORM1D>(ResolveCoreFunction(403))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform1dv(GLint a0, GLsizei a1, const GLdouble *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM1DV>(ResolveCoreFunction(404))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform2d(GLint a0, GLdouble a1, GLdouble a2)
+	{
+		return reinterpret_cast<PFNUNIFORM2D>(ResolveCoreFunction(405))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform2dv(GLint a0, GLsizei a1, const GLdouble *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM2DV>(ResolveCoreFunction(406))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform3d(GLint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+	{
+		return reinterpret_cast<PFNUNIFORM3D>(ResolveCoreFunction(407))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform3dv(GLint a0, GLsizei a1, const GLdouble *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM3DV>(ResolveCoreFunction(408))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform4d(GLint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+	{
+		return reinterpret_cast<PFNUNIFORM4D>(ResolveCoreFunction(409))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_Uniform4dv(GLint a0, GLsizei a1, const GLdouble *a2)
+	{
+		return reinterpret_cast<PFNUNIFORM4DV>(ResolveCoreFunction(410))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2dv(GLint a0, GLsizei a1, GLboolean a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX2DV>(ResolveCoreFunction(411))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x3dv(GLint a0, GLsizei a1, GLboolean a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX2X3DV>(ResolveCoreFunction(412))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix2x4dv(GLint a0, GLsizei a1, GLboolean a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX2X4DV>(ResolveCoreFunction(413))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3dv(GLint a0, GLsizei a1, GLboolean a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX3DV>(ResolveCoreFunction(414))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x2dv(GLint a0, GLsizei a1, GLboolean a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX3X2DV>(ResolveCoreFunction(415))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix3x4dv(GLint a0, GLsizei a1, GLboolean a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX3X4DV>(ResolveCoreFunction(416))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4dv(GLint a0, GLsizei a1, GLboolean a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX4DV>(ResolveCoreFunction(417))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x2dv(GLint a0, GLsizei a1, GLboolean a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX4X2DV>(ResolveCoreFunction(418))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformMatrix4x3dv(GLint a0, GLsizei a1, GLboolean a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNUNIFORMMATRIX4X3DV>(ResolveCoreFunction(419))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UniformSubroutinesuiv(GLenum a0, GLsizei a1, const GLuint *a2)
+	{
+		return reinterpret_cast<PFNUNIFORMSUBROUTINESUIV>(ResolveCoreFunction(420))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ActiveShaderProgram(GLuint a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNACTIVESHADERPROGRAM>(ResolveCoreFunction(421))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindProgramPipeline(GLuint a0)
+	{
+		return reinterpret_cast<PFNBINDPROGRAMPIPELINE>(ResolveCoreFunction(422))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearDepthf(GLfloat a0)
+	{
+		return reinterpret_cast<PFNCLEARDEPTHF>(ResolveCoreFunction(423))(a0);
+	}
+	
+	static GLuint CODEGEN_FUNCPTR Switch_CreateShaderProgramv(GLenum a0, GLsizei a1, const GLchar *const*a2)
+	{
+		return reinterpret_cast<PFNCREATESHADERPROGRAMV>(ResolveCoreFunction(424))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DeleteProgramPipelines(GLsizei a0, const GLuint *a1)
+	{
+		return reinterpret_cast<PFNDELETEPROGRAMPIPELINES>(ResolveCoreFunction(425))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DepthRangeArrayv(GLuint a0, GLsizei a1, const GLdouble *a2)
+	{
+		return reinterpret_cast<PFNDEPTHRANGEARRAYV>(ResolveCoreFunction(426))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DepthRangeIndexed(GLuint a0, GLdouble a1, GLdouble a2)
+	{
+		return reinterpret_cast<PFNDEPTHRANGEINDEXED>(ResolveCoreFunction(427))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DepthRangef(GLfloat a0, GLfloat a1)
+	{
+		return reinterpret_cast<PFNDEPTHRANGEF>(ResolveCoreFunction(428))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GenProgramPipelines(GLsizei a0, GLuint *a1)
+	{
+		return reinterpret_cast<PFNGENPROGRAMPIPELINES>(ResolveCoreFunction(429))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetDoublei_v(GLenum a0, GLuint a1, GLdouble *a2)
+	{
+		return reinterpret_cast<PFNGETDOUBLEI_V>(ResolveCoreFunction(430))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetFloati_v(GLenum a0, GLuint a1, GLfloat *a2)
+	{
+		return reinterpret_cast<PFNGETFLOATI_V>(ResolveCoreFunction(431))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetProgramBinary(GLuint a0, GLsizei a1, GLsizei *a2, GLenum *a3, GLvoid *a4)
+	{
+		return reinterpret_cast<PFNGETPROGRAMBINARY>(ResolveCoreFunction(432))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetProgramPipelineInfoLog(GLuint a0, GLsizei a1, GLsizei *a2, GLchar *a3)
+	{
+		return reinterpret_cast<PFNGETPROGRAMPIPELINEINFOLOG>(ResolveCoreFunction(433))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetProgramPipelineiv(GLuint a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETPROGRAMPIPELINEIV>(ResolveCoreFunction(434))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetShaderPrecisionFormat(GLenum a0, GLenum a1, GLint *a2, GLint *a3)
+	{
+		return reinterpret_cast<PFNGETSHADERPRECISIONFORMAT>(ResolveCoreFunction(435))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetVertexAttribLdv(GLuint a0, GLenum a1, GLdouble *a2)
+	{
+		return reinterpret_cast<PFNGETVERTEXATTRIBLDV>(ResolveCoreFunction(436))(a0, a1, a2);
+	}
+	
+	static GLboolean CODEGEN_FUNCPTR Switch_IsProgramPipeline(GLuint a0)
+	{
+		return reinterpret_cast<PFNISPROGRAMPIPELINE>(ResolveCoreFunction(437))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramBinary(GLuint a0, GLenum a1, const GLvoid *a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNPROGRAMBINARY>(ResolveCoreFunction(438))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramParameteri(GLuint a0, GLenum a1, GLint a2)
+	{
+		return reinterpret_cast<PFNPROGRAMPARAMETERI>(ResolveCoreFunction(439))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1d(GLuint a0, GLint a1, GLdouble a2)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM1D>(ResolveCoreFunction(440))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1dv(GLuint a0, GLint a1, GLsizei a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM1DV>(ResolveCoreFunction(441))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1f(GLuint a0, GLint a1, GLfloat a2)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM1F>(ResolveCoreFunction(442))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1fv(GLuint a0, GLint a1, GLsizei a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM1FV>(ResolveCoreFunction(443))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1i(GLuint a0, GLint a1, GLint a2)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM1I>(ResolveCoreFunction(444))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1iv(GLuint a0, GLint a1, GLsizei a2, const GLint *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM1IV>(ResolveCoreFunction(445))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1ui(GLuint a0, GLint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM1UI>(ResolveCoreFunction(446))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform1uiv(GLuint a0, GLint a1, GLsizei a2, const GLuint *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM1UIV>(ResolveCoreFunction(447))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2d(GLuint a0, GLint a1, GLdouble a2, GLdouble a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM2D>(ResolveCoreFunction(448))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2dv(GLuint a0, GLint a1, GLsizei a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM2DV>(ResolveCoreFunction(449))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2f(GLuint a0, GLint a1, GLfloat a2, GLfloat a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM2F>(ResolveCoreFunction(450))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2fv(GLuint a0, GLint a1, GLsizei a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM2FV>(ResolveCoreFunction(451))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2i(GLuint a0, GLint a1, GLint a2, GLint a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM2I>(ResolveCoreFunction(452))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2iv(GLuint a0, GLint a1, GLsizei a2, const GLint *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM2IV>(ResolveCoreFunction(453))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2ui(GLuint a0, GLint a1, GLuint a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM2UI>(ResolveCoreFunction(454))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform2uiv(GLuint a0, GLint a1, GLsizei a2, const GLuint *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM2UIV>(ResolveCoreFunction(455))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3d(GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM3D>(ResolveCoreFunction(456))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3dv(GLuint a0, GLint a1, GLsizei a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM3DV>(ResolveCoreFunction(457))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3f(GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM3F>(ResolveCoreFunction(458))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3fv(GLuint a0, GLint a1, GLsizei a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM3FV>(ResolveCoreFunction(459))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3i(GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM3I>(ResolveCoreFunction(460))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3iv(GLuint a0, GLint a1, GLsizei a2, const GLint *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM3IV>(ResolveCoreFunction(461))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3ui(GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM3UI>(ResolveCoreFunction(462))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform3uiv(GLuint a0, GLint a1, GLsizei a2, const GLuint *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM3UIV>(ResolveCoreFunction(463))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4d(GLuint a0, GLint a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM4D>(ResolveCoreFunction(464))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4dv(GLuint a0, GLint a1, GLsizei a2, const GLdouble *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM4DV>(ResolveCoreFunction(465))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4f(GLuint a0, GLint a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM4F>(ResolveCoreFunction(466))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4fv(GLuint a0, GLint a1, GLsizei a2, const GLfloat *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM4FV>(ResolveCoreFunction(467))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4i(GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM4I>(ResolveCoreFunction(468))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4iv(GLuint a0, GLint a1, GLsizei a2, const GLint *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM4IV>(ResolveCoreFunction(469))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4ui(GLuint a0, GLint a1, GLuint a2, GLuint a3, GLuint a4, GLuint a5)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM4UI>(ResolveCoreFunction(470))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniform4uiv(GLuint a0, GLint a1, GLsizei a2, const GLuint *a3)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORM4UIV>(ResolveCoreFunction(471))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2dv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2DV>(ResolveCoreFunction(472))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2fv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2FV>(ResolveCoreFunction(473))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2x3dv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2X3DV>(ResolveCoreFunction(474))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2x3fv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2X3FV>(ResolveCoreFunction(475))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2x4dv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2X4DV>(ResolveCoreFunction(476))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix2x4fv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX2X4FV>(ResolveCoreFunction(477))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3dv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3DV>(ResolveCoreFunction(478))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3fv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3FV>(ResolveCoreFunction(479))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3x2dv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3X2DV>(ResolveCoreFunction(480))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3x2fv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3X2FV>(ResolveCoreFunction(481))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3x4dv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3X4DV>(ResolveCoreFunction(482))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix3x4fv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX3X4FV>(ResolveCoreFunction(483))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4dv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4DV>(ResolveCoreFunction(484))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4fv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4FV>(ResolveCoreFunction(485))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4x2dv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4X2DV>(ResolveCoreFunction(486))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4x2fv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4X2FV>(ResolveCoreFunction(487))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4x3dv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLdouble *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4X3DV>(ResolveCoreFunction(488))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ProgramUniformMatrix4x3fv(GLuint a0, GLint a1, GLsizei a2, GLboolean a3, const GLfloat *a4)
+	{
+		return reinterpret_cast<PFNPROGRAMUNIFORMMATRIX4X3FV>(ResolveCoreFunction(489))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ReleaseShaderCompiler()
+	{
+		return reinterpret_cast<PFNRELEASESHADERCOMPILER>(ResolveCoreFunction(490))();
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ScissorArrayv(GLuint a0, GLsizei a1, const GLint *a2)
+	{
+		return reinterpret_cast<PFNSCISSORARRAYV>(ResolveCoreFunction(491))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ScissorIndexed(GLuint a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4)
+	{
+		return reinterpret_cast<PFNSCISSORINDEXED>(ResolveCoreFunction(492))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ScissorIndexedv(GLuint a0, const GLint *a1)
+	{
+		return reinterpret_cast<PFNSCISSORINDEXEDV>(ResolveCoreFunction(493))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ShaderBinary(GLsizei a0, const GLuint *a1, GLenum a2, const GLvoid *a3, GLsizei a4)
+	{
+		return reinterpret_cast<PFNSHADERBINARY>(ResolveCoreFunction(494))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_UseProgramStages(GLuint a0, GLbitfield a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNUSEPROGRAMSTAGES>(ResolveCoreFunction(495))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ValidateProgramPipeline(GLuint a0)
+	{
+		return reinterpret_cast<PFNVALIDATEPROGRAMPIPELINE>(ResolveCoreFunction(496))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL1d(GLuint a0, GLdouble a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBL1D>(ResolveCoreFunction(497))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL1dv(GLuint a0, const GLdouble *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBL1DV>(ResolveCoreFunction(498))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL2d(GLuint a0, GLdouble a1, GLdouble a2)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBL2D>(ResolveCoreFunction(499))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL2dv(GLuint a0, const GLdouble *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBL2DV>(ResolveCoreFunction(500))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL3d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBL3D>(ResolveCoreFunction(501))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL3dv(GLuint a0, const GLdouble *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBL3DV>(ResolveCoreFunction(502))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL4d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBL4D>(ResolveCoreFunction(503))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribL4dv(GLuint a0, const GLdouble *a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBL4DV>(ResolveCoreFunction(504))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribLPointer(GLuint a0, GLint a1, GLenum a2, GLsizei a3, const GLvoid *a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBLPOINTER>(ResolveCoreFunction(505))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ViewportArrayv(GLuint a0, GLsizei a1, const GLfloat *a2)
+	{
+		return reinterpret_cast<PFNVIEWPORTARRAYV>(ResolveCoreFunction(506))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ViewportIndexedf(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4)
+	{
+		return reinterpret_cast<PFNVIEWPORTINDEXEDF>(ResolveCoreFunction(507))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ViewportIndexedfv(GLuint a0, const GLfloat *a1)
+	{
+		return reinterpret_cast<PFNVIEWPORTINDEXEDFV>(ResolveCoreFunction(508))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindImageTexture(GLuint a0, GLuint a1, GLint a2, GLboolean a3, GLint a4, GLenum a5, GLenum a6)
+	{
+		return reinterpret_cast<PFNBINDIMAGETEXTURE>(ResolveCoreFunction(509))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawArraysInstancedBaseInstance(GLenum a0, GLint a1, GLsizei a2, GLsizei a3, GLuint a4)
+	{
+		return reinterpret_cast<PFNDRAWARRAYSINSTANCEDBASEINSTANCE>(ResolveCoreFunction(510))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstancedBaseInstance(GLenum a0, GLsizei a1, GLenum a2, const void *a3, GLsizei a4, GLuint a5)
+	{
+		return reinterpret_cast<PFNDRAWELEMENTSINSTANCEDBASEINSTANCE>(ResolveCoreFunction(511))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawElementsInstancedBaseVertexBaseInstance(GLenum a0, GLsizei a1, GLenum a2, const void *a3, GLsizei a4, GLint a5, GLuint a6)
+	{
+		return reinterpret_cast<PFNDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCE>(ResolveCoreFunction(512))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawTransformFeedbackInstanced(GLenum a0, GLuint a1, GLsizei a2)
+	{
+		return reinterpret_cast<PFNDRAWTRANSFORMFEEDBACKINSTANCED>(ResolveCoreFunction(513))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DrawTransformFeedbackStreamInstanced(GLenum a0, GLuint a1, GLuint a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNDRAWTRANSFORMFEEDBACKSTREAMINSTANCED>(ResolveCoreFunction(514))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetActiveAtomicCounterBufferiv(GLuint a0, GLuint a1, GLenum a2, GLint *a3)
+	{
+		return reinterpret_cast<PFNGETACTIVEATOMICCOUNTERBUFFERIV>(ResolveCoreFunction(515))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetInternalformati64v(GLenum a0, GLenum a1, GLenum a2, GLsizei a3, GLint64 *a4)
+	{
+		return reinterpret_cast<PFNGETINTERNALFORMATI64V>(ResolveCoreFunction(516))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MemoryBarrier(GLbitfield a0)
+	{
+		return reinterpret_cast<PFNMEMORYBARRIER>(ResolveCoreFunction(517))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexStorage1D(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNTEXSTORAGE1D>(ResolveCoreFunction(518))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexStorage2D(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4)
+	{
+		return reinterpret_cast<PFNTEXSTORAGE2D>(ResolveCoreFunction(519))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexStorage3D(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5)
+	{
+		return reinterpret_cast<PFNTEXSTORAGE3D>(ResolveCoreFunction(520))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_BindVertexBuffer(GLuint a0, GLuint a1, GLintptr a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNBINDVERTEXBUFFER>(ResolveCoreFunction(521))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearBufferData(GLenum a0, GLenum a1, GLenum a2, GLenum a3, const void *a4)
+	{
+		return reinterpret_cast<PFNCLEARBUFFERDATA>(ResolveCoreFunction(522))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ClearBufferSubData(GLenum a0, GLenum a1, GLintptr a2, GLsizeiptr a3, GLenum a4, GLenum a5, const void *a6)
+	{
+		return reinterpret_cast<PFNCLEARBUFFERSUBDATA>(ResolveCoreFunction(523))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_CopyImageSubData(GLuint a0, GLenum a1, GLint a2, GLint a3, GLint a4, GLint a5, GLuint a6, GLenum a7, GLint a8, GLint a9, GLint a10, GLint a11, GLsizei a12, GLsizei a13, GLsizei a14)
+	{
+		return reinterpret_cast<PFNCOPYIMAGESUBDATA>(ResolveCoreFunction(524))(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DebugMessageCallback(GLDEBUGPROC a0, const void *a1)
+	{
+		return reinterpret_cast<PFNDEBUGMESSAGECALLBACK>(ResolveCoreFunction(525))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DebugMessageControl(GLenum a0, GLenum a1, GLenum a2, GLsizei a3, const GLuint *a4, GLboolean a5)
+	{
+		return reinterpret_cast<PFNDEBUGMESSAGECONTROL>(ResolveCoreFunction(526))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DebugMessageInsert(GLenum a0, GLenum a1, GLuint a2, GLenum a3, GLsizei a4, const GLchar *a5)
+	{
+		return reinterpret_cast<PFNDEBUGMESSAGEINSERT>(ResolveCoreFunction(527))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DispatchCompute(GLuint a0, GLuint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNDISPATCHCOMPUTE>(ResolveCoreFunction(528))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_DispatchComputeIndirect(GLintptr a0)
+	{
+		return reinterpret_cast<PFNDISPATCHCOMPUTEINDIRECT>(ResolveCoreFunction(529))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_FramebufferParameteri(GLenum a0, GLenum a1, GLint a2)
+	{
+		return reinterpret_cast<PFNFRAMEBUFFERPARAMETERI>(ResolveCoreFunction(530))(a0, a1, a2);
+	}
+	
+	static GLuint CODEGEN_FUNCPTR Switch_GetDebugMessageLog(GLuint a0, GLsizei a1, GLenum *a2, GLenum *a3, GLuint *a4, GLenum *a5, GLsizei *a6, GLchar *a7)
+	{
+		return reinterpret_cast<PFNGETDEBUGMESSAGELOG>(ResolveCoreFunction(531))(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetFramebufferParameteriv(GLenum a0, GLenum a1, GLint *a2)
+	{
+		return reinterpret_cast<PFNGETFRAMEBUFFERPARAMETERIV>(ResolveCoreFunction(532))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetObjectLabel(GLenum a0, GLuint a1, GLsizei a2, GLsizei *a3, GLchar *a4)
+	{
+		return reinterpret_cast<PFNGETOBJECTLABEL>(ResolveCoreFunction(533))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetObjectPtrLabel(const void *a0, GLsizei a1, GLsizei *a2, GLchar *a3)
+	{
+		return reinterpret_cast<PFNGETOBJECTPTRLABEL>(ResolveCoreFunction(534))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetProgramInterfaceiv(GLuint a0, GLenum a1, GLenum a2, GLint *a3)
+	{
+		return reinterpret_cast<PFNGETPROGRAMINTERFACEIV>(ResolveCoreFunction(535))(a0, a1, a2, a3);
+	}
+	
+	static GLuint CODEGEN_FUNCPTR Switch_GetProgramResourceIndex(GLuint a0, GLenum a1, const GLchar *a2)
+	{
+		return reinterpret_cast<PFNGETPROGRAMRESOURCEINDEX>(ResolveCoreFunction(536))(a0, a1, a2);
+	}
+	
+	static GLint CODEGEN_FUNCPTR Switch_GetProgramResourceLocation(GLuint a0, GLenum a1, const GLchar *a2)
+	{
+		return reinterpret_cast<PFNGETPROGRAMRESOURCELOCATION>(ResolveCoreFunction(537))(a0, a1, a2);
+	}
+	
+	static GLint CODEGEN_FUNCPTR Switch_GetProgramResourceLocationIndex(GLuint a0, GLenum a1, const GLchar *a2)
+	{
+		return reinterpret_cast<PFNGETPROGRAMRESOURCELOCATIONINDEX>(ResolveCoreFunction(538))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetProgramResourceName(GLuint a0, GLenum a1, GLuint a2, GLsizei a3, GLsizei *a4, GLchar *a5)
+	{
+		return reinterpret_cast<PFNGETPROGRAMRESOURCENAME>(ResolveCoreFunction(539))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_GetProgramResourceiv(GLuint a0, GLenum a1, GLuint a2, GLsizei a3, const GLenum *a4, GLsizei a5, GLsizei *a6, GLint *a7)
+	{
+		return reinterpret_cast<PFNGETPROGRAMRESOURCEIV>(ResolveCoreFunction(540))(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_InvalidateBufferData(GLuint a0)
+	{
+		return reinterpret_cast<PFNINVALIDATEBUFFERDATA>(ResolveCoreFunction(541))(a0);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_InvalidateBufferSubData(GLuint a0, GLintptr a1, GLsizeiptr a2)
+	{
+		return reinterpret_cast<PFNINVALIDATEBUFFERSUBDATA>(ResolveCoreFunction(542))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_InvalidateFramebuffer(GLenum a0, GLsizei a1, const GLenum *a2)
+	{
+		return reinterpret_cast<PFNINVALIDATEFRAMEBUFFER>(ResolveCoreFunction(543))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_InvalidateSubFramebuffer(GLenum a0, GLsizei a1, const GLenum *a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6)
+	{
+		return reinterpret_cast<PFNINVALIDATESUBFRAMEBUFFER>(ResolveCoreFunction(544))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_InvalidateTexImage(GLuint a0, GLint a1)
+	{
+		return reinterpret_cast<PFNINVALIDATETEXIMAGE>(ResolveCoreFunction(545))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_InvalidateTexSubImage(GLuint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7)
+	{
+		return reinterpret_cast<PFNINVALIDATETEXSUBIMAGE>(ResolveCoreFunction(546))(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiDrawArraysIndirect(GLenum a0, const void *a1, GLsizei a2, GLsizei a3)
+	{
+		return reinterpret_cast<PFNMULTIDRAWARRAYSINDIRECT>(ResolveCoreFunction(547))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_MultiDrawElementsIndirect(GLenum a0, GLenum a1, const void *a2, GLsizei a3, GLsizei a4)
+	{
+		return reinterpret_cast<PFNMULTIDRAWELEMENTSINDIRECT>(ResolveCoreFunction(548))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ObjectLabel(GLenum a0, GLuint a1, GLsizei a2, const GLchar *a3)
+	{
+		return reinterpret_cast<PFNOBJECTLABEL>(ResolveCoreFunction(549))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ObjectPtrLabel(const void *a0, GLsizei a1, const GLchar *a2)
+	{
+		return reinterpret_cast<PFNOBJECTPTRLABEL>(ResolveCoreFunction(550))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PopDebugGroup()
+	{
+		return reinterpret_cast<PFNPOPDEBUGGROUP>(ResolveCoreFunction(551))();
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_PushDebugGroup(GLenum a0, GLuint a1, GLsizei a2, const GLchar *a3)
+	{
+		return reinterpret_cast<PFNPUSHDEBUGGROUP>(ResolveCoreFunction(552))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_ShaderStorageBlockBinding(GLuint a0, GLuint a1, GLuint a2)
+	{
+		return reinterpret_cast<PFNSHADERSTORAGEBLOCKBINDING>(ResolveCoreFunction(553))(a0, a1, a2);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexBufferRange(GLenum a0, GLenum a1, GLuint a2, GLintptr a3, GLsizeiptr a4)
+	{
+		return reinterpret_cast<PFNTEXBUFFERRANGE>(ResolveCoreFunction(554))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexStorage2DMultisample(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLboolean a5)
+	{
+		return reinterpret_cast<PFNTEXSTORAGE2DMULTISAMPLE>(ResolveCoreFunction(555))(a0, a1, a2, a3, a4, a5);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TexStorage3DMultisample(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLboolean a6)
+	{
+		return reinterpret_cast<PFNTEXSTORAGE3DMULTISAMPLE>(ResolveCoreFunction(556))(a0, a1, a2, a3, a4, a5, a6);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_TextureView(GLuint a0, GLenum a1, GLuint a2, GLenum a3, GLuint a4, GLuint a5, GLuint a6, GLuint a7)
+	{
+		return reinterpret_cast<PFNTEXTUREVIEW>(ResolveCoreFunction(557))(a0, a1, a2, a3, a4, a5, a6, a7);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribBinding(GLuint a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBBINDING>(ResolveCoreFunction(558))(a0, a1);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribFormat(GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLuint a4)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBFORMAT>(ResolveCoreFunction(559))(a0, a1, a2, a3, a4);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribIFormat(GLuint a0, GLint a1, GLenum a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBIFORMAT>(ResolveCoreFunction(560))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexAttribLFormat(GLuint a0, GLint a1, GLenum a2, GLuint a3)
+	{
+		return reinterpret_cast<PFNVERTEXATTRIBLFORMAT>(ResolveCoreFunction(561))(a0, a1, a2, a3);
+	}
+	
+	static void CODEGEN_FUNCPTR Switch_VertexBindingDivisor(GLuint a0, GLuint a1)
+	{
+		return reinterpret_cast<PFNVERTEXBINDINGDIVISOR>(ResolveCoreFunction(562))(a0, a1);
+	}
+	
+	struct CoreEntry
+	{
+		const char *name;
+		PFNGENERIC *slot;
+		PFNGENERIC trampoline;
+	};
+	
+	static const CoreEntry s_coreEntries[] = {
+		{"glBlendFunc", reinterpret_cast<PFNGENERIC *>(&BlendFunc), reinterpret_cast<PFNGENERIC>(Switch_BlendFunc)},
+		{"glClear", reinterpret_cast<PFNGENERIC *>(&Clear), reinterpret_cast<PFNGENERIC>(Switch_Clear)},
+		{"glClearColor", reinterpret_cast<PFNGENERIC *>(&ClearColor), reinterpret_cast<PFNGENERIC>(Switch_ClearColor)},
+		{"glClearDepth", reinterpret_cast<PFNGENERIC *>(&ClearDepth), reinterpret_cast<PFNGENERIC>(Switch_ClearDepth)},
+		{"glClearStencil", reinterpret_cast<PFNGENERIC *>(&ClearStencil), reinterpret_cast<PFNGENERIC>(Switch_ClearStencil)},
+		{"glColorMask", reinterpret_cast<PFNGENERIC *>(&ColorMask), reinterpret_cast<PFNGENERIC>(Switch_ColorMask)},
+		{"glCullFace", reinterpret_cast<PFNGENERIC *>(&CullFace), reinterpret_cast<PFNGENERIC>(Switch_CullFace)},
+		{"glDepthFunc", reinterpret_cast<PFNGENERIC *>(&DepthFunc), reinterpret_cast<PFNGENERIC>(Switch_DepthFunc)},
+		{"glDepthMask", reinterpret_cast<PFNGENERIC *>(&DepthMask), reinterpret_cast<PFNGENERIC>(Switch_DepthMask)},
+		{"glDepthRange", reinterpret_cast<PFNGENERIC *>(&DepthRange), reinterpret_cast<PFNGENERIC>(Switch_DepthRange)},
+		{"glDisable", reinterpret_cast<PFNGENERIC *>(&Disable), reinterpret_cast<PFNGENERIC>(Switch_Disable)},
+		{"glDrawBuffer", reinterpret_cast<PFNGENERIC *>(&DrawBuffer), reinterpret_cast<PFNGENERIC>(Switch_DrawBuffer)},
+		{"glEnable", reinterpret_cast<PFNGENERIC *>(&Enable), reinterpret_cast<PFNGENERIC>(Switch_Enable)},
+		{"glFinish", reinterpret_cast<PFNGENERIC *>(&Finish), reinterpret_cast<PFNGENERIC>(Switch_Finish)},
+		{"glFlush", reinterpret_cast<PFNGENERIC *>(&Flush), reinterpret_cast<PFNGENERIC>(Switch_Flush)},
+		{"glFrontFace", reinterpret_cast<PFNGENERIC *>(&FrontFace), reinterpret_cast<PFNGENERIC>(Switch_FrontFace)},
+		{"glGetBooleanv", reinterpret_cast<PFNGENERIC *>(&GetBooleanv), reinterpret_cast<PFNGENERIC>(Switch_GetBooleanv)},
+		{"glGetDoublev", reinterpret_cast<PFNGENERIC *>(&GetDoublev), reinterpret_cast<PFNGENERIC>(Switch_GetDoublev)},
+		{"glGetError", reinterpret_cast<PFNGENERIC *>(&GetError), reinterpret_cast<PFNGENERIC>(Switch_GetError)},
+		{"glGetFloatv", reinterpret_cast<PFNGENERIC *>(&GetFloatv), reinterpret_cast<PFNGENERIC>(Switch_GetFloatv)},
+		{"glGetIntegerv", reinterpret_cast<PFNGENERIC *>(&GetIntegerv), reinterpret_cast<PFNGENERIC>(Switch_GetIntegerv)},
+		{"glGetString", reinterpret_cast<PFNGENERIC *>(&GetString), reinterpret_cast<PFNGENERIC>(Switch_GetString)},
+		{"glGetTexImage", reinterpret_cast<PFNGENERIC *>(&GetTexImage), reinterpret_cast<PFNGENERIC>(Switch_GetTexImage)},
+		{"glGetTexLevelParameterfv", reinterpret_cast<PFNGENERIC *>(&GetTexLevelParameterfv), reinterpret_cast<PFNGENERIC>(Switch_GetTexLevelParameterfv)},
+		{"glGetTexLevelParameteriv", reinterpret_cast<PFNGENERIC *>(&GetTexLevelParameteriv), reinterpret_cast<PFNGENERIC>(Switch_GetTexLevelParameteriv)},
+		{"glGetTexParameterfv", reinterpret_cast<PFNGENERIC *>(&GetTexParameterfv), reinterpret_cast<PFNGENERIC>(Switch_GetTexParameterfv)},
+		{"glGetTexParameteriv", reinterpret_cast<PFNGENERIC *>(&GetTexParameteriv), reinterpret_cast<PFNGENERIC>(Switch_GetTexParameteriv)},
+		{"glHint", reinterpret_cast<PFNGENERIC *>(&Hint), reinterpret_cast<PFNGENERIC>(Switch_Hint)},
+		{"glIsEnabled", reinterpret_cast<PFNGENERIC *>(&IsEnabled), reinterpret_cast<PFNGENERIC>(Switch_IsEnabled)},
+		{"glLineWidth", reinterpret_cast<PFNGENERIC *>(&LineWidth), reinterpret_cast<PFNGENERIC>(Switch_LineWidth)},
+		{"glLogicOp", reinterpret_cast<PFNGENERIC *>(&LogicOp), reinterpret_cast<PFNGENERIC>(Switch_LogicOp)},
+		{"glPixelStoref", reinterpret_cast<PFNGENERIC *>(&PixelStoref), reinterpret_cast<PFNGENERIC>(Switch_PixelStoref)},
+		{"glPixelStorei", reinterpret_cast<PFNGENERIC *>(&PixelStorei), reinterpret_cast<PFNGENERIC>(Switch_PixelStorei)},
+		{"glPointSize", reinterpret_cast<PFNGENERIC *>(&PointSize), reinterpret_cast<PFNGENERIC>(Switch_PointSize)},
+		{"glPolygonMode", reinterpret_cast<PFNGENERIC *>(&PolygonMode), reinterpret_cast<PFNGENERIC>(Switch_PolygonMode)},
+		{"glReadBuffer", reinterpret_cast<PFNGENERIC *>(&ReadBuffer), reinterpret_cast<PFNGENERIC>(Switch_ReadBuffer)},
+		{"glReadPixels", reinterpret_cast<PFNGENERIC *>(&ReadPixels), reinterpret_cast<PFNGENERIC>(Switch_ReadPixels)},
+		{"glScissor", reinterpret_cast<PFNGENERIC *>(&Scissor), reinterpret_cast<PFNGENERIC>(Switch_Scissor)},
+		{"glStencilFunc", reinterpret_cast<PFNGENERIC *>(&StencilFunc), reinterpret_cast<PFNGENERIC>(Switch_StencilFunc)},
+		{"glStencilMask", reinterpret_cast<PFNGENERIC *>(&StencilMask), reinterpret_cast<PFNGENERIC>(Switch_StencilMask)},
+		{"glStencilOp", reinterpret_cast<PFNGENERIC *>(&StencilOp), reinterpret_cast<PFNGENERIC>(Switch_StencilOp)},
+		{"glTexImage1D", reinterpret_cast<PFNGENERIC *>(&TexImage1D), reinterpret_cast<PFNGENERIC>(Switch_TexImage1D)},
+		{"glTexImage2D", reinterpret_cast<PFNGENERIC *>(&TexImage2D), reinterpret_cast<PFNGENERIC>(Switch_TexImage2D)},
+		{"glTexParameterf", reinterpret_cast<PFNGENERIC *>(&TexParameterf), reinterpret_cast<PFNGENERIC>(Switch_TexParameterf)},
+		{"glTexParameterfv", reinterpret_cast<PFNGENERIC *>(&TexParameterfv), reinterpret_cast<PFNGENERIC>(Switch_TexParameterfv)},
+		{"glTexParameteri", reinterpret_cast<PFNGENERIC *>(&TexParameteri), reinterpret_cast<PFNGENERIC>(Switch_TexParameteri)},
+		{"glTexParameteriv", reinterpret_cast<PFNGENERIC *>(&TexParameteriv), reinterpret_cast<PFNGENERIC>(Switch_TexParameteriv)},
+		{"glViewport", reinterpret_cast<PFNGENERIC *>(&Viewport), reinterpret_cast<PFNGENERIC>(Switch_Viewport)},
+		{"glBindTexture", reinterpret_cast<PFNGENERIC *>(&BindTexture), reinterpret_cast<PFNGENERIC>(Switch_BindTexture)},
+		{"glCopyTexImage1D", reinterpret_cast<PFNGENERIC *>(&CopyTexImage1D), reinterpret_cast<PFNGENERIC>(Switch_CopyTexImage1D)},
+		{"glCopyTexImage2D", reinterpret_cast<PFNGENERIC *>(&CopyTexImage2D), reinterpret_cast<PFNGENERIC>(Switch_CopyTexImage2D)},
+		{"glCopyTexSubImage1D", reinterpret_cast<PFNGENERIC *>(&CopyTexSubImage1D), reinterpret_cast<PFNGENERIC>(Switch_CopyTexSubImage1D)},
+		{"glCopyTexSubImage2D", reinterpret_cast<PFNGENERIC *>(&CopyTexSubImage2D), reinterpret_cast<PFNGENERIC>(Switch_CopyTexSubImage2D)},
+		{"glDeleteTextures", reinterpret_cast<PFNGENERIC *>(&DeleteTextures), reinterpret_cast<PFNGENERIC>(Switch_DeleteTextures)},
+		{"glDrawArrays", reinterpret_cast<PFNGENERIC *>(&DrawArrays), reinterpret_cast<PFNGENERIC>(Switch_DrawArrays)},
+		{"glDrawElements", reinterpret_cast<PFNGENERIC *>(&DrawElements), reinterpret_cast<PFNGENERIC>(Switch_DrawElements)},
+		{"glGenTextures", reinterpret_cast<PFNGENERIC *>(&GenTextures), reinterpret_cast<PFNGENERIC>(Switch_GenTextures)},
+		{"glGetPointerv", reinterpret_cast<PFNGENERIC *>(&GetPointerv), reinterpret_cast<PFNGENERIC>(Switch_GetPointerv)},
+		{"glIsTexture", reinterpret_cast<PFNGENERIC *>(&IsTexture), reinterpret_cast<PFNGENERIC>(Switch_IsTexture)},
+		{"glPolygonOffset", reinterpret_cast<PFNGENERIC *>(&PolygonOffset), reinterpret_cast<PFNGENERIC>(Switch_PolygonOffset)},
+		{"glTexSubImage1D", reinterpret_cast<PFNGENERIC *>(&TexSubImage1D), reinterpret_cast<PFNGENERIC>(Switch_TexSubImage1D)},
+		{"glTexSubImage2D", reinterpret_cast<PFNGENERIC *>(&TexSubImage2D), reinterpret_cast<PFNGENERIC>(Switch_TexSubImage2D)},
+		{"glBlendColor", reinterpret_cast<PFNGENERIC *>(&BlendColor), reinterpret_cast<PFNGENERIC>(Switch_BlendColor)},
+		{"glBlendEquation", reinterpret_cast<PFNGENERIC *>(&BlendEquation), reinterpret_cast<PFNGENERIC>(Switch_BlendEquation)},
+		{"glCopyTexSubImage3D", reinterpret_cast<PFNGENERIC *>(&CopyTexSubImage3D), reinterpret_cast<PFNGENERIC>(Switch_CopyTexSubImage3D)},
+		{"glDrawRangeElements", reinterpret_cast<PFNGENERIC *>(&DrawRangeElements), reinterpret_cast<PFNGENERIC>(Switch_DrawRangeElements)},
+		{"glTexImage3D", reinterpret_cast<PFNGENERIC *>(&TexImage3D), reinterpret_cast<PFNGENERIC>(Switch_TexImage3D)},
+		{"glTexSubImage3D", reinterpret_cast<PFNGENERIC *>(&TexSubImage3D), reinterpret_cast<PFNGENERIC>(Switch_TexSubImage3D)},
+		{"glActiveTexture", reinterpret_cast<PFNGENERIC *>(&ActiveTexture), reinterpret_cast<PFNGENERIC>(Switch_ActiveTexture)},
+		{"glCompressedTexImage1D", reinterpret_cast<PFNGENERIC *>(&CompressedTexImage1D), reinterpret_cast<PFNGENERIC>(Switch_CompressedTexImage1D)},
+		{"glCompressedTexImage2D", reinterpret_cast<PFNGENERIC *>(&CompressedTexImage2D), reinterpret_cast<PFNGENERIC>(Switch_CompressedTexImage2D)},
+		{"glCompressedTexImage3D", reinterpret_cast<PFNGENERIC *>(&CompressedTexImage3D), reinterpret_cast<PFNGENERIC>(Switch_CompressedTexImage3D)},
+		{"glCompressedTexSubImage1D", reinterpret_cast<PFNGENERIC *>(&CompressedTexSubImage1D), reinterpret_cast<PFNGENERIC>(Switch_CompressedTexSubImage1D)},
+		{"glCompressedTexSubImage2D", reinterpret_cast<PFNGENERIC *>(&CompressedTexSubImage2D), reinterpret_cast<PFNGENERIC>(Switch_CompressedTexSubImage2D)},
+		{"glCompressedTexSubImage3D", reinterpret_cast<PFNGENERIC *>(&CompressedTexSubImage3D), reinterpret_cast<PFNGENERIC>(Switch_CompressedTexSubImage3D)},
+		{"glGetCompressedTexImage", reinterpret_cast<PFNGENERIC *>(&GetCompressedTexImage), reinterpret_cast<PFNGENERIC>(Switch_GetCompressedTexImage)},
+		{"glSampleCoverage", reinterpret_cast<PFNGENERIC *>(&SampleCoverage), reinterpret_cast<PFNGENERIC>(Switch_SampleCoverage)},
+		{"glBlendFuncSeparate", reinterpret_cast<PFNGENERIC *>(&BlendFuncSeparate), reinterpret_cast<PFNGENERIC>(Switch_BlendFuncSeparate)},
+		{"glMultiDrawArrays", reinterpret_cast<PFNGENERIC *>(&MultiDrawArrays), reinterpret_cast<PFNGENERIC>(Switch_MultiDrawArrays)},
+		{"glMultiDrawElements", reinterpret_cast<PFNGENERIC *>(&MultiDrawElements), reinterpret_cast<PFNGENERIC>(Switch_MultiDrawElements)},
+		{"glPointParameterf", reinterpret_cast<PFNGENERIC *>(&PointParameterf), reinterpret_cast<PFNGENERIC>(Switch_PointParameterf)},
+		{"glPointParameterfv", reinterpret_cast<PFNGENERIC *>(&PointParameterfv), reinterpret_cast<PFNGENERIC>(Switch_PointParameterfv)},
+		{"glPointParameteri", reinterpret_cast<PFNGENERIC *>(&PointParameteri), reinterpret_cast<PFNGENERIC>(Switch_PointParameteri)},
+		{"glPointParameteriv", reinterpret_cast<PFNGENERIC *>(&PointParameteriv), reinterpret_cast<PFNGENERIC>(Switch_PointParameteriv)},
+		{"glBeginQuery", reinterpret_cast<PFNGENERIC *>(&BeginQuery), reinterpret_cast<PFNGENERIC>(Switch_BeginQuery)},
+		{"glBindBuffer", reinterpret_cast<PFNGENERIC *>(&BindBuffer), reinterpret_cast<PFNGENERIC>(Switch_BindBuffer)},
+		{"glBufferData", reinterpret_cast<PFNGENERIC *>(&BufferData), reinterpret_cast<PFNGENERIC>(Switch_BufferData)},
+		{"glBufferSubData", reinterpret_cast<PFNGENERIC *>(&BufferSubData), reinterpret_cast<PFNGENERIC>(Switch_BufferSubData)},
+		{"glDeleteBuffers", reinterpret_cast<PFNGENERIC *>(&DeleteBuffers), reinterpret_cast<PFNGENERIC>(Switch_DeleteBuffers)},
+		{"glDeleteQueries", reinterpret_cast<PFNGENERIC *>(&DeleteQueries), reinterpret_cast<PFNGENERIC>(Switch_DeleteQueries)},
+		{"glEndQuery", reinterpret_cast<PFNGENERIC *>(&EndQuery), reinterpret_cast<PFNGENERIC>(Switch_EndQuery)},
+		{"glGenBuffers", reinterpret_cast<PFNGENERIC *>(&GenBuffers), reinterpret_cast<PFNGENERIC>(Switch_GenBuffers)},
+		{"glGenQueries", reinterpret_cast<PFNGENERIC *>(&GenQueries), reinterpret_cast<PFNGENERIC>(Switch_GenQueries)},
+		{"glGetBufferParameteriv", reinterpret_cast<PFNGENERIC *>(&GetBufferParameteriv), reinterpret_cast<PFNGENERIC>(Switch_GetBufferParameteriv)},
+		{"glGetBufferPointerv", reinterpret_cast<PFNGENERIC *>(&GetBufferPointerv), reinterpret_cast<PFNGENERIC>(Switch_GetBufferPointerv)},
+		{"glGetBufferSubData", reinterpret_cast<PFNGENERIC *>(&GetBufferSubData), reinterpret_cast<PFNGENERIC>(Switch_GetBufferSubData)},
+		{"glGetQueryObjectiv", reinterpret_cast<PFNGENERIC *>(&GetQueryObjectiv), reinterpret_cast<PFNGENERIC>(Switch_GetQueryObjectiv)},
+		{"glGetQueryObjectuiv", reinterpret_cast<PFNGENERIC *>(&GetQueryObjectuiv), reinterpret_cast<PFNGENERIC>(Switch_GetQueryObjectuiv)},
+		{"glGetQueryiv", reinterpret_cast<PFNGENERIC *>(&GetQueryiv), reinterpret_cast<PFNGENERIC>(Switch_GetQueryiv)},
+		{"glIsBuffer", reinterpret_cast<PFNGENERIC *>(&IsBuffer), reinterpret_cast<PFNGENERIC>(Switch_IsBuffer)},
+		{"glIsQuery", reinterpret_cast<PFNGENERIC *>(&IsQuery), reinterpret_cast<PFNGENERIC>(Switch_IsQuery)},
+		{"glMapBuffer", reinterpret_cast<PFNGENERIC *>(&MapBuffer), reinterpret_cast<PFNGENERIC>(Switch_MapBuffer)},
+		{"glUnmapBuffer", reinterpret_cast<PFNGENERIC *>(&UnmapBuffer), reinterpret_cast<PFNGENERIC>(Switch_UnmapBuffer)},
+		{"glAttachShader", reinterpret_cast<PFNGENERIC *>(&AttachShader), reinterpret_cast<PFNGENERIC>(Switch_AttachShader)},
+		{"glBindAttribLocation", reinterpret_cast<PFNGENERIC *>(&BindAttribLocation), reinterpret_cast<PFNGENERIC>(Switch_BindAttribLocation)},
+		{"glBlendEquationSeparate", reinterpret_cast<PFNGENERIC *>(&BlendEquationSeparate), reinterpret_cast<PFNGENERIC>(Switch_BlendEquationSeparate)},
+		{"glCompileShader", reinterpret_cast<PFNGENERIC *>(&CompileShader), reinterpret_cast<PFNGENERIC>(Switch_CompileShader)},
+		{"glCreateProgram", reinterpret_cast<PFNGENERIC *>(&CreateProgram), reinterpret_cast<PFNGENERIC>(Switch_CreateProgram)},
+		{"glCreateShader", reinterpret_cast<PFNGENERIC *>(&CreateShader), reinterpret_cast<PFNGENERIC>(Switch_CreateShader)},
+		{"glDeleteProgram", reinterpret_cast<PFNGENERIC *>(&DeleteProgram), reinterpret_cast<PFNGENERIC>(Switch_DeleteProgram)},
+		{"glDeleteShader", reinterpret_cast<PFNGENERIC *>(&DeleteShader), reinterpret_cast<PFNGENERIC>(Switch_DeleteShader)},
+		{"glDetachShader", reinterpret_cast<PFNGENERIC *>(&DetachShader), reinterpret_cast<PFNGENERIC>(Switch_DetachShader)},
+		{"glDisableVertexAttribArray", reinterpret_cast<PFNGENERIC *>(&DisableVertexAttribArray), reinterpret_cast<PFNGENERIC>(Switch_DisableVertexAttribArray)},
+		{"glDrawBuffers", reinterpret_cast<PFNGENERIC *>(&DrawBuffers), reinterpret_cast<PFNGENERIC>(Switch_DrawBuffers)},
+		{"glEnableVertexAttribArray", reinterpret_cast<PFNGENERIC *>(&EnableVertexAttribArray), reinterpret_cast<PFNGENERIC>(Switch_EnableVertexAttribArray)},
+		{"glGetActiveAttrib", reinterpret_cast<PFNGENERIC *>(&GetActiveAttrib), reinterpret_cast<PFNGENERIC>(Switch_GetActiveAttrib)},
+		{"glGetActiveUniform", reinterpret_cast<PFNGENERIC *>(&GetActiveUniform), reinterpret_cast<PFNGENERIC>(Switch_GetActiveUniform)},
+		{"glGetAttachedShaders", reinterpret_cast<PFNGENERIC *>(&GetAttachedShaders), reinterpret_cast<PFNGENERIC>(Switch_GetAttachedShaders)},
+		{"glGetAttribLocation", reinterpret_cast<PFNGENERIC *>(&GetAttribLocation), reinterpret_cast<PFNGENERIC>(Switch_GetAttribLocation)},
+		{"glGetProgramInfoLog", reinterpret_cast<PFNGENERIC *>(&GetProgramInfoLog), reinterpret_cast<PFNGENERIC>(Switch_GetProgramInfoLog)},
+		{"glGetProgramiv", reinterpret_cast<PFNGENERIC *>(&GetProgramiv), reinterpret_cast<PFNGENERIC>(Switch_GetProgramiv)},
+		{"glGetShaderInfoLog", reinterpret_cast<PFNGENERIC *>(&GetShaderInfoLog), reinterpret_cast<PFNGENERIC>(Switch_GetShaderInfoLog)},
+		{"glGetShaderSource", reinterpret_cast<PFNGENERIC *>(&GetShaderSource), reinterpret_cast<PFNGENERIC>(Switch_GetShaderSource)},
+		{"glGetShaderiv", reinterpret_cast<PFNGENERIC *>(&GetShaderiv), reinterpret_cast<PFNGENERIC>(Switch_GetShaderiv)},
+		{"glGetUniformLocation", reinterpret_cast<PFNGENERIC *>(&GetUniformLocation), reinterpret_cast<PFNGENERIC>(Switch_GetUniformLocation)},
+		{"glGetUniformfv", reinterpret_cast<PFNGENERIC *>(&GetUniformfv), reinterpret_cast<PFNGENERIC>(Switch_GetUniformfv)},
+		{"glGetUniformiv", reinterpret_cast<PFNGENERIC *>(&GetUniformiv), reinterpret_cast<PFNGENERIC>(Switch_GetUniformiv)},
+		{"glGetVertexAttribPointerv", reinterpret_cast<PFNGENERIC *>(&GetVertexAttribPointerv), reinterpret_cast<PFNGENERIC>(Switch_GetVertexAttribPointerv)},
+		{"glGetVertexAttribdv", reinterpret_cast<PFNGENERIC *>(&GetVertexAttribdv), reinterpret_cast<PFNGENERIC>(Switch_GetVertexAttribdv)},
+		{"glGetVertexAttribfv", reinterpret_cast<PFNGENERIC *>(&GetVertexAttribfv), reinterpret_cast<PFNGENERIC>(Switch_GetVertexAttribfv)},
+		{"glGetVertexAttribiv", reinterpret_cast<PFNGENERIC *>(&GetVertexAttribiv), reinterpret_cast<PFNGENERIC>(Switch_GetVertexAttribiv)},
+		{"glIsProgram", reinterpret_cast<PFNGENERIC *>(&IsProgram), reinterpret_cast<PFNGENERIC>(Switch_IsProgram)},
+		{"glIsShader", reinterpret_cast<PFNGENERIC *>(&IsShader), reinterpret_cast<PFNGENERIC>(Switch_IsShader)},
+		{"glLinkProgram", reinterpret_cast<PFNGENERIC *>(&LinkProgram), reinterpret_cast<PFNGENERIC>(Switch_LinkProgram)},
+		{"glShaderSource", reinterpret_cast<PFNGENERIC *>(&ShaderSource), reinterpret_cast<PFNGENERIC>(Switch_ShaderSource)},
+		{"glStencilFuncSeparate", reinterpret_cast<PFNGENERIC *>(&StencilFuncSeparate), reinterpret_cast<PFNGENERIC>(Switch_StencilFuncSeparate)},
+		{"glStencilMaskSeparate", reinterpret_cast<PFNGENERIC *>(&StencilMaskSeparate), reinterpret_cast<PFNGENERIC>(Switch_StencilMaskSeparate)},
+		{"glStencilOpSeparate", reinterpret_cast<PFNGENERIC *>(&StencilOpSeparate), reinterpret_cast<PFNGENERIC>(Switch_StencilOpSeparate)},
+		{"glUniform1f", reinterpret_cast<PFNGENERIC *>(&Uniform1f), reinterpret_cast<PFNGENERIC>(Switch_Uniform1f)},
+		{"glUniform1fv", reinterpret_cast<PFNGENERIC *>(&Uniform1fv), reinterpret_cast<PFNGENERIC>(Switch_Uniform1fv)},
+		{"glUniform1i", reinterpret_cast<PFNGENERIC *>(&Uniform1i), reinterpret_cast<PFNGENERIC>(Switch_Uniform1i)},
+		{"glUniform1iv", reinterpret_cast<PFNGENERIC *>(&Uniform1iv), reinterpret_cast<PFNGENERIC>(Switch_Uniform1iv)},
+		{"glUniform2f", reinterpret_cast<PFNGENERIC *>(&Uniform2f), reinterpret_cast<PFNGENERIC>(Switch_Uniform2f)},
+		{"glUniform2fv", reinterpret_cast<PFNGENERIC *>(&Uniform2fv), reinterpret_cast<PFNGENERIC>(Switch_Uniform2fv)},
+		{"glUniform2i", reinterpret_cast<PFNGENERIC *>(&Uniform2i), reinterpret_cast<PFNGENERIC>(Switch_Uniform2i)},
+		{"glUniform2iv", reinterpret_cast<PFNGENERIC *>(&Uniform2iv), reinterpret_cast<PFNGENERIC>(Switch_Uniform2iv)},
+		{"glUniform3f", reinterpret_cast<PFNGENERIC *>(&Uniform3f), reinterpret_cast<PFNGENERIC>(Switch_Uniform3f)},
+		{"glUniform3fv", reinterpret_cast<PFNGENERIC *>(&Uniform3fv), reinterpret_cast<PFNGENERIC>(Switch_Uniform3fv)},
+		{"glUniform3i", reinterpret_cast<PFNGENERIC *>(&Uniform3i), reinterpret_cast<PFNGENERIC>(Switch_Uniform3i)},
+		{"glUniform3iv", reinterpret_cast<PFNGENERIC *>(&Uniform3iv), reinterpret_cast<PFNGENERIC>(Switch_Uniform3iv)},
+		{"glUniform4f", reinterpret_cast<PFNGENERIC *>(&Uniform4f), reinterpret_cast<PFNGENERIC>(Switch_Uniform4f)},
+		{"glUniform4fv", reinterpret_cast<PFNGENERIC *>(&Uniform4fv), reinterpret_cast<PFNGENERIC>(Switch_Uniform4fv)},
+		{"glUniform4i", reinterpret_cast<PFNGENERIC *>(&Uniform4i), reinterpret_cast<PFNGENERIC>(Switch_Uniform4i)},
+		{"glUniform4iv", reinterpret_cast<PFNGENERIC *>(&Uniform4iv), reinterpret_cast<PFNGENERIC>(Switch_Uniform4iv)},
+		{"glUniformMatrix2fv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix2fv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix2fv)},
+		{"glUniformMatrix3fv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix3fv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix3fv)},
+		{"glUniformMatrix4fv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix4fv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix4fv)},
+		{"glUseProgram", reinterpret_cast<PFNGENERIC *>(&UseProgram), reinterpret_cast<PFNGENERIC>(Switch_UseProgram)},
+		{"glValidateProgram", reinterpret_cast<PFNGENERIC *>(&ValidateProgram), reinterpret_cast<PFNGENERIC>(Switch_ValidateProgram)},
+		{"glVertexAttrib1d", reinterpret_cast<PFNGENERIC *>(&VertexAttrib1d), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib1d)},
+		{"glVertexAttrib1dv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib1dv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib1dv)},
+		{"glVertexAttrib1f", reinterpret_cast<PFNGENERIC *>(&VertexAttrib1f), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib1f)},
+		{"glVertexAttrib1fv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib1fv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib1fv)},
+		{"glVertexAttrib1s", reinterpret_cast<PFNGENERIC *>(&VertexAttrib1s), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib1s)},
+		{"glVertexAttrib1sv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib1sv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib1sv)},
+		{"glVertexAttrib2d", reinterpret_cast<PFNGENERIC *>(&VertexAttrib2d), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib2d)},
+		{"glVertexAttrib2dv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib2dv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib2dv)},
+		{"glVertexAttrib2f", reinterpret_cast<PFNGENERIC *>(&VertexAttrib2f), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib2f)},
+		{"glVertexAttrib2fv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib2fv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib2fv)},
+		{"glVertexAttrib2s", reinterpret_cast<PFNGENERIC *>(&VertexAttrib2s), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib2s)},
+		{"glVertexAttrib2sv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib2sv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib2sv)},
+		{"glVertexAttrib3d", reinterpret_cast<PFNGENERIC *>(&VertexAttrib3d), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib3d)},
+		{"glVertexAttrib3dv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib3dv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib3dv)},
+		{"glVertexAttrib3f", reinterpret_cast<PFNGENERIC *>(&VertexAttrib3f), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib3f)},
+		{"glVertexAttrib3fv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib3fv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib3fv)},
+		{"glVertexAttrib3s", reinterpret_cast<PFNGENERIC *>(&VertexAttrib3s), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib3s)},
+		{"glVertexAttrib3sv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib3sv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib3sv)},
+		{"glVertexAttrib4Nbv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4Nbv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4Nbv)},
+		{"glVertexAttrib4Niv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4Niv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4Niv)},
+		{"glVertexAttrib4Nsv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4Nsv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4Nsv)},
+		{"glVertexAttrib4Nub", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4Nub), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4Nub)},
+		{"glVertexAttrib4Nubv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4Nubv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4Nubv)},
+		{"glVertexAttrib4Nuiv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4Nuiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4Nuiv)},
+		{"glVertexAttrib4Nusv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4Nusv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4Nusv)},
+		{"glVertexAttrib4bv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4bv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4bv)},
+		{"glVertexAttrib4d", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4d), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4d)},
+		{"glVertexAttrib4dv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4dv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4dv)},
+		{"glVertexAttrib4f", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4f), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4f)},
+		{"glVertexAttrib4fv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4fv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4fv)},
+		{"glVertexAttrib4iv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4iv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4iv)},
+		{"glVertexAttrib4s", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4s), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4s)},
+		{"glVertexAttrib4sv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4sv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4sv)},
+		{"glVertexAttrib4ubv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4ubv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4ubv)},
+		{"glVertexAttrib4uiv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4uiv)},
+		{"glVertexAttrib4usv", reinterpret_cast<PFNGENERIC *>(&VertexAttrib4usv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttrib4usv)},
+		{"glVertexAttribPointer", reinterpret_cast<PFNGENERIC *>(&VertexAttribPointer), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribPointer)},
+		{"glUniformMatrix2x3fv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix2x3fv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix2x3fv)},
+		{"glUniformMatrix2x4fv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix2x4fv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix2x4fv)},
+		{"glUniformMatrix3x2fv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix3x2fv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix3x2fv)},
+		{"glUniformMatrix3x4fv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix3x4fv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix3x4fv)},
+		{"glUniformMatrix4x2fv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix4x2fv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix4x2fv)},
+		{"glUniformMatrix4x3fv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix4x3fv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix4x3fv)},
+		{"glBeginConditionalRender", reinterpret_cast<PFNGENERIC *>(&BeginConditionalRender), reinterpret_cast<PFNGENERIC>(Switch_BeginConditionalRender)},
+		{"glBeginTransformFeedback", reinterpret_cast<PFNGENERIC *>(&BeginTransformFeedback), reinterpret_cast<PFNGENERIC>(Switch_BeginTransformFeedback)},
+		{"glBindBufferBase", reinterpret_cast<PFNGENERIC *>(&BindBufferBase), reinterpret_cast<PFNGENERIC>(Switch_BindBufferBase)},
+		{"glBindBufferRange", reinterpret_cast<PFNGENERIC *>(&BindBufferRange), reinterpret_cast<PFNGENERIC>(Switch_BindBufferRange)},
+		{"glBindFragDataLocation", reinterpret_cast<PFNGENERIC *>(&BindFragDataLocation), reinterpret_cast<PFNGENERIC>(Switch_BindFragDataLocation)},
+		{"glBindFramebuffer", reinterpret_cast<PFNGENERIC *>(&BindFramebuffer), reinterpret_cast<PFNGENERIC>(Switch_BindFramebuffer)},
+		{"glBindRenderbuffer", reinterpret_cast<PFNGENERIC *>(&BindRenderbuffer), reinterpret_cast<PFNGENERIC>(Switch_BindRenderbuffer)},
+		{"glBindVertexArray", reinterpret_cast<PFNGENERIC *>(&BindVertexArray), reinterpret_cast<PFNGENERIC>(Switch_BindVertexArray)},
+		{"glBlitFramebuffer", reinterpret_cast<PFNGENERIC *>(&BlitFramebuffer), reinterpret_cast<PFNGENERIC>(Switch_BlitFramebuffer)},
+		{"glCheckFramebufferStatus", reinterpret_cast<PFNGENERIC *>(&CheckFramebufferStatus), reinterpret_cast<PFNGENERIC>(Switch_CheckFramebufferStatus)},
+		{"glClampColor", reinterpret_cast<PFNGENERIC *>(&ClampColor), reinterpret_cast<PFNGENERIC>(Switch_ClampColor)},
+		{"glClearBufferfi", reinterpret_cast<PFNGENERIC *>(&ClearBufferfi), reinterpret_cast<PFNGENERIC>(Switch_ClearBufferfi)},
+		{"glClearBufferfv", reinterpret_cast<PFNGENERIC *>(&ClearBufferfv), reinterpret_cast<PFNGENERIC>(Switch_ClearBufferfv)},
+		{"glClearBufferiv", reinterpret_cast<PFNGENERIC *>(&ClearBufferiv), reinterpret_cast<PFNGENERIC>(Switch_ClearBufferiv)},
+		{"glClearBufferuiv", reinterpret_cast<PFNGENERIC *>(&ClearBufferuiv), reinterpret_cast<PFNGENERIC>(Switch_ClearBufferuiv)},
+		{"glColorMaski", reinterpret_cast<PFNGENERIC *>(&ColorMaski), reinterpret_cast<PFNGENERIC>(Switch_ColorMaski)},
+		{"glDeleteFramebuffers", reinterpret_cast<PFNGENERIC *>(&DeleteFramebuffers), reinterpret_cast<PFNGENERIC>(Switch_DeleteFramebuffers)},
+		{"glDeleteRenderbuffers", reinterpret_cast<PFNGENERIC *>(&DeleteRenderbuffers), reinterpret_cast<PFNGENERIC>(Switch_DeleteRenderbuffers)},
+		{"glDeleteVertexArrays", reinterpret_cast<PFNGENERIC *>(&DeleteVertexArrays), reinterpret_cast<PFNGENERIC>(Switch_DeleteVertexArrays)},
+		{"glDisablei", reinterpret_cast<PFNGENERIC *>(&Disablei), reinterpret_cast<PFNGENERIC>(Switch_Disablei)},
+		{"glEnablei", reinterpret_cast<PFNGENERIC *>(&Enablei), reinterpret_cast<PFNGENERIC>(Switch_Enablei)},
+		{"glEndConditionalRender", reinterpret_cast<PFNGENERIC *>(&EndConditionalRender), reinterpret_cast<PFNGENERIC>(Switch_EndConditionalRender)},
+		{"glEndTransformFeedback", reinterpret_cast<PFNGENERIC *>(&EndTransformFeedback), reinterpret_cast<PFNGENERIC>(Switch_EndTransformFeedback)},
+		{"glFlushMappedBufferRange", reinterpret_cast<PFNGENERIC *>(&FlushMappedBufferRange), reinterpret_cast<PFNGENERIC>(Switch_FlushMappedBufferRange)},
+		{"glFramebufferRenderbuffer", reinterpret_cast<PFNGENERIC *>(&FramebufferRenderbuffer), reinterpret_cast<PFNGENERIC>(Switch_FramebufferRenderbuffer)},
+		{"glFramebufferTexture1D", reinterpret_cast<PFNGENERIC *>(&FramebufferTexture1D), reinterpret_cast<PFNGENERIC>(Switch_FramebufferTexture1D)},
+		{"glFramebufferTexture2D", reinterpret_cast<PFNGENERIC *>(&FramebufferTexture2D), reinterpret_cast<PFNGENERIC>(Switch_FramebufferTexture2D)},
+		{"glFramebufferTexture3D", reinterpret_cast<PFNGENERIC *>(&FramebufferTexture3D), reinterpret_cast<PFNGENERIC>(Switch_FramebufferTexture3D)},
+		{"glFramebufferTextureLayer", reinterpret_cast<PFNGENERIC *>(&FramebufferTextureLayer), reinterpret_cast<PFNGENERIC>(Switch_FramebufferTextureLayer)},
+		{"glGenFramebuffers", reinterpret_cast<PFNGENERIC *>(&GenFramebuffers), reinterpret_cast<PFNGENERIC>(Switch_GenFramebuffers)},
+		{"glGenRenderbuffers", reinterpret_cast<PFNGENERIC *>(&GenRenderbuffers), reinterpret_cast<PFNGENERIC>(Switch_GenRenderbuffers)},
+		{"glGenVertexArrays", reinterpret_cast<PFNGENERIC *>(&GenVertexArrays), reinterpret_cast<PFNGENERIC>(Switch_GenVertexArrays)},
+		{"glGenerateMipmap", reinterpret_cast<PFNGENERIC *>(&GenerateMipmap), reinterpret_cast<PFNGENERIC>(Switch_GenerateMipmap)},
+		{"glGetBooleani_v", reinterpret_cast<PFNGENERIC *>(&GetBooleani_v), reinterpret_cast<PFNGENERIC>(Switch_GetBooleani_v)},
+		{"glGetFragDataLocation", reinterpret_cast<PFNGENERIC *>(&GetFragDataLocation), reinterpret_cast<PFNGENERIC>(Switch_GetFragDataLocation)},
+		{"glGetFramebufferAttachmentParameteriv", reinterpret_cast<PFNGENERIC *>(&GetFramebufferAttachmentParameteriv), reinterpret_cast<PFNGENERIC>(Switch_GetFramebufferAttachmentParameteriv)},
+		{"glGetIntegeri_v", reinterpret_cast<PFNGENERIC *>(&GetIntegeri_v), reinterpret_cast<PFNGENERIC>(Switch_GetIntegeri_v)},
+		{"glGetRenderbufferParameteriv", reinterpret_cast<PFNGENERIC *>(&GetRenderbufferParameteriv), reinterpret_cast<PFNGENERIC>(Switch_GetRenderbufferParameteriv)},
+		{"glGetStringi", reinterpret_cast<PFNGENERIC *>(&GetStringi), reinterpret_cast<PFNGENERIC>(Switch_GetStringi)},
+		{"glGetTexParameterIiv", reinterpret_cast<PFNGENERIC *>(&GetTexParameterIiv), reinterpret_cast<PFNGENERIC>(Switch_GetTexParameterIiv)},
+		{"glGetTexParameterIuiv", reinterpret_cast<PFNGENERIC *>(&GetTexParameterIuiv), reinterpret_cast<PFNGENERIC>(Switch_GetTexParameterIuiv)},
+		{"glGetTransformFeedbackVarying", reinterpret_cast<PFNGENERIC *>(&GetTransformFeedbackVarying), reinterpret_cast<PFNGENERIC>(Switch_GetTransformFeedbackVarying)},
+		{"glGetUniformuiv", reinterpret_cast<PFNGENERIC *>(&GetUniformuiv), reinterpret_cast<PFNGENERIC>(Switch_GetUniformuiv)},
+		{"glGetVertexAttribIiv", reinterpret_cast<PFNGENERIC *>(&GetVertexAttribIiv), reinterpret_cast<PFNGENERIC>(Switch_GetVertexAttribIiv)},
+		{"glGetVertexAttribIuiv", reinterpret_cast<PFNGENERIC *>(&GetVertexAttribIuiv), reinterpret_cast<PFNGENERIC>(Switch_GetVertexAttribIuiv)},
+		{"glIsEnabledi", reinterpret_cast<PFNGENERIC *>(&IsEnabledi), reinterpret_cast<PFNGENERIC>(Switch_IsEnabledi)},
+		{"glIsFramebuffer", reinterpret_cast<PFNGENERIC *>(&IsFramebuffer), reinterpret_cast<PFNGENERIC>(Switch_IsFramebuffer)},
+		{"glIsRenderbuffer", reinterpret_cast<PFNGENERIC *>(&IsRenderbuffer), reinterpret_cast<PFNGENERIC>(Switch_IsRenderbuffer)},
+		{"glIsVertexArray", reinterpret_cast<PFNGENERIC *>(&IsVertexArray), reinterpret_cast<PFNGENERIC>(Switch_IsVertexArray)},
+		{"glMapBufferRange", reinterpret_cast<PFNGENERIC *>(&MapBufferRange), reinterpret_cast<PFNGENERIC>(Switch_MapBufferRange)},
+		{"glRenderbufferStorage", reinterpret_cast<PFNGENERIC *>(&RenderbufferStorage), reinterpret_cast<PFNGENERIC>(Switch_RenderbufferStorage)},
+		{"glRenderbufferStorageMultisample", reinterpret_cast<PFNGENERIC *>(&RenderbufferStorageMultisample), reinterpret_cast<PFNGENERIC>(Switch_RenderbufferStorageMultisample)},
+		{"glTexParameterIiv", reinterpret_cast<PFNGENERIC *>(&TexParameterIiv), reinterpret_cast<PFNGENERIC>(Switch_TexParameterIiv)},
+		{"glTexParameterIuiv", reinterpret_cast<PFNGENERIC *>(&TexParameterIuiv), reinterpret_cast<PFNGENERIC>(Switch_TexParameterIuiv)},
+		{"glTransformFeedbackVaryings", reinterpret_cast<PFNGENERIC *>(&TransformFeedbackVaryings), reinterpret_cast<PFNGENERIC>(Switch_TransformFeedbackVaryings)},
+		{"glUniform1ui", reinterpret_cast<PFNGENERIC *>(&Uniform1ui), reinterpret_cast<PFNGENERIC>(Switch_Uniform1ui)},
+		{"glUniform1uiv", reinterpret_cast<PFNGENERIC *>(&Uniform1uiv), reinterpret_cast<PFNGENERIC>(Switch_Uniform1uiv)},
+		{"glUniform2ui", reinterpret_cast<PFNGENERIC *>(&Uniform2ui), reinterpret_cast<PFNGENERIC>(Switch_Uniform2ui)},
+		{"glUniform2uiv", reinterpret_cast<PFNGENERIC *>(&Uniform2uiv), reinterpret_cast<PFNGENERIC>(Switch_Uniform2uiv)},
+		{"glUniform3ui", reinterpret_cast<PFNGENERIC *>(&Uniform3ui), reinterpret_cast<PFNGENERIC>(Switch_Uniform3ui)},
+		{"glUniform3uiv", reinterpret_cast<PFNGENERIC *>(&Uniform3uiv), reinterpret_cast<PFNGENERIC>(Switch_Uniform3uiv)},
+		{"glUniform4ui", reinterpret_cast<PFNGENERIC *>(&Uniform4ui), reinterpret_cast<PFNGENERIC>(Switch_Uniform4ui)},
+		{"glUniform4uiv", reinterpret_cast<PFNGENERIC *>(&Uniform4uiv), reinterpret_cast<PFNGENERIC>(Switch_Uniform4uiv)},
+		{"glVertexAttribI1i", reinterpret_cast<PFNGENERIC *>(&VertexAttribI1i), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI1i)},
+		{"glVertexAttribI1iv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI1iv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI1iv)},
+		{"glVertexAttribI1ui", reinterpret_cast<PFNGENERIC *>(&VertexAttribI1ui), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI1ui)},
+		{"glVertexAttribI1uiv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI1uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI1uiv)},
+		{"glVertexAttribI2i", reinterpret_cast<PFNGENERIC *>(&VertexAttribI2i), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI2i)},
+		{"glVertexAttribI2iv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI2iv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI2iv)},
+		{"glVertexAttribI2ui", reinterpret_cast<PFNGENERIC *>(&VertexAttribI2ui), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI2ui)},
+		{"glVertexAttribI2uiv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI2uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI2uiv)},
+		{"glVertexAttribI3i", reinterpret_cast<PFNGENERIC *>(&VertexAttribI3i), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI3i)},
+		{"glVertexAttribI3iv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI3iv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI3iv)},
+		{"glVertexAttribI3ui", reinterpret_cast<PFNGENERIC *>(&VertexAttribI3ui), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI3ui)},
+		{"glVertexAttribI3uiv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI3uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI3uiv)},
+		{"glVertexAttribI4bv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI4bv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI4bv)},
+		{"glVertexAttribI4i", reinterpret_cast<PFNGENERIC *>(&VertexAttribI4i), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI4i)},
+		{"glVertexAttribI4iv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI4iv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI4iv)},
+		{"glVertexAttribI4sv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI4sv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI4sv)},
+		{"glVertexAttribI4ubv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI4ubv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI4ubv)},
+		{"glVertexAttribI4ui", reinterpret_cast<PFNGENERIC *>(&VertexAttribI4ui), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI4ui)},
+		{"glVertexAttribI4uiv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI4uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI4uiv)},
+		{"glVertexAttribI4usv", reinterpret_cast<PFNGENERIC *>(&VertexAttribI4usv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribI4usv)},
+		{"glVertexAttribIPointer", reinterpret_cast<PFNGENERIC *>(&VertexAttribIPointer), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribIPointer)},
+		{"glCopyBufferSubData", reinterpret_cast<PFNGENERIC *>(&CopyBufferSubData), reinterpret_cast<PFNGENERIC>(Switch_CopyBufferSubData)},
+		{"glDrawArraysInstanced", reinterpret_cast<PFNGENERIC *>(&DrawArraysInstanced), reinterpret_cast<PFNGENERIC>(Switch_DrawArraysInstanced)},
+		{"glDrawElementsInstanced", reinterpret_cast<PFNGENERIC *>(&DrawElementsInstanced), reinterpret_cast<PFNGENERIC>(Switch_DrawElementsInstanced)},
+		{"glGetActiveUniformBlockName", reinterpret_cast<PFNGENERIC *>(&GetActiveUniformBlockName), reinterpret_cast<PFNGENERIC>(Switch_GetActiveUniformBlockName)},
+		{"glGetActiveUniformBlockiv", reinterpret_cast<PFNGENERIC *>(&GetActiveUniformBlockiv), reinterpret_cast<PFNGENERIC>(Switch_GetActiveUniformBlockiv)},
+		{"glGetActiveUniformName", reinterpret_cast<PFNGENERIC *>(&GetActiveUniformName), reinterpret_cast<PFNGENERIC>(Switch_GetActiveUniformName)},
+		{"glGetActiveUniformsiv", reinterpret_cast<PFNGENERIC *>(&GetActiveUniformsiv), reinterpret_cast<PFNGENERIC>(Switch_GetActiveUniformsiv)},
+		{"glGetUniformBlockIndex", reinterpret_cast<PFNGENERIC *>(&GetUniformBlockIndex), reinterpret_cast<PFNGENERIC>(Switch_GetUniformBlockIndex)},
+		{"glGetUniformIndices", reinterpret_cast<PFNGENERIC *>(&GetUniformIndices), reinterpret_cast<PFNGENERIC>(Switch_GetUniformIndices)},
+		{"glPrimitiveRestartIndex", reinterpret_cast<PFNGENERIC *>(&PrimitiveRestartIndex), reinterpret_cast<PFNGENERIC>(Switch_PrimitiveRestartIndex)},
+		{"glTexBuffer", reinterpret_cast<PFNGENERIC *>(&TexBuffer), reinterpret_cast<PFNGENERIC>(Switch_TexBuffer)},
+		{"glUniformBlockBinding", reinterpret_cast<PFNGENERIC *>(&UniformBlockBinding), reinterpret_cast<PFNGENERIC>(Switch_UniformBlockBinding)},
+		{"glClientWaitSync", reinterpret_cast<PFNGENERIC *>(&ClientWaitSync), reinterpret_cast<PFNGENERIC>(Switch_ClientWaitSync)},
+		{"glDeleteSync", reinterpret_cast<PFNGENERIC *>(&DeleteSync), reinterpret_cast<PFNGENERIC>(Switch_DeleteSync)},
+		{"glDrawElementsBaseVertex", reinterpret_cast<PFNGENERIC *>(&DrawElementsBaseVertex), reinterpret_cast<PFNGENERIC>(Switch_DrawElementsBaseVertex)},
+		{"glDrawElementsInstancedBaseVertex", reinterpret_cast<PFNGENERIC *>(&DrawElementsInstancedBaseVertex), reinterpret_cast<PFNGENERIC>(Switch_DrawElementsInstancedBaseVertex)},
+		{"glDrawRangeElementsBaseVertex", reinterpret_cast<PFNGENERIC *>(&DrawRangeElementsBaseVertex), reinterpret_cast<PFNGENERIC>(Switch_DrawRangeElementsBaseVertex)},
+		{"glFenceSync", reinterpret_cast<PFNGENERIC *>(&FenceSync), reinterpret_cast<PFNGENERIC>(Switch_FenceSync)},
+		{"glFramebufferTexture", reinterpret_cast<PFNGENERIC *>(&FramebufferTexture), reinterpret_cast<PFNGENERIC>(Switch_FramebufferTexture)},
+		{"glGetBufferParameteri64v", reinterpret_cast<PFNGENERIC *>(&GetBufferParameteri64v), reinterpret_cast<PFNGENERIC>(Switch_GetBufferParameteri64v)},
+		{"glGetInteger64i_v", reinterpret_cast<PFNGENERIC *>(&GetInteger64i_v), reinterpret_cast<PFNGENERIC>(Switch_GetInteger64i_v)},
+		{"glGetInteger64v", reinterpret_cast<PFNGENERIC *>(&GetInteger64v), reinterpret_cast<PFNGENERIC>(Switch_GetInteger64v)},
+		{"glGetMultisamplefv", reinterpret_cast<PFNGENERIC *>(&GetMultisamplefv), reinterpret_cast<PFNGENERIC>(Switch_GetMultisamplefv)},
+		{"glGetSynciv", reinterpret_cast<PFNGENERIC *>(&GetSynciv), reinterpret_cast<PFNGENERIC>(Switch_GetSynciv)},
+		{"glIsSync", reinterpret_cast<PFNGENERIC *>(&IsSync), reinterpret_cast<PFNGENERIC>(Switch_IsSync)},
+		{"glMultiDrawElementsBaseVertex", reinterpret_cast<PFNGENERIC *>(&MultiDrawElementsBaseVertex), reinterpret_cast<PFNGENERIC>(Switch_MultiDrawElementsBaseVertex)},
+		{"glProvokingVertex", reinterpret_cast<PFNGENERIC *>(&ProvokingVertex), reinterpret_cast<PFNGENERIC>(Switch_ProvokingVertex)},
+		{"glSampleMaski", reinterpret_cast<PFNGENERIC *>(&SampleMaski), reinterpret_cast<PFNGENERIC>(Switch_SampleMaski)},
+		{"glTexImage2DMultisample", reinterpret_cast<PFNGENERIC *>(&TexImage2DMultisample), reinterpret_cast<PFNGENERIC>(Switch_TexImage2DMultisample)},
+		{"glTexImage3DMultisample", reinterpret_cast<PFNGENERIC *>(&TexImage3DMultisample), reinterpret_cast<PFNGENERIC>(Switch_TexImage3DMultisample)},
+		{"glWaitSync", reinterpret_cast<PFNGENERIC *>(&WaitSync), reinterpret_cast<PFNGENERIC>(Switch_WaitSync)},
+		{"glBindFragDataLocationIndexed", reinterpret_cast<PFNGENERIC *>(&BindFragDataLocationIndexed), reinterpret_cast<PFNGENERIC>(Switch_BindFragDataLocationIndexed)},
+		{"glBindSampler", reinterpret_cast<PFNGENERIC *>(&BindSampler), reinterpret_cast<PFNGENERIC>(Switch_BindSampler)},
+		{"glColorP3ui", reinterpret_cast<PFNGENERIC *>(&ColorP3ui), reinterpret_cast<PFNGENERIC>(Switch_ColorP3ui)},
+		{"glColorP3uiv", reinterpret_cast<PFNGENERIC *>(&ColorP3uiv), reinterpret_cast<PFNGENERIC>(Switch_ColorP3uiv)},
+		{"glColorP4ui", reinterpret_cast<PFNGENERIC *>(&ColorP4ui), reinterpret_cast<PFNGENERIC>(Switch_ColorP4ui)},
+		{"glColorP4uiv", reinterpret_cast<PFNGENERIC *>(&ColorP4uiv), reinterpret_cast<PFNGENERIC>(Switch_ColorP4uiv)},
+		{"glDeleteSamplers", reinterpret_cast<PFNGENERIC *>(&DeleteSamplers), reinterpret_cast<PFNGENERIC>(Switch_DeleteSamplers)},
+		{"glGenSamplers", reinterpret_cast<PFNGENERIC *>(&GenSamplers), reinterpret_cast<PFNGENERIC>(Switch_GenSamplers)},
+		{"glGetFragDataIndex", reinterpret_cast<PFNGENERIC *>(&GetFragDataIndex), reinterpret_cast<PFNGENERIC>(Switch_GetFragDataIndex)},
+		{"glGetQueryObjecti64v", reinterpret_cast<PFNGENERIC *>(&GetQueryObjecti64v), reinterpret_cast<PFNGENERIC>(Switch_GetQueryObjecti64v)},
+		{"glGetQueryObjectui64v", reinterpret_cast<PFNGENERIC *>(&GetQueryObjectui64v), reinterpret_cast<PFNGENERIC>(Switch_GetQueryObjectui64v)},
+		{"glGetSamplerParameterIiv", reinterpret_cast<PFNGENERIC *>(&GetSamplerParameterIiv), reinterpret_cast<PFNGENERIC>(Switch_GetSamplerParameterIiv)},
+		{"glGetSamplerParameterIuiv", reinterpret_cast<PFNGENERIC *>(&GetSamplerParameterIuiv), reinterpret_cast<PFNGENERIC>(Switch_GetSamplerParameterIuiv)},
+		{"glGetSamplerParameterfv", reinterpret_cast<PFNGENERIC *>(&GetSamplerParameterfv), reinterpret_cast<PFNGENERIC>(Switch_GetSamplerParameterfv)},
+		{"glGetSamplerParameteriv", reinterpret_cast<PFNGENERIC *>(&GetSamplerParameteriv), reinterpret_cast<PFNGENERIC>(Switch_GetSamplerParameteriv)},
+		{"glIsSampler", reinterpret_cast<PFNGENERIC *>(&IsSampler), reinterpret_cast<PFNGENERIC>(Switch_IsSampler)},
+		{"glMultiTexCoordP1ui", reinterpret_cast<PFNGENERIC *>(&MultiTexCoordP1ui), reinterpret_cast<PFNGENERIC>(Switch_MultiTexCoordP1ui)},
+		{"glMultiTexCoordP1uiv", reinterpret_cast<PFNGENERIC *>(&MultiTexCoordP1uiv), reinterpret_cast<PFNGENERIC>(Switch_MultiTexCoordP1uiv)},
+		{"glMultiTexCoordP2ui", reinterpret_cast<PFNGENERIC *>(&MultiTexCoordP2ui), reinterpret_cast<PFNGENERIC>(Switch_MultiTexCoordP2ui)},
+		{"glMultiTexCoordP2uiv", reinterpret_cast<PFNGENERIC *>(&MultiTexCoordP2uiv), reinterpret_cast<PFNGENERIC>(Switch_MultiTexCoordP2uiv)},
+		{"glMultiTexCoordP3ui", reinterpret_cast<PFNGENERIC *>(&MultiTexCoordP3ui), reinterpret_cast<PFNGENERIC>(Switch_MultiTexCoordP3ui)},
+		{"glMultiTexCoordP3uiv", reinterpret_cast<PFNGENERIC *>(&MultiTexCoordP3uiv), reinterpret_cast<PFNGENERIC>(Switch_MultiTexCoordP3uiv)},
+		{"glMultiTexCoordP4ui", reinterpret_cast<PFNGENERIC *>(&MultiTexCoordP4ui), reinterpret_cast<PFNGENERIC>(Switch_MultiTexCoordP4ui)},
+		{"glMultiTexCoordP4uiv", reinterpret_cast<PFNGENERIC *>(&MultiTexCoordP4uiv), reinterpret_cast<PFNGENERIC>(Switch_MultiTexCoordP4uiv)},
+		{"glNormalP3ui", reinterpret_cast<PFNGENERIC *>(&NormalP3ui), reinterpret_cast<PFNGENERIC>(Switch_NormalP3ui)},
+		{"glNormalP3uiv", reinterpret_cast<PFNGENERIC *>(&NormalP3uiv), reinterpret_cast<PFNGENERIC>(Switch_NormalP3uiv)},
+		{"glQueryCounter", reinterpret_cast<PFNGENERIC *>(&QueryCounter), reinterpret_cast<PFNGENERIC>(Switch_QueryCounter)},
+		{"glSamplerParameterIiv", reinterpret_cast<PFNGENERIC *>(&SamplerParameterIiv), reinterpret_cast<PFNGENERIC>(Switch_SamplerParameterIiv)},
+		{"glSamplerParameterIuiv", reinterpret_cast<PFNGENERIC *>(&SamplerParameterIuiv), reinterpret_cast<PFNGENERIC>(Switch_SamplerParameterIuiv)},
+		{"glSamplerParameterf", reinterpret_cast<PFNGENERIC *>(&SamplerParameterf), reinterpret_cast<PFNGENERIC>(Switch_SamplerParameterf)},
+		{"glSamplerParameterfv", reinterpret_cast<PFNGENERIC *>(&SamplerParameterfv), reinterpret_cast<PFNGENERIC>(Switch_SamplerParameterfv)},
+		{"glSamplerParameteri", reinterpret_cast<PFNGENERIC *>(&SamplerParameteri), reinterpret_cast<PFNGENERIC>(Switch_SamplerParameteri)},
+		{"glSamplerParameteriv", reinterpret_cast<PFNGENERIC *>(&SamplerParameteriv), reinterpret_cast<PFNGENERIC>(Switch_SamplerParameteriv)},
+		{"glSecondaryColorP3ui", reinterpret_cast<PFNGENERIC *>(&SecondaryColorP3ui), reinterpret_cast<PFNGENERIC>(Switch_SecondaryColorP3ui)},
+		{"glSecondaryColorP3uiv", reinterpret_cast<PFNGENERIC *>(&SecondaryColorP3uiv), reinterpret_cast<PFNGENERIC>(Switch_SecondaryColorP3uiv)},
+		{"glTexCoordP1ui", reinterpret_cast<PFNGENERIC *>(&TexCoordP1ui), reinterpret_cast<PFNGENERIC>(Switch_TexCoordP1ui)},
+		{"glTexCoordP1uiv", reinterpret_cast<PFNGENERIC *>(&TexCoordP1uiv), reinterpret_cast<PFNGENERIC>(Switch_TexCoordP1uiv)},
+		{"glTexCoordP2ui", reinterpret_cast<PFNGENERIC *>(&TexCoordP2ui), reinterpret_cast<PFNGENERIC>(Switch_TexCoordP2ui)},
+		{"glTexCoordP2uiv", reinterpret_cast<PFNGENERIC *>(&TexCoordP2uiv), reinterpret_cast<PFNGENERIC>(Switch_TexCoordP2uiv)},
+		{"glTexCoordP3ui", reinterpret_cast<PFNGENERIC *>(&TexCoordP3ui), reinterpret_cast<PFNGENERIC>(Switch_TexCoordP3ui)},
+		{"glTexCoordP3uiv", reinterpret_cast<PFNGENERIC *>(&TexCoordP3uiv), reinterpret_cast<PFNGENERIC>(Switch_TexCoordP3uiv)},
+		{"glTexCoordP4ui", reinterpret_cast<PFNGENERIC *>(&TexCoordP4ui), reinterpret_cast<PFNGENERIC>(Switch_TexCoordP4ui)},
+		{"glTexCoordP4uiv", reinterpret_cast<PFNGENERIC *>(&TexCoordP4uiv), reinterpret_cast<PFNGENERIC>(Switch_TexCoordP4uiv)},
+		{"glVertexAttribDivisor", reinterpret_cast<PFNGENERIC *>(&VertexAttribDivisor), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribDivisor)},
+		{"glVertexAttribP1ui", reinterpret_cast<PFNGENERIC *>(&VertexAttribP1ui), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribP1ui)},
+		{"glVertexAttribP1uiv", reinterpret_cast<PFNGENERIC *>(&VertexAttribP1uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribP1uiv)},
+		{"glVertexAttribP2ui", reinterpret_cast<PFNGENERIC *>(&VertexAttribP2ui), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribP2ui)},
+		{"glVertexAttribP2uiv", reinterpret_cast<PFNGENERIC *>(&VertexAttribP2uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribP2uiv)},
+		{"glVertexAttribP3ui", reinterpret_cast<PFNGENERIC *>(&VertexAttribP3ui), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribP3ui)},
+		{"glVertexAttribP3uiv", reinterpret_cast<PFNGENERIC *>(&VertexAttribP3uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribP3uiv)},
+		{"glVertexAttribP4ui", reinterpret_cast<PFNGENERIC *>(&VertexAttribP4ui), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribP4ui)},
+		{"glVertexAttribP4uiv", reinterpret_cast<PFNGENERIC *>(&VertexAttribP4uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribP4uiv)},
+		{"glVertexP2ui", reinterpret_cast<PFNGENERIC *>(&VertexP2ui), reinterpret_cast<PFNGENERIC>(Switch_VertexP2ui)},
+		{"glVertexP2uiv", reinterpret_cast<PFNGENERIC *>(&VertexP2uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexP2uiv)},
+		{"glVertexP3ui", reinterpret_cast<PFNGENERIC *>(&VertexP3ui), reinterpret_cast<PFNGENERIC>(Switch_VertexP3ui)},
+		{"glVertexP3uiv", reinterpret_cast<PFNGENERIC *>(&VertexP3uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexP3uiv)},
+		{"glVertexP4ui", reinterpret_cast<PFNGENERIC *>(&VertexP4ui), reinterpret_cast<PFNGENERIC>(Switch_VertexP4ui)},
+		{"glVertexP4uiv", reinterpret_cast<PFNGENERIC *>(&VertexP4uiv), reinterpret_cast<PFNGENERIC>(Switch_VertexP4uiv)},
+		{"glBeginQueryIndexed", reinterpret_cast<PFNGENERIC *>(&BeginQueryIndexed), reinterpret_cast<PFNGENERIC>(Switch_BeginQueryIndexed)},
+		{"glBindTransformFeedback", reinterpret_cast<PFNGENERIC *>(&BindTransformFeedback), reinterpret_cast<PFNGENERIC>(Switch_BindTransformFeedback)},
+		{"glBlendEquationSeparatei", reinterpret_cast<PFNGENERIC *>(&BlendEquationSeparatei), reinterpret_cast<PFNGENERIC>(Switch_BlendEquationSeparatei)},
+		{"glBlendEquationi", reinterpret_cast<PFNGENERIC *>(&BlendEquationi), reinterpret_cast<PFNGENERIC>(Switch_BlendEquationi)},
+		{"glBlendFuncSeparatei", reinterpret_cast<PFNGENERIC *>(&BlendFuncSeparatei), reinterpret_cast<PFNGENERIC>(Switch_BlendFuncSeparatei)},
+		{"glBlendFunci", reinterpret_cast<PFNGENERIC *>(&BlendFunci), reinterpret_cast<PFNGENERIC>(Switch_BlendFunci)},
+		{"glDeleteTransformFeedbacks", reinterpret_cast<PFNGENERIC *>(&DeleteTransformFeedbacks), reinterpret_cast<PFNGENERIC>(Switch_DeleteTransformFeedbacks)},
+		{"glDrawArraysIndirect", reinterpret_cast<PFNGENERIC *>(&DrawArraysIndirect), reinterpret_cast<PFNGENERIC>(Switch_DrawArraysIndirect)},
+		{"glDrawElementsIndirect", reinterpret_cast<PFNGENERIC *>(&DrawElementsIndirect), reinterpret_cast<PFNGENERIC>(Switch_DrawElementsIndirect)},
+		{"glDrawTransformFeedback", reinterpret_cast<PFNGENERIC *>(&DrawTransformFeedback), reinterpret_cast<PFNGENERIC>(Switch_DrawTransformFeedback)},
+		{"glDrawTransformFeedbackStream", reinterpret_cast<PFNGENERIC *>(&DrawTransformFeedbackStream), reinterpret_cast<PFNGENERIC>(Switch_DrawTransformFeedbackStream)},
+		{"glEndQueryIndexed", reinterpret_cast<PFNGENERIC *>(&EndQueryIndexed), reinterpret_cast<PFNGENERIC>(Switch_EndQueryIndexed)},
+		{"glGenTransformFeedbacks", reinterpret_cast<PFNGENERIC *>(&GenTransformFeedbacks), reinterpret_cast<PFNGENERIC>(Switch_GenTransformFeedbacks)},
+		{"glGetActiveSubroutineName", reinterpret_cast<PFNGENERIC *>(&GetActiveSubroutineName), reinterpret_cast<PFNGENERIC>(Switch_GetActiveSubroutineName)},
+		{"glGetActiveSubroutineUniformName", reinterpret_cast<PFNGENERIC *>(&GetActiveSubroutineUniformName), reinterpret_cast<PFNGENERIC>(Switch_GetActiveSubroutineUniformName)},
+		{"glGetActiveSubroutineUniformiv", reinterpret_cast<PFNGENERIC *>(&GetActiveSubroutineUniformiv), reinterpret_cast<PFNGENERIC>(Switch_GetActiveSubroutineUniformiv)},
+		{"glGetProgramStageiv", reinterpret_cast<PFNGENERIC *>(&GetProgramStageiv), reinterpret_cast<PFNGENERIC>(Switch_GetProgramStageiv)},
+		{"glGetQueryIndexediv", reinterpret_cast<PFNGENERIC *>(&GetQueryIndexediv), reinterpret_cast<PFNGENERIC>(Switch_GetQueryIndexediv)},
+		{"glGetSubroutineIndex", reinterpret_cast<PFNGENERIC *>(&GetSubroutineIndex), reinterpret_cast<PFNGENERIC>(Switch_GetSubroutineIndex)},
+		{"glGetSubroutineUniformLocation", reinterpret_cast<PFNGENERIC *>(&GetSubroutineUniformLocation), reinterpret_cast<PFNGENERIC>(Switch_GetSubroutineUniformLocation)},
+		{"glGetUniformSubroutineuiv", reinterpret_cast<PFNGENERIC *>(&GetUniformSubroutineuiv), reinterpret_cast<PFNGENERIC>(Switch_GetUniformSubroutineuiv)},
+		{"glGetUniformdv", reinterpret_cast<PFNGENERIC *>(&GetUniformdv), reinterpret_cast<PFNGENERIC>(Switch_GetUniformdv)},
+		{"glIsTransformFeedback", reinterpret_cast<PFNGENERIC *>(&IsTransformFeedback), reinterpret_cast<PFNGENERIC>(Switch_IsTransformFeedback)},
+		{"glMinSampleShading", reinterpret_cast<PFNGENERIC *>(&MinSampleShading), reinterpret_cast<PFNGENERIC>(Switch_MinSampleShading)},
+		{"glPatchParameterfv", reinterpret_cast<PFNGENERIC *>(&PatchParameterfv), reinterpret_cast<PFNGENERIC>(Switch_PatchParameterfv)},
+		{"glPatchParameteri", reinterpret_cast<PFNGENERIC *>(&PatchParameteri), reinterpret_cast<PFNGENERIC>(Switch_PatchParameteri)},
+		{"glPauseTransformFeedback", reinterpret_cast<PFNGENERIC *>(&PauseTransformFeedback), reinterpret_cast<PFNGENERIC>(Switch_PauseTransformFeedback)},
+		{"glResumeTransformFeedback", reinterpret_cast<PFNGENERIC *>(&ResumeTransformFeedback), reinterpret_cast<PFNGENERIC>(Switch_ResumeTransformFeedback)},
+		{"glUniform1d", reinterpret_cast<PFNGENERIC *>(&Uniform1d), reinterpret_cast<PFNGENERIC>(Switch_Uniform1d)},
+		{"glUniform1dv", reinterpret_cast<PFNGENERIC *>(&Uniform1dv), reinterpret_cast<PFNGENERIC>(Switch_Uniform1dv)},
+		{"glUniform2d", reinterpret_cast<PFNGENERIC *>(&Uniform2d), reinterpret_cast<PFNGENERIC>(Switch_Uniform2d)},
+		{"glUniform2dv", reinterpret_cast<PFNGENERIC *>(&Uniform2dv), reinterpret_cast<PFNGENERIC>(Switch_Uniform2dv)},
+		{"glUniform3d", reinterpret_cast<PFNGENERIC *>(&Uniform3d), reinterpret_cast<PFNGENERIC>(Switch_Uniform3d)},
+		{"glUniform3dv", reinterpret_cast<PFNGENERIC *>(&Uniform3dv), reinterpret_cast<PFNGENERIC>(Switch_Uniform3dv)},
+		{"glUniform4d", reinterpret_cast<PFNGENERIC *>(&Uniform4d), reinterpret_cast<PFNGENERIC>(Switch_Uniform4d)},
+		{"glUniform4dv", reinterpret_cast<PFNGENERIC *>(&Uniform4dv), reinterpret_cast<PFNGENERIC>(Switch_Uniform4dv)},
+		{"glUniformMatrix2dv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix2dv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix2dv)},
+		{"glUniformMatrix2x3dv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix2x3dv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix2x3dv)},
+		{"glUniformMatrix2x4dv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix2x4dv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix2x4dv)},
+		{"glUniformMatrix3dv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix3dv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix3dv)},
+		{"glUniformMatrix3x2dv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix3x2dv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix3x2dv)},
+		{"glUniformMatrix3x4dv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix3x4dv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix3x4dv)},
+		{"glUniformMatrix4dv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix4dv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix4dv)},
+		{"glUniformMatrix4x2dv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix4x2dv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix4x2dv)},
+		{"glUniformMatrix4x3dv", reinterpret_cast<PFNGENERIC *>(&UniformMatrix4x3dv), reinterpret_cast<PFNGENERIC>(Switch_UniformMatrix4x3dv)},
+		{"glUniformSubroutinesuiv", reinterpret_cast<PFNGENERIC *>(&UniformSubroutinesuiv), reinterpret_cast<PFNGENERIC>(Switch_UniformSubroutinesuiv)},
+		{"glActiveShaderProgram", reinterpret_cast<PFNGENERIC *>(&ActiveShaderProgram), reinterpret_cast<PFNGENERIC>(Switch_ActiveShaderProgram)},
+		{"glBindProgramPipeline", reinterpret_cast<PFNGENERIC *>(&BindProgramPipeline), reinterpret_cast<PFNGENERIC>(Switch_BindProgramPipeline)},
+		{"glClearDepthf", reinterpret_cast<PFNGENERIC *>(&ClearDepthf), reinterpret_cast<PFNGENERIC>(Switch_ClearDepthf)},
+		{"glCreateShaderProgramv", reinterpret_cast<PFNGENERIC *>(&CreateShaderProgramv), reinterpret_cast<PFNGENERIC>(Switch_CreateShaderProgramv)},
+		{"glDeleteProgramPipelines", reinterpret_cast<PFNGENERIC *>(&DeleteProgramPipelines), reinterpret_cast<PFNGENERIC>(Switch_DeleteProgramPipelines)},
+		{"glDepthRangeArrayv", reinterpret_cast<PFNGENERIC *>(&DepthRangeArrayv), reinterpret_cast<PFNGENERIC>(Switch_DepthRangeArrayv)},
+		{"glDepthRangeIndexed", reinterpret_cast<PFNGENERIC *>(&DepthRangeIndexed), reinterpret_cast<PFNGENERIC>(Switch_DepthRangeIndexed)},
+		{"glDepthRangef", reinterpret_cast<PFNGENERIC *>(&DepthRangef), reinterpret_cast<PFNGENERIC>(Switch_DepthRangef)},
+		{"glGenProgramPipelines", reinterpret_cast<PFNGENERIC *>(&GenProgramPipelines), reinterpret_cast<PFNGENERIC>(Switch_GenProgramPipelines)},
+		{"glGetDoublei_v", reinterpret_cast<PFNGENERIC *>(&GetDoublei_v), reinterpret_cast<PFNGENERIC>(Switch_GetDoublei_v)},
+		{"glGetFloati_v", reinterpret_cast<PFNGENERIC *>(&GetFloati_v), reinterpret_cast<PFNGENERIC>(Switch_GetFloati_v)},
+		{"glGetProgramBinary", reinterpret_cast<PFNGENERIC *>(&GetProgramBinary), reinterpret_cast<PFNGENERIC>(Switch_GetProgramBinary)},
+		{"glGetProgramPipelineInfoLog", reinterpret_cast<PFNGENERIC *>(&GetProgramPipelineInfoLog), reinterpret_cast<PFNGENERIC>(Switch_GetProgramPipelineInfoLog)},
+		{"glGetProgramPipelineiv", reinterpret_cast<PFNGENERIC *>(&GetProgramPipelineiv), reinterpret_cast<PFNGENERIC>(Switch_GetProgramPipelineiv)},
+		{"glGetShaderPrecisionFormat", reinterpret_cast<PFNGENERIC *>(&GetShaderPrecisionFormat), reinterpret_cast<PFNGENERIC>(Switch_GetShaderPrecisionFormat)},
+		{"glGetVertexAttribLdv", reinterpret_cast<PFNGENERIC *>(&GetVertexAttribLdv), reinterpret_cast<PFNGENERIC>(Switch_GetVertexAttribLdv)},
+		{"glIsProgramPipeline", reinterpret_cast<PFNGENERIC *>(&IsProgramPipeline), reinterpret_cast<PFNGENERIC>(Switch_IsProgramPipeline)},
+		{"glProgramBinary", reinterpret_cast<PFNGENERIC *>(&ProgramBinary), reinterpret_cast<PFNGENERIC>(Switch_ProgramBinary)},
+		{"glProgramParameteri", reinterpret_cast<PFNGENERIC *>(&ProgramParameteri), reinterpret_cast<PFNGENERIC>(Switch_ProgramParameteri)},
+		{"glProgramUniform1d", reinterpret_cast<PFNGENERIC *>(&ProgramUniform1d), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform1d)},
+		{"glProgramUniform1dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform1dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform1dv)},
+		{"glProgramUniform1f", reinterpret_cast<PFNGENERIC *>(&ProgramUniform1f), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform1f)},
+		{"glProgramUniform1fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform1fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform1fv)},
+		{"glProgramUniform1i", reinterpret_cast<PFNGENERIC *>(&ProgramUniform1i), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform1i)},
+		{"glProgramUniform1iv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform1iv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform1iv)},
+		{"glProgramUniform1ui", reinterpret_cast<PFNGENERIC *>(&ProgramUniform1ui), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform1ui)},
+		{"glProgramUniform1uiv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform1uiv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform1uiv)},
+		{"glProgramUniform2d", reinterpret_cast<PFNGENERIC *>(&ProgramUniform2d), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform2d)},
+		{"glProgramUniform2dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform2dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform2dv)},
+		{"glProgramUniform2f", reinterpret_cast<PFNGENERIC *>(&ProgramUniform2f), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform2f)},
+		{"glProgramUniform2fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform2fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform2fv)},
+		{"glProgramUniform2i", reinterpret_cast<PFNGENERIC *>(&ProgramUniform2i), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform2i)},
+		{"glProgramUniform2iv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform2iv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform2iv)},
+		{"glProgramUniform2ui", reinterpret_cast<PFNGENERIC *>(&ProgramUniform2ui), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform2ui)},
+		{"glProgramUniform2uiv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform2uiv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform2uiv)},
+		{"glProgramUniform3d", reinterpret_cast<PFNGENERIC *>(&ProgramUniform3d), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform3d)},
+		{"glProgramUniform3dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform3dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform3dv)},
+		{"glProgramUniform3f", reinterpret_cast<PFNGENERIC *>(&ProgramUniform3f), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform3f)},
+		{"glProgramUniform3fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform3fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform3fv)},
+		{"glProgramUniform3i", reinterpret_cast<PFNGENERIC *>(&ProgramUniform3i), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform3i)},
+		{"glProgramUniform3iv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform3iv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform3iv)},
+		{"glProgramUniform3ui", reinterpret_cast<PFNGENERIC *>(&ProgramUniform3ui), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform3ui)},
+		{"glProgramUniform3uiv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform3uiv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform3uiv)},
+		{"glProgramUniform4d", reinterpret_cast<PFNGENERIC *>(&ProgramUniform4d), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform4d)},
+		{"glProgramUniform4dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform4dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform4dv)},
+		{"glProgramUniform4f", reinterpret_cast<PFNGENERIC *>(&ProgramUniform4f), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform4f)},
+		{"glProgramUniform4fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform4fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform4fv)},
+		{"glProgramUniform4i", reinterpret_cast<PFNGENERIC *>(&ProgramUniform4i), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform4i)},
+		{"glProgramUniform4iv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform4iv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform4iv)},
+		{"glProgramUniform4ui", reinterpret_cast<PFNGENERIC *>(&ProgramUniform4ui), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform4ui)},
+		{"glProgramUniform4uiv", reinterpret_cast<PFNGENERIC *>(&ProgramUniform4uiv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniform4uiv)},
+		{"glProgramUniformMatrix2dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix2dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix2dv)},
+		{"glProgramUniformMatrix2fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix2fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix2fv)},
+		{"glProgramUniformMatrix2x3dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix2x3dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix2x3dv)},
+		{"glProgramUniformMatrix2x3fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix2x3fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix2x3fv)},
+		{"glProgramUniformMatrix2x4dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix2x4dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix2x4dv)},
+		{"glProgramUniformMatrix2x4fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix2x4fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix2x4fv)},
+		{"glProgramUniformMatrix3dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix3dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix3dv)},
+		{"glProgramUniformMatrix3fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix3fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix3fv)},
+		{"glProgramUniformMatrix3x2dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix3x2dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix3x2dv)},
+		{"glProgramUniformMatrix3x2fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix3x2fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix3x2fv)},
+		{"glProgramUniformMatrix3x4dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix3x4dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix3x4dv)},
+		{"glProgramUniformMatrix3x4fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix3x4fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix3x4fv)},
+		{"glProgramUniformMatrix4dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix4dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix4dv)},
+		{"glProgramUniformMatrix4fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix4fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix4fv)},
+		{"glProgramUniformMatrix4x2dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix4x2dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix4x2dv)},
+		{"glProgramUniformMatrix4x2fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix4x2fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix4x2fv)},
+		{"glProgramUniformMatrix4x3dv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix4x3dv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix4x3dv)},
+		{"glProgramUniformMatrix4x3fv", reinterpret_cast<PFNGENERIC *>(&ProgramUniformMatrix4x3fv), reinterpret_cast<PFNGENERIC>(Switch_ProgramUniformMatrix4x3fv)},
+		{"glReleaseShaderCompiler", reinterpret_cast<PFNGENERIC *>(&ReleaseShaderCompiler), reinterpret_cast<PFNGENERIC>(Switch_ReleaseShaderCompiler)},
+		{"glScissorArrayv", reinterpret_cast<PFNGENERIC *>(&ScissorArrayv), reinterpret_cast<PFNGENERIC>(Switch_ScissorArrayv)},
+		{"glScissorIndexed", reinterpret_cast<PFNGENERIC *>(&ScissorIndexed), reinterpret_cast<PFNGENERIC>(Switch_ScissorIndexed)},
+		{"glScissorIndexedv", reinterpret_cast<PFNGENERIC *>(&ScissorIndexedv), reinterpret_cast<PFNGENERIC>(Switch_ScissorIndexedv)},
+		{"glShaderBinary", reinterpret_cast<PFNGENERIC *>(&ShaderBinary), reinterpret_cast<PFNGENERIC>(Switch_ShaderBinary)},
+		{"glUseProgramStages", reinterpret_cast<PFNGENERIC *>(&UseProgramStages), reinterpret_cast<PFNGENERIC>(Switch_UseProgramStages)},
+		{"glValidateProgramPipeline", reinterpret_cast<PFNGENERIC *>(&ValidateProgramPipeline), reinterpret_cast<PFNGENERIC>(Switch_ValidateProgramPipeline)},
+		{"glVertexAttribL1d", reinterpret_cast<PFNGENERIC *>(&VertexAttribL1d), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribL1d)},
+		{"glVertexAttribL1dv", reinterpret_cast<PFNGENERIC *>(&VertexAttribL1dv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribL1dv)},
+		{"glVertexAttribL2d", reinterpret_cast<PFNGENERIC *>(&VertexAttribL2d), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribL2d)},
+		{"glVertexAttribL2dv", reinterpret_cast<PFNGENERIC *>(&VertexAttribL2dv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribL2dv)},
+		{"glVertexAttribL3d", reinterpret_cast<PFNGENERIC *>(&VertexAttribL3d), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribL3d)},
+		{"glVertexAttribL3dv", reinterpret_cast<PFNGENERIC *>(&VertexAttribL3dv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribL3dv)},
+		{"glVertexAttribL4d", reinterpret_cast<PFNGENERIC *>(&VertexAttribL4d), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribL4d)},
+		{"glVertexAttribL4dv", reinterpret_cast<PFNGENERIC *>(&VertexAttribL4dv), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribL4dv)},
+		{"glVertexAttribLPointer", reinterpret_cast<PFNGENERIC *>(&VertexAttribLPointer), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribLPointer)},
+		{"glViewportArrayv", reinterpret_cast<PFNGENERIC *>(&ViewportArrayv), reinterpret_cast<PFNGENERIC>(Switch_ViewportArrayv)},
+		{"glViewportIndexedf", reinterpret_cast<PFNGENERIC *>(&ViewportIndexedf), reinterpret_cast<PFNGENERIC>(Switch_ViewportIndexedf)},
+		{"glViewportIndexedfv", reinterpret_cast<PFNGENERIC *>(&ViewportIndexedfv), reinterpret_cast<PFNGENERIC>(Switch_ViewportIndexedfv)},
+		{"glBindImageTexture", reinterpret_cast<PFNGENERIC *>(&BindImageTexture), reinterpret_cast<PFNGENERIC>(Switch_BindImageTexture)},
+		{"glDrawArraysInstancedBaseInstance", reinterpret_cast<PFNGENERIC *>(&DrawArraysInstancedBaseInstance), reinterpret_cast<PFNGENERIC>(Switch_DrawArraysInstancedBaseInstance)},
+		{"glDrawElementsInstancedBaseInstance", reinterpret_cast<PFNGENERIC *>(&DrawElementsInstancedBaseInstance), reinterpret_cast<PFNGENERIC>(Switch_DrawElementsInstancedBaseInstance)},
+		{"glDrawElementsInstancedBaseVertexBaseInstance", reinterpret_cast<PFNGENERIC *>(&DrawElementsInstancedBaseVertexBaseInstance), reinterpret_cast<PFNGENERIC>(Switch_DrawElementsInstancedBaseVertexBaseInstance)},
+		{"glDrawTransformFeedbackInstanced", reinterpret_cast<PFNGENERIC *>(&DrawTransformFeedbackInstanced), reinterpret_cast<PFNGENERIC>(Switch_DrawTransformFeedbackInstanced)},
+		{"glDrawTransformFeedbackStreamInstanced", reinterpret_cast<PFNGENERIC *>(&DrawTransformFeedbackStreamInstanced), reinterpret_cast<PFNGENERIC>(Switch_DrawTransformFeedbackStreamInstanced)},
+		{"glGetActiveAtomicCounterBufferiv", reinterpret_cast<PFNGENERIC *>(&GetActiveAtomicCounterBufferiv), reinterpret_cast<PFNGENERIC>(Switch_GetActiveAtomicCounterBufferiv)},
+		{"glGetInternalformati64v", reinterpret_cast<PFNGENERIC *>(&GetInternalformati64v), reinterpret_cast<PFNGENERIC>(Switch_GetInternalformati64v)},
+		{"glMemoryBarrier", reinterpret_cast<PFNGENERIC *>(&MemoryBarrier), reinterpret_cast<PFNGENERIC>(Switch_MemoryBarrier)},
+		{"glTexStorage1D", reinterpret_cast<PFNGENERIC *>(&TexStorage1D), reinterpret_cast<PFNGENERIC>(Switch_TexStorage1D)},
+		{"glTexStorage2D", reinterpret_cast<PFNGENERIC *>(&TexStorage2D), reinterpret_cast<PFNGENERIC>(Switch_TexStorage2D)},
+		{"glTexStorage3D", reinterpret_cast<PFNGENERIC *>(&TexStorage3D), reinterpret_cast<PFNGENERIC>(Switch_TexStorage3D)},
+		{"glBindVertexBuffer", reinterpret_cast<PFNGENERIC *>(&BindVertexBuffer), reinterpret_cast<PFNGENERIC>(Switch_BindVertexBuffer)},
+		{"glClearBufferData", reinterpret_cast<PFNGENERIC *>(&ClearBufferData), reinterpret_cast<PFNGENERIC>(Switch_ClearBufferData)},
+		{"glClearBufferSubData", reinterpret_cast<PFNGENERIC *>(&ClearBufferSubData), reinterpret_cast<PFNGENERIC>(Switch_ClearBufferSubData)},
+		{"glCopyImageSubData", reinterpret_cast<PFNGENERIC *>(&CopyImageSubData), reinterpret_cast<PFNGENERIC>(Switch_CopyImageSubData)},
+		{"glDebugMessageCallback", reinterpret_cast<PFNGENERIC *>(&DebugMessageCallback), reinterpret_cast<PFNGENERIC>(Switch_DebugMessageCallback)},
+		{"glDebugMessageControl", reinterpret_cast<PFNGENERIC *>(&DebugMessageControl), reinterpret_cast<PFNGENERIC>(Switch_DebugMessageControl)},
+		{"glDebugMessageInsert", reinterpret_cast<PFNGENERIC *>(&DebugMessageInsert), reinterpret_cast<PFNGENERIC>(Switch_DebugMessageInsert)},
+		{"glDispatchCompute", reinterpret_cast<PFNGENERIC *>(&DispatchCompute), reinterpret_cast<PFNGENERIC>(Switch_DispatchCompute)},
+		{"glDispatchComputeIndirect", reinterpret_cast<PFNGENERIC *>(&DispatchComputeIndirect), reinterpret_cast<PFNGENERIC>(Switch_DispatchComputeIndirect)},
+		{"glFramebufferParameteri", reinterpret_cast<PFNGENERIC *>(&FramebufferParameteri), reinterpret_cast<PFNGENERIC>(Switch_FramebufferParameteri)},
+		{"glGetDebugMessageLog", reinterpret_cast<PFNGENERIC *>(&GetDebugMessageLog), reinterpret_cast<PFNGENERIC>(Switch_GetDebugMessageLog)},
+		{"glGetFramebufferParameteriv", reinterpret_cast<PFNGENERIC *>(&GetFramebufferParameteriv), reinterpret_cast<PFNGENERIC>(Switch_GetFramebufferParameteriv)},
+		{"glGetObjectLabel", reinterpret_cast<PFNGENERIC *>(&GetObjectLabel), reinterpret_cast<PFNGENERIC>(Switch_GetObjectLabel)},
+		{"glGetObjectPtrLabel", reinterpret_cast<PFNGENERIC *>(&GetObjectPtrLabel), reinterpret_cast<PFNGENERIC>(Switch_GetObjectPtrLabel)},
+		{"glGetProgramInterfaceiv", reinterpret_cast<PFNGENERIC *>(&GetProgramInterfaceiv), reinterpret_cast<PFNGENERIC>(Switch_GetProgramInterfaceiv)},
+		{"glGetProgramResourceIndex", reinterpret_cast<PFNGENERIC *>(&GetProgramResourceIndex), reinterpret_cast<PFNGENERIC>(Switch_GetProgramResourceIndex)},
+		{"glGetProgramResourceLocation", reinterpret_cast<PFNGENERIC *>(&GetProgramResourceLocation), reinterpret_cast<PFNGENERIC>(Switch_GetProgramResourceLocation)},
+		{"glGetProgramResourceLocationIndex", reinterpret_cast<PFNGENERIC *>(&GetProgramResourceLocationIndex), reinterpret_cast<PFNGENERIC>(Switch_GetProgramResourceLocationIndex)},
+		{"glGetProgramResourceName", reinterpret_cast<PFNGENERIC *>(&GetProgramResourceName), reinterpret_cast<PFNGENERIC>(Switch_GetProgramResourceName)},
+		{"glGetProgramResourceiv", reinterpret_cast<PFNGENERIC *>(&GetProgramResourceiv), reinterpret_cast<PFNGENERIC>(Switch_GetProgramResourceiv)},
+		{"glInvalidateBufferData", reinterpret_cast<PFNGENERIC *>(&InvalidateBufferData), reinterpret_cast<PFNGENERIC>(Switch_InvalidateBufferData)},
+		{"glInvalidateBufferSubData", reinterpret_cast<PFNGENERIC *>(&InvalidateBufferSubData), reinterpret_cast<PFNGENERIC>(Switch_InvalidateBufferSubData)},
+		{"glInvalidateFramebuffer", reinterpret_cast<PFNGENERIC *>(&InvalidateFramebuffer), reinterpret_cast<PFNGENERIC>(Switch_InvalidateFramebuffer)},
+		{"glInvalidateSubFramebuffer", reinterpret_cast<PFNGENERIC *>(&InvalidateSubFramebuffer), reinterpret_cast<PFNGENERIC>(Switch_InvalidateSubFramebuffer)},
+		{"glInvalidateTexImage", reinterpret_cast<PFNGENERIC *>(&InvalidateTexImage), reinterpret_cast<PFNGENERIC>(Switch_InvalidateTexImage)},
+		{"glInvalidateTexSubImage", reinterpret_cast<PFNGENERIC *>(&InvalidateTexSubImage), reinterpret_cast<PFNGENERIC>(Switch_InvalidateTexSubImage)},
+		{"glMultiDrawArraysIndirect", reinterpret_cast<PFNGENERIC *>(&MultiDrawArraysIndirect), reinterpret_cast<PFNGENERIC>(Switch_MultiDrawArraysIndirect)},
+		{"glMultiDrawElementsIndirect", reinterpret_cast<PFNGENERIC *>(&MultiDrawElementsIndirect), reinterpret_cast<PFNGENERIC>(Switch_MultiDrawElementsIndirect)},
+		{"glObjectLabel", reinterpret_cast<PFNGENERIC *>(&ObjectLabel), reinterpret_cast<PFNGENERIC>(Switch_ObjectLabel)},
+		{"glObjectPtrLabel", reinterpret_cast<PFNGENERIC *>(&ObjectPtrLabel), reinterpret_cast<PFNGENERIC>(Switch_ObjectPtrLabel)},
+		{"glPopDebugGroup", reinterpret_cast<PFNGENERIC *>(&PopDebugGroup), reinterpret_cast<PFNGENERIC>(Switch_PopDebugGroup)},
+		{"glPushDebugGroup", reinterpret_cast<PFNGENERIC *>(&PushDebugGroup), reinterpret_cast<PFNGENERIC>(Switch_PushDebugGroup)},
+		{"glShaderStorageBlockBinding", reinterpret_cast<PFNGENERIC *>(&ShaderStorageBlockBinding), reinterpret_cast<PFNGENERIC>(Switch_ShaderStorageBlockBinding)},
+		{"glTexBufferRange", reinterpret_cast<PFNGENERIC *>(&TexBufferRange), reinterpret_cast<PFNGENERIC>(Switch_TexBufferRange)},
+		{"glTexStorage2DMultisample", reinterpret_cast<PFNGENERIC *>(&TexStorage2DMultisample), reinterpret_cast<PFNGENERIC>(Switch_TexStorage2DMultisample)},
+		{"glTexStorage3DMultisample", reinterpret_cast<PFNGENERIC *>(&TexStorage3DMultisample), reinterpret_cast<PFNGENERIC>(Switch_TexStorage3DMultisample)},
+		{"glTextureView", reinterpret_cast<PFNGENERIC *>(&TextureView), reinterpret_cast<PFNGENERIC>(Switch_TextureView)},
+		{"glVertexAttribBinding", reinterpret_cast<PFNGENERIC *>(&VertexAttribBinding), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribBinding)},
+		{"glVertexAttribFormat", reinterpret_cast<PFNGENERIC *>(&VertexAttribFormat), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribFormat)},
+		{"glVertexAttribIFormat", reinterpret_cast<PFNGENERIC *>(&VertexAttribIFormat), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribIFormat)},
+		{"glVertexAttribLFormat", reinterpret_cast<PFNGENERIC *>(&VertexAttribLFormat), reinterpret_cast<PFNGENERIC>(Switch_VertexAttribLFormat)},
+		{"glVertexBindingDivisor", reinterpret_cast<PFNGENERIC *>(&VertexBindingDivisor), reinterpret_cast<PFNGENERIC>(Switch_VertexBindingDivisor)},
+	};
+	
+	static const int NUM_CORE_FUNCTIONS = sizeof(s_coreEntries) / sizeof(s_coreEntries[0]);
+	
+	static PFNGENERIC ResolveCoreFunction(int index)
+	{
+		const CoreEntry &entry = s_coreEntries[index];
+		PFNGENERIC pFunc = reinterpret_cast<PFNGENERIC>(IntGetProcAddress(entry.name));
+		//LoadFunctions could not report it, so name the function rather than calling through null.
+		if(!pFunc)
+		{
+			fprintf(stderr, "%s is missing from the GL driver, it was first called after a lazy load\n", entry.name);
+			abort();
+		}
+		//A pointer swapped since, e.g. by a call recorder, keeps its replacement.
+		if(*entry.slot == entry.trampoline)
+			*entry.slot = pFunc;
+		return pFunc;
+	}
+	
+	static void InstallCoreTrampolines()
+	{
+		for(int iLoop = 0; iLoop < NUM_CORE_FUNCTIONS; iLoop++)
+			*s_coreEntries[iLoop].slot = s_coreEntries[iLoop].trampoline;
+	}
+	
+	
+	namespace sys
+	{
+		namespace 
+		{
+			typedef int (*PFN_LOADEXTENSION)();
+			struct MapEntry
+			{
+				MapEntry(const char *_extName, exts::LoadTest *_extVariable)
+					: extName(_extName)
+					, extVariable(_extVariable)
+					, loaderFunc(0)
+					{}
+					
+				MapEntry(const char *_extName, exts::LoadTest *_extVariable, PFN_LOADEXTENSION _loaderFunc)
+					: extName(_extName)
+					, extVariable(_extVariable)
+					, loaderFunc(_loaderFunc)
+					{}
+				
+				const char *extName;
+				exts::LoadTest *extVariable;
+				PFN_LOADEXTENSION loaderFunc;
+			};
+			
+			struct MapCompare
+			{
+				MapCompare(const char *test_) : test(test_) {}
+				bool operator()(const MapEntry &other) { return strcmp(test, other.extName) == 0; }
+				const char *test;
+			};
+			
+			void InitializeMappingTable(std::vector<MapEntry> &table)
+			{
+				table.reserve(3);
+				table.push_back(MapEntry("GL_ARB_buffer_storage", &exts::var_ARB_buffer_storage, Load_ARB_buffer_storage));
+				table.push_back(MapEntry("GL_ARB_parallel_shader_compile", &exts::var_ARB_parallel_shader_compile, Load_ARB_parallel_shader_compile));
+				table.push_back(MapEntry("GL_KHR_parallel_shader_compile", &exts::var_KHR_parallel_shader_compile, Load_KHR_parallel_shader_compile));
+			}
+			
+			void ClearExtensionVars()
+			{
+				exts::var_ARB_buffer_storage = exts::LoadTest();
+				exts::var_ARB_parallel_shader_compile = exts::LoadTest();
+				exts::var_KHR_parallel_shader_compile = exts::LoadTest();
+			}
+			
+			void LoadExtByName(std::vector<MapEntry> &table, const char *extensionName)
+			{
+				std::vector<MapEntry>::iterator entry = std::find_if(table.begin(), table.end(), MapCompare(extensionName));
+				
+				if(entry != table.end())
+				{
+					if(entry->loaderFunc)
+						(*entry->extVariable) = exts::LoadTest(true, entry->loaderFunc());
+					else
+						(*entry->extVariable) = exts::LoadTest(true, 0);
+				}
+			}
+		} //namespace 
+		
+		
+		namespace 
+		{
+			static LoadMode g_loadMode = LOAD_EAGER;
+			static std::vector<std::string> g_extensions; //Sorted, read once per LoadFunctions
+			
+			static void ProcExtsFromExtList(std::vector<MapEntry> &table)
+			{
+				GLint iLoop;
+				GLint iNumExtensions = 0;
+				gl::GetIntegerv(gl::NUM_EXTENSIONS, &iNumExtensions);
+				
+				g_extensions.clear();
+				g_extensions.reserve(iNumExtensions);
+				for(iLoop = 0; iLoop < iNumExtensions; iLoop++)
+				{
+					const char *strExtensionName = (const char *)gl::GetStringi(gl::EXTENSIONS, iLoop);
+					if(!strExtensionName) continue;
+					g_extensions.push_back(strExtensionName);
+					LoadExtByName(table, strExtensionName);
+				}
+				std::sort(g_extensions.begin(), g_extensions.end());
+			}
+			
+		} //namespace 
+		
+		void SetLoadMode(LoadMode mode)
+		{
+			g_loadMode = mode;
+		}
+		
+		LoadMode GetLoadMode()
+		{
+			return g_loadMode;
+		}
+		
+		exts::LoadTest LoadFunctions()
+		{
+			ClearExtensionVars();
+			std::vector<MapEntry> table;
+			InitializeMappingTable(table);
+			
+			//Trampolines go in first, the two functions the extension list needs are then loaded over them.
+			if(g_loadMode == LOAD_LAZY)
+				InstallCoreTrampolines();
+			
+			GetIntegerv = reinterpret_cast<PFNGETINTEGERV>(IntGetProcAddress("glGetIntegerv"));
+			if(!GetIntegerv) return exts::LoadTest();
+			GetStringi = reinterpret_cast<PFNGETSTRINGI>(IntGetProcAddress("glGetStringi"));
+			if(!GetStringi) return exts::LoadTest();
+			
+			ProcExtsFromExtList(table);
+			
+			//Lazily loaded functions are not looked up here, so none count as missing. ResolveAllFunctions
+			//counts them, otherwise the first call to a missing one aborts naming it.
+			int numFailed = g_loadMode == LOAD_LAZY ? 0 : LoadCoreFunctions();
+			return exts::LoadTest(true, numFailed);
+		}
+		
+		int ResolveAllFunctions()
+		{
+			int numFailed = 0;
+			for(int iLoop = 0; iLoop < NUM_CORE_FUNCTIONS; iLoop++)
+			{
+				const CoreEntry &entry = s_coreEntries[iLoop];
+				if(*entry.slot == entry.trampoline)
+					ResolveCoreFunction(iLoop);
+				if(!*entry.slot) ++numFailed;
+			}
+			return numFailed;
+		}
+		
+		int GetNumFunctions()
+		{
+			return NUM_CORE_FUNCTIONS;
+		}
+		
+		int GetNumResolvedFunctions()
+		{
+			int numResolved = 0;
+			for(int iLoop = 0; iLoop < NUM_CORE_FUNCTIONS; iLoop++)
+			{
+				const CoreEntry &entry = s_coreEntries[iLoop];
+				if(*entry.slot && *entry.slot != entry.trampoline) ++numResolved;
+			}
+			return numResolved;
+		}
+		
+		bool IsExtensionSupported(const char *extensionName)
+		{
+			return std::binary_search(g_extensions.begin(), g_extensions.end(), std::string(extensionName));
+		}
+		
+		int GetNumExtensions()
+		{
+			return static_cast<int>(g_extensions.size());
 		}
 		
 		static int g_major_version = 0;
@@ -174,9 +174,27 @@ namespace gl
 			int m_numMissing;
 		};
 		
+		extern LoadTest var_ARB_buffer_storage;
+		extern LoadTest var_ARB_parallel_shader_compile;
+		extern LoadTest var_KHR_parallel_shader_compile;
+		
 	} //namespace exts
 	enum
 	{
+		BUFFER_IMMUTABLE_STORAGE         = 0x821F,
+		BUFFER_STORAGE_FLAGS             = 0x8220,
+		CLIENT_MAPPED_BUFFER_BARRIER_BIT = 0x00004000,
+		CLIENT_STORAGE_BIT               = 0x0200,
+		DYNAMIC_STORAGE_BIT              = 0x0100,
+		MAP_COHERENT_BIT                 = 0x0080,
+		MAP_PERSISTENT_BIT               = 0x0040,
+		
+		COMPLETION_STATUS_ARB            = 0x91B1,
+		MAX_SHADER_COMPILER_THREADS_ARB  = 0x91B0,
+		
+		COMPLETION_STATUS_KHR            = 0x91B1,
+		MAX_SHADER_COMPILER_THREADS_KHR  = 0x91B0,
+		
 		ALPHA                            = 0x1906,
 		ALWAYS                           = 0x0207,
 		AND                              = 0x1501,
@@ -1464,6 +1482,16 @@ namespace gl
 		VIEW_COMPATIBILITY_CLASS         = 0x82B6,
 		
 	};
+	
+	// Extension: ARB_buffer_storage
+	extern void (CODEGEN_FUNCPTR *BufferStorage)(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags);
+	
+	// Extension: ARB_parallel_shader_compile
+	extern void (CODEGEN_FUNCPTR *MaxShaderCompilerThreadsARB)(GLuint count);
+	
+	// Extension: KHR_parallel_shader_compile
+	extern void (CODEGEN_FUNCPTR *MaxShaderCompilerThreadsKHR)(GLuint count);
+	
 	extern void (CODEGEN_FUNCPTR *BlendFunc)(GLenum sfactor, GLenum dfactor);
 	extern void (CODEGEN_FUNCPTR *Clear)(GLbitfield mask);
 	extern void (CODEGEN_FUNCPTR *ClearColor)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
@@ -2050,8 +2078,30 @@ namespace gl
 	namespace sys
 	{
 		
+		//LOAD_EAGER looks every core function up in LoadFunctions. LOAD_LAZY points each one
+		//at a trampoline that looks it up on its first call instead, so LoadFunctions cannot
+		//report missing functions and the first call to one aborts.
+		enum LoadMode
+		{
+			LOAD_EAGER,
+			LOAD_LAZY
+		};
+		
+		void SetLoadMode(LoadMode mode);
+		LoadMode GetLoadMode();
+		
 		exts::LoadTest LoadFunctions();
 		
+		//Looks up every core function still waiting on its first call, returns how many the driver lacks.
+		int ResolveAllFunctions();
+		int GetNumFunctions();
+		int GetNumResolvedFunctions();
+		
+		//Searches the extension names read by LoadFunctions, without asking the driver again.
+		//Covers every extension, exts:: only has the ones this loader was generated with.
+		bool IsExtensionSupported(const char *extensionName);
+		int GetNumExtensions();
+		
 		int GetMinorVersion();
 		int GetMajorVersion();
 		bool IsVersionGEQ(int majorVersion, int minorVersion);
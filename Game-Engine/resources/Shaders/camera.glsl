@@ -0,0 +1,9 @@
+// Shared by every stage, bound to CAMERA_BLOCK
+
+layout (std140) uniform CameraBlock
+{
+	mat4 V;
+	mat4 P;
+	mat4 VP;
+	vec4 EyePosition;
+};
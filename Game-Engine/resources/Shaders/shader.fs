@@ -6,31 +6,34 @@ in vec3 lightPos; //Light position in eye coords
 
 layout (location = 0) out vec4 FragColour;
 
-uniform vec3 Kd;            // Diffuse reflectivity
+#include "camera.glsl"
+
+layout (std140) uniform MaterialBlock
+{
+	vec4 Kd;			// Diffuse reflectivity
+	vec4 Ka;			//Ambient reflectivity
+	vec4 Ks;			//Specular refelctivity, w is the specular intensity
+};
+
 uniform vec3 Ld;            // Diffuse light intensity
 
 uniform vec3 Ia;			//Ambient light intensity
-uniform vec3 Ka;			//Ambient reflectivity
-
-uniform vec3 Ep;			//Eye Position
-uniform vec3 Ks;			//Specular refelctivity
-uniform int n;				//Specular intensity
 
 void main() 
 {
 	//Ambient Light
-	vec4 ambient = vec4(Ld * Ka, 1.0);
+	vec4 ambient = vec4(Ld * Ka.rgb, 1.0);
 
 	//Diffuse
 	vec3 L = normalize(lightPos - vertPos); 
 	vec4 diffuse = vec4(Ld,1.0) * max(dot(N,L), 0.0);
-	vec4 diff = vec4(Kd,1.0) * diffuse;
+	vec4 diff = vec4(Kd.rgb,1.0) * diffuse;
 	diffuse = clamp(diffuse, 0.0, 1.0);
 
 	//Specular Lighting
 	vec3 R = reflect(-L, N);
-	vec3 view = normalize(Ep - vertPos);
-	vec4 specular = diffuse * vec4(Ks, 1.0) * pow(max(0,dot(R, view)), n);
+	vec3 view = normalize(EyePosition.xyz - vertPos);
+	vec4 specular = diffuse * vec4(Ks.rgb, 1.0) * pow(max(0,dot(R, view)), Ks.w);
 	
 	//FragColour = ambient;
 	//FragColour = diff;
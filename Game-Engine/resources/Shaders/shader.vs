@@ -7,22 +7,25 @@ out vec3 vertPos; //Vertex position in eye coords
 out vec3 N; //Transformed normal
 out vec3 lightPos; //Light position in eye coords
 
+#include "camera.glsl"
 
+layout (std140) uniform ObjectBlock
+{
+	mat4 M;
+	mat4 ModelView;
+	mat4 NormalMatrix; //Upper 3x3 holds the normal matrix
+};
 
 uniform vec3 LightPosition; // Light position 
-uniform mat3 NormalMatrix;
-uniform mat4 M;
-uniform mat4 V;
-uniform mat4 P;
 
 void main()
 {
 
-   vertPos = vec3(V * M * vec4(VertexPosition,1.0)); 
+   vertPos = vec3(ModelView * vec4(VertexPosition,1.0)); 
      
-   lightPos = vec3(V * M * vec4(LightPosition,1.0));  
+   lightPos = vec3(ModelView * vec4(LightPosition,1.0));  
 
-   N = normalize( NormalMatrix * VertexNormal);
+   N = normalize( mat3(NormalMatrix) * VertexNormal);
       
-   gl_Position = gl_Position = P * V * M * vec4(VertexPosition,1.0);
-}
\ No newline at end of file
+   gl_Position = P * ModelView * vec4(VertexPosition,1.0);
+}
@@ -0,0 +1,332 @@
+/**
+    @file entity-world.cpp
+    @date 18/10/2026
+*/
+
+#include <Engine-Core\entity-world.h>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+namespace EntityInfo
+{
+    std::mutex registryMutex;
+    ComponentInfo components[MAX_COMPONENT_TYPES];
+    int componentCount = 0;
+
+    size_t alignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+/**
+    Registers a component type, called once per type by componentId
+    @param size - sizeof the component
+    @param alignment - alignment of the component
+    @return the new id
+*/
+int ComponentRegistry::registerType(size_t size, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(EntityInfo::registryMutex);
+    if (EntityInfo::componentCount >= MAX_COMPONENT_TYPES)
+    {
+        throw std::runtime_error("Too many component types registered.");
+    }
+
+    ComponentInfo & info = EntityInfo::components[EntityInfo::componentCount];
+    info.size = size;
+    info.alignment = alignment;
+    return EntityInfo::componentCount++;
+}
+
+const ComponentInfo & ComponentRegistry::getInfo(int id)
+{
+    return EntityInfo::components[id];
+}
+
+int ComponentRegistry::getCount()
+{
+    return EntityInfo::componentCount;
+}
+
+/**
+    Lays out the columns of a chunk for the given component set. The capacity is the
+    largest row count for which the entity column and every component column fit.
+    @param mask - component set of the archetype
+*/
+Archetype::Archetype(ComponentMask mask) : m_mask(mask), m_capacity(0)
+{
+    memset(m_offsets, 0, sizeof(m_offsets));
+
+    size_t rowSize = sizeof(Entity);
+    for (int id = 0; id < MAX_COMPONENT_TYPES; id++)
+    {
+        if (mask & (ComponentMask(1) << id))
+        {
+            rowSize += ComponentRegistry::getInfo(id).size;
+        }
+    }
+
+    // Start from the unpadded estimate and shrink until the aligned columns fit
+    for (m_capacity = CHUNK_SIZE / rowSize; m_capacity > 0; m_capacity--)
+    {
+        size_t offset = sizeof(Entity) * m_capacity;
+        for (int id = 0; id < MAX_COMPONENT_TYPES; id++)
+        {
+            if (mask & (ComponentMask(1) << id))
+            {
+                const ComponentInfo & info = ComponentRegistry::getInfo(id);
+                offset = EntityInfo::alignUp(offset, info.alignment);
+                m_offsets[id] = offset;
+                offset += info.size * m_capacity;
+            }
+        }
+
+        if (offset <= CHUNK_SIZE)
+        {
+            break;
+        }
+    }
+
+    if (m_capacity == 0)
+    {
+        throw std::runtime_error("Component set does not fit in a chunk.");
+    }
+}
+
+Archetype::~Archetype()
+{
+    for (size_t i = 0; i < m_chunks.size(); i++)
+    {
+        delete m_chunks[i];
+    }
+}
+
+/**
+    Appends an entity, its components are left for the caller to fill in
+    @param entity
+    @param chunkIndex - receives the chunk the entity landed in
+    @param row - receives the row inside that chunk
+*/
+void Archetype::addRow(Entity entity, size_t & chunkIndex, size_t & row)
+{
+    if (m_chunks.empty() || m_chunks.back()->count == m_capacity)
+    {
+        Chunk * chunk = new Chunk();
+        chunk->count = 0;
+        m_chunks.push_back(chunk);
+    }
+
+    chunkIndex = m_chunks.size() - 1;
+    Chunk * chunk = m_chunks[chunkIndex];
+    row = chunk->count++;
+    getEntities(chunk)[row] = entity;
+}
+
+/**
+    Removes a row by moving the archetype's last row into it, keeping chunks dense
+    @param chunkIndex
+    @param row
+    @return the entity that was moved into the row, or an invalid entity if none was
+*/
+Entity Archetype::removeRow(size_t chunkIndex, size_t row)
+{
+    Chunk * chunk = m_chunks[chunkIndex];
+    Chunk * last = m_chunks.back();
+    size_t lastRow = last->count - 1;
+    Entity moved;
+
+    if (chunk != last || row != lastRow)
+    {
+        moved = getEntities(last)[lastRow];
+        getEntities(chunk)[row] = moved;
+        for (int id = 0; id < MAX_COMPONENT_TYPES; id++)
+        {
+            if (m_mask & (ComponentMask(1) << id))
+            {
+                size_t size = ComponentRegistry::getInfo(id).size;
+                memcpy((char *)getColumn(chunk, id) + row * size, (char *)getColumn(last, id) + lastRow * size, size);
+            }
+        }
+    }
+
+    if (--last->count == 0)
+    {
+        delete last;
+        m_chunks.pop_back();
+    }
+    return moved;
+}
+
+EntityWorld::EntityWorld() : m_entityCount(0)
+{
+
+}
+
+EntityWorld::~EntityWorld()
+{
+    std::map<ComponentMask, Archetype *>::iterator it;
+    for (it = m_archetypes.begin(); it != m_archetypes.end(); ++it)
+    {
+        delete it->second;
+    }
+}
+
+/**
+    Creates an entity without components
+    @return handle to the new entity
+*/
+Entity EntityWorld::create()
+{
+    uint32_t index;
+    if (!m_freeIndices.empty())
+    {
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    }
+    else
+    {
+        index = (uint32_t)m_records.size();
+        EntityRecord record = { NULL, 0, 0, 0 };
+        m_records.push_back(record);
+    }
+
+    EntityRecord & record = m_records[index];
+    Entity entity(index, record.generation);
+    record.archetype = getArchetype(0);
+    record.archetype->addRow(entity, record.chunk, record.row);
+    ++m_entityCount;
+    return entity;
+}
+
+/**
+    Destroys an entity, stale handles to it are ignored from here on
+    @param entity
+*/
+void EntityWorld::destroy(Entity entity)
+{
+    if (!isAlive(entity))
+    {
+        return;
+    }
+
+    EntityRecord & record = m_records[entity.index];
+    Entity moved = record.archetype->removeRow(record.chunk, record.row);
+    onRowMoved(moved, record.chunk, record.row);
+
+    record.archetype = NULL;
+    ++record.generation;
+    m_freeIndices.push_back(entity.index);
+    --m_entityCount;
+}
+
+bool EntityWorld::isAlive(Entity entity) const
+{
+    return entity.index < m_records.size() &&
+        m_records[entity.index].generation == entity.generation &&
+        m_records[entity.index].archetype != NULL;
+}
+
+size_t EntityWorld::getEntityCount() const
+{
+    return m_entityCount;
+}
+
+/**
+    Gets every archetype containing at least the given components. The list is built
+    on first use and kept up to date as archetypes are created.
+    @param mask - required components
+*/
+const std::vector<Archetype *> & EntityWorld::query(ComponentMask mask)
+{
+    std::map<ComponentMask, std::vector<Archetype *> >::iterator cached = m_queries.find(mask);
+    if (cached != m_queries.end())
+    {
+        return cached->second;
+    }
+
+    std::vector<Archetype *> & matches = m_queries[mask];
+    std::map<ComponentMask, Archetype *>::iterator it;
+    for (it = m_archetypes.begin(); it != m_archetypes.end(); ++it)
+    {
+        if ((it->first & mask) == mask)
+        {
+            matches.push_back(it->second);
+        }
+    }
+    return matches;
+}
+
+Archetype * EntityWorld::getArchetype(ComponentMask mask)
+{
+    std::map<ComponentMask, Archetype *>::iterator it = m_archetypes.find(mask);
+    if (it != m_archetypes.end())
+    {
+        return it->second;
+    }
+
+    Archetype * archetype = new Archetype(mask);
+    m_archetypes[mask] = archetype;
+
+    // Add it to the cached queries it satisfies
+    std::map<ComponentMask, std::vector<Archetype *> >::iterator query;
+    for (query = m_queries.begin(); query != m_queries.end(); ++query)
+    {
+        if ((mask & query->first) == query->first)
+        {
+            query->second.push_back(archetype);
+        }
+    }
+    return archetype;
+}
+
+/**
+    Moves an entity to the archetype of a new component set, copying the components
+    both sets share.
+*/
+void EntityWorld::move(Entity entity, ComponentMask mask)
+{
+    EntityRecord & record = m_records[entity.index];
+    Archetype * from = record.archetype;
+    Archetype * to = getArchetype(mask);
+
+    size_t chunk, row;
+    to->addRow(entity, chunk, row);
+
+    Chunk * source = from->getChunk(record.chunk);
+    Chunk * target = to->getChunk(chunk);
+    ComponentMask shared = from->getMask() & mask;
+    for (int id = 0; id < MAX_COMPONENT_TYPES; id++)
+    {
+        if (shared & (ComponentMask(1) << id))
+        {
+            size_t size = ComponentRegistry::getInfo(id).size;
+            memcpy((char *)to->getColumn(target, id) + row * size,
+                (char *)from->getColumn(source, id) + record.row * size, size);
+        }
+    }
+
+    Entity moved = from->removeRow(record.chunk, record.row);
+    onRowMoved(moved, record.chunk, record.row);
+
+    record.archetype = to;
+    record.chunk = chunk;
+    record.row = row;
+}
+
+void * EntityWorld::getComponent(Entity entity, int id)
+{
+    const EntityRecord & record = m_records[entity.index];
+    Chunk * chunk = record.archetype->getChunk(record.chunk);
+    return (char *)record.archetype->getColumn(chunk, id) + record.row * ComponentRegistry::getInfo(id).size;
+}
+
+void EntityWorld::onRowMoved(Entity moved, size_t chunk, size_t row)
+{
+    if (moved.index < m_records.size())
+    {
+        m_records[moved.index].chunk = chunk;
+        m_records[moved.index].row = row;
+    }
+}
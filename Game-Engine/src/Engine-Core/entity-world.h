@@ -0,0 +1,272 @@
+/**
+    @headerfile entity-world.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _ENTITY_WORLD_H
+#define _ENTITY_WORLD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <type_traits>
+#include <vector>
+#include <Engine-Core\job-system.h>
+
+typedef uint64_t ComponentMask; //! One bit per registered component type
+
+const size_t CHUNK_SIZE = 16 * 1024;
+const int MAX_COMPONENT_TYPES = 64;
+
+/**
+    Refers to an entity. The generation changes whenever an index is reused, so a
+    handle to a destroyed entity never reaches the entity that replaced it.
+*/
+struct Entity
+{
+    Entity() : index(0xFFFFFFFF), generation(0) {}
+    Entity(uint32_t i, uint32_t g) : index(i), generation(g) {}
+
+    bool operator==(const Entity & other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity & other) const { return !(*this == other); }
+
+    uint32_t index;
+    uint32_t generation;
+};
+
+struct ComponentInfo
+{
+    size_t size;
+    size_t alignment;
+};
+
+/**
+    Hands out a small integer per component type. Ids are assigned on first use.
+*/
+class ComponentRegistry
+{
+    public:
+        static int registerType(size_t size, size_t alignment);
+        static const ComponentInfo & getInfo(int id);
+        static int getCount();
+};
+
+/**
+    Gets the id of a component type. Components are moved between chunks with memcpy
+    and never destroyed, so they have to be plain data.
+*/
+template<typename T>
+int componentId()
+{
+    static_assert(std::is_trivially_destructible<T>::value, "Components must be plain data");
+    static const int id = ComponentRegistry::registerType(sizeof(T), std::alignment_of<T>::value);
+    return id;
+}
+
+template<typename... Ts>
+ComponentMask componentMask()
+{
+    ComponentMask mask = 0;
+    int ids[] = { 0, componentId<Ts>()... };
+    for (size_t i = 1; i < sizeof(ids) / sizeof(ids[0]); i++)
+    {
+        mask |= ComponentMask(1) << ids[i];
+    }
+    return mask;
+}
+
+/**
+    16 KB block holding up to the archetype's capacity of entities. Each component
+    gets its own contiguous array (structure of arrays), preceded by the entities.
+*/
+struct Chunk
+{
+    unsigned char data[CHUNK_SIZE];
+    size_t count;
+};
+
+/**
+    Storage for every entity with exactly one set of components.
+*/
+class Archetype
+{
+    public:
+        explicit Archetype(ComponentMask mask);
+        ~Archetype();
+
+        ComponentMask getMask() const { return m_mask; }
+        size_t getCapacity() const { return m_capacity; }
+        size_t getChunkCount() const { return m_chunks.size(); }
+        Chunk * getChunk(size_t index) const { return m_chunks[index]; }
+
+        void * getColumn(Chunk * chunk, int componentId) const
+        {
+            return chunk->data + m_offsets[componentId];
+        }
+
+        Entity * getEntities(Chunk * chunk) const
+        {
+            return reinterpret_cast<Entity *>(chunk->data);
+        }
+
+        void addRow(Entity entity, size_t & chunkIndex, size_t & row);
+        Entity removeRow(size_t chunkIndex, size_t row);
+
+    private:
+        ComponentMask m_mask;
+        size_t m_capacity; //! Entities per chunk
+        size_t m_offsets[MAX_COMPONENT_TYPES]; //! Column start in a chunk, per component id
+        std::vector<Chunk *> m_chunks;
+
+        Archetype(const Archetype & other);
+        Archetype & operator=(const Archetype & other);
+};
+
+/**
+    Owns every entity and its components. Entities sharing a component set live in the
+    same archetype, so systems walk tightly packed arrays instead of chasing pointers.
+    Queries cache the archetypes they match and are extended when new ones appear.
+*/
+class EntityWorld
+{
+    public:
+        EntityWorld();
+        ~EntityWorld();
+
+        Entity create();
+        void destroy(Entity entity);
+        bool isAlive(Entity entity) const;
+        size_t getEntityCount() const;
+
+        template<typename T>
+        void add(Entity entity, const T & component)
+        {
+            int id = componentId<T>();
+            if (!isAlive(entity))
+            {
+                return;
+            }
+
+            EntityRecord & record = m_records[entity.index];
+            if ((record.archetype->getMask() & (ComponentMask(1) << id)) == 0)
+            {
+                move(entity, record.archetype->getMask() | (ComponentMask(1) << id));
+            }
+            *static_cast<T *>(getComponent(entity, id)) = component;
+        }
+
+        template<typename T>
+        void remove(Entity entity)
+        {
+            int id = componentId<T>();
+            if (has<T>(entity))
+            {
+                move(entity, m_records[entity.index].archetype->getMask() & ~(ComponentMask(1) << id));
+            }
+        }
+
+        template<typename T>
+        bool has(Entity entity) const
+        {
+            return isAlive(entity) &&
+                (m_records[entity.index].archetype->getMask() & (ComponentMask(1) << componentId<T>())) != 0;
+        }
+
+        //! @return NULL when the entity is dead or lacks the component
+        template<typename T>
+        T * get(Entity entity)
+        {
+            return has<T>(entity) ? static_cast<T *>(getComponent(entity, componentId<T>())) : NULL;
+        }
+
+        /**
+            Calls fn(Ts &...) for every entity that has all of Ts.
+        */
+        template<typename... Ts, typename F>
+        void forEach(F fn)
+        {
+            const std::vector<Archetype *> & archetypes = query(componentMask<Ts...>());
+            for (size_t a = 0; a < archetypes.size(); a++)
+            {
+                Archetype * archetype = archetypes[a];
+                for (size_t c = 0; c < archetype->getChunkCount(); c++)
+                {
+                    Chunk * chunk = archetype->getChunk(c);
+                    iterateChunk(fn, chunk->count, static_cast<Ts *>(archetype->getColumn(chunk, componentId<Ts>()))...);
+                }
+            }
+        }
+
+        /**
+            Same as forEach, with chunks spread over the job system's threads. fn must
+            only touch the components it is given.
+        */
+        template<typename... Ts, typename F>
+        void parallelForEach(F fn)
+        {
+            std::vector<std::pair<Archetype *, Chunk *> > chunks;
+            const std::vector<Archetype *> & archetypes = query(componentMask<Ts...>());
+            for (size_t a = 0; a < archetypes.size(); a++)
+            {
+                for (size_t c = 0; c < archetypes[a]->getChunkCount(); c++)
+                {
+                    chunks.push_back(std::make_pair(archetypes[a], archetypes[a]->getChunk(c)));
+                }
+            }
+
+            JobSystem * jobs = JobSystem::get();
+            if (!jobs || chunks.size() < 2)
+            {
+                forEach<Ts...>(fn);
+                return;
+            }
+
+            jobs->parallelFor(chunks.size(), 1, [&chunks, &fn](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; i++)
+                {
+                    Archetype * archetype = chunks[i].first;
+                    Chunk * chunk = chunks[i].second;
+                    iterateChunk(fn, chunk->count, static_cast<Ts *>(archetype->getColumn(chunk, componentId<Ts>()))...);
+                }
+            });
+        }
+
+        const std::vector<Archetype *> & query(ComponentMask mask);
+
+    private:
+        struct EntityRecord
+        {
+            Archetype * archetype;
+            size_t chunk;
+            size_t row;
+            uint32_t generation;
+        };
+
+        std::vector<EntityRecord> m_records;
+        std::vector<uint32_t> m_freeIndices;
+        std::map<ComponentMask, Archetype *> m_archetypes;
+        std::map<ComponentMask, std::vector<Archetype *> > m_queries;
+        size_t m_entityCount;
+
+        Archetype * getArchetype(ComponentMask mask);
+        void move(Entity entity, ComponentMask mask);
+        void * getComponent(Entity entity, int id);
+        void onRowMoved(Entity moved, size_t chunk, size_t row);
+
+        template<typename F, typename... Ts>
+        static void iterateChunk(F & fn, size_t count, Ts *... columns)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                fn(columns[i]...);
+            }
+        }
+
+        EntityWorld(const EntityWorld & other);
+        EntityWorld & operator=(const EntityWorld & other);
+};
+
+#endif // !_ENTITY_WORLD_H
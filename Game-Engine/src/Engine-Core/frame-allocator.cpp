@@ -0,0 +1,208 @@
+/**
+    @file frame-allocator.cpp
+    @date 18/10/2026
+*/
+
+#include <Engine-Core\frame-allocator.h>
+#include <cassert>
+#include <memory>
+#include <new>
+
+namespace AllocatorInfo
+{
+    const size_t SCRATCH_CAPACITY = 256 * 1024; //! Per thread
+
+    thread_local std::unique_ptr<ScratchStack> scratch;
+
+    /**
+        Rounds an address up to a power of two alignment
+    */
+    inline void * alignPointer(void * pointer, size_t alignment)
+    {
+        uintptr_t address = (uintptr_t)pointer;
+        return (void *)((address + alignment - 1) & ~(uintptr_t)(alignment - 1));
+    }
+}
+
+FrameAllocator * FrameAllocator::s_instance = NULL;
+
+/**
+    Creates the allocator frame containers take their memory from
+    @param capacity - bytes per frame, two arenas of this size are kept
+*/
+FrameAllocator::FrameAllocator(size_t capacity) : m_current(0)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        m_arenas[i].memory.resize(capacity);
+        m_arenas[i].offset = 0;
+        m_arenas[i].overflowBytes = 0;
+    }
+    m_stats.used = 0;
+    m_stats.overflow = 0;
+    m_stats.peak = 0;
+
+    s_instance = this;
+}
+
+FrameAllocator::~FrameAllocator()
+{
+    reset(m_arenas[0]);
+    reset(m_arenas[1]);
+
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+FrameAllocator * FrameAllocator::get()
+{
+    assert(s_instance && "frame memory is used without a FrameAllocator");
+    return s_instance;
+}
+
+/**
+    Takes memory valid until the end of the next frame, safe from any thread
+    @param size - bytes
+    @param alignment - power of two
+*/
+void * FrameAllocator::allocate(size_t size, size_t alignment)
+{
+    Arena & arena = m_arenas[m_current];
+
+    // Reserve enough to align within, there are no locks to align the offset itself
+    size_t reserve = size + alignment - 1;
+    size_t start = arena.offset.fetch_add(reserve, std::memory_order_relaxed);
+    if (start + reserve <= arena.memory.size())
+    {
+        return AllocatorInfo::alignPointer(&arena.memory[start], alignment);
+    }
+
+    void * block = ::operator new(reserve);
+    arena.overflowBytes.fetch_add(reserve, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        arena.overflow.push_back(block);
+    }
+    return AllocatorInfo::alignPointer(block, alignment);
+}
+
+/**
+    Marks a frame boundary. Memory from the frame before last is released, memory from
+    the frame that just ended stays valid for one more. No allocations may be in flight.
+*/
+void FrameAllocator::nextFrame()
+{
+    Arena & finished = m_arenas[m_current];
+    size_t offset = finished.offset.load(std::memory_order_relaxed);
+    m_stats.used = offset < finished.memory.size() ? offset : finished.memory.size();
+    m_stats.overflow = finished.overflowBytes.load(std::memory_order_relaxed);
+    if (m_stats.used + m_stats.overflow > m_stats.peak)
+    {
+        m_stats.peak = m_stats.used + m_stats.overflow;
+    }
+
+    m_current ^= 1;
+    reset(m_arenas[m_current]);
+}
+
+const FrameMemoryStats & FrameAllocator::getStats() const
+{
+    return m_stats;
+}
+
+void FrameAllocator::reset(Arena & arena)
+{
+    for (size_t i = 0; i < arena.overflow.size(); i++)
+    {
+        ::operator delete(arena.overflow[i]);
+    }
+    arena.overflow.clear();
+    arena.offset.store(0, std::memory_order_relaxed);
+    arena.overflowBytes.store(0, std::memory_order_relaxed);
+}
+
+/**
+    @param capacity - bytes available before falling back to the heap
+*/
+ScratchStack::ScratchStack(size_t capacity) : m_memory(capacity), m_offset(0), m_peak(0)
+{
+
+}
+
+ScratchStack::~ScratchStack()
+{
+    rewind(0, 0);
+}
+
+/**
+    Gets the calling thread's stack, created on first use
+*/
+ScratchStack & ScratchStack::get()
+{
+    if (!AllocatorInfo::scratch)
+    {
+        AllocatorInfo::scratch.reset(new ScratchStack(AllocatorInfo::SCRATCH_CAPACITY));
+    }
+    return *AllocatorInfo::scratch;
+}
+
+/**
+    Takes memory valid until the enclosing ScratchScope closes
+    @param size - bytes
+    @param alignment - power of two
+*/
+void * ScratchStack::allocate(size_t size, size_t alignment)
+{
+    unsigned char * base = m_memory.data();
+    unsigned char * aligned = (unsigned char *)AllocatorInfo::alignPointer(base + m_offset, alignment);
+    size_t end = (aligned - base) + size;
+    if (end <= m_memory.size())
+    {
+        m_offset = end;
+        if (m_offset > m_peak)
+        {
+            m_peak = m_offset;
+        }
+        return aligned;
+    }
+
+    void * block = ::operator new(size + alignment - 1);
+    m_overflow.push_back(block);
+    return AllocatorInfo::alignPointer(block, alignment);
+}
+
+size_t ScratchStack::getUsed() const
+{
+    return m_offset;
+}
+
+size_t ScratchStack::getPeak() const
+{
+    return m_peak;
+}
+
+/**
+    Releases everything taken after the given position
+*/
+void ScratchStack::rewind(size_t offset, size_t numOverflow)
+{
+    while (m_overflow.size() > numOverflow)
+    {
+        ::operator delete(m_overflow.back());
+        m_overflow.pop_back();
+    }
+    m_offset = offset;
+}
+
+ScratchScope::ScratchScope() : m_stack(ScratchStack::get())
+{
+    m_offset = m_stack.m_offset;
+    m_numOverflow = m_stack.m_overflow.size();
+}
+
+ScratchScope::~ScratchScope()
+{
+    m_stack.rewind(m_offset, m_numOverflow);
+}
@@ -0,0 +1,182 @@
+/**
+    @headerfile frame-allocator.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _FRAME_ALLOCATOR_H
+#define _FRAME_ALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+const size_t DEFAULT_ALIGNMENT = 16; //! Enough for SSE loads and every scalar type
+
+//! Frame arena use, see FrameAllocator::getStats.
+struct FrameMemoryStats
+{
+    size_t used; //! Bytes taken during the last frame
+    size_t overflow; //! Bytes of the last frame that did not fit and came from the heap
+    size_t peak; //! Most bytes any frame has taken so far
+};
+
+/**
+    Bump allocator for data that lives for a frame. Allocating is one atomic add, so
+    jobs on any thread may use it, and nothing is ever freed on its own: the whole
+    arena is reset at a frame boundary.
+
+    Two arenas take turns, memory handed out during a frame stays valid until the end
+    of the next one so the render thread can consume what the simulation produced.
+    Requests that do not fit fall back to the heap and are released with the arena;
+    the stats show how much, raise the capacity if it is not zero.
+*/
+class FrameAllocator
+{
+    public:
+        explicit FrameAllocator(size_t capacity = 4 * 1024 * 1024);
+        ~FrameAllocator();
+
+        static FrameAllocator * get();
+
+        void * allocate(size_t size, size_t alignment = DEFAULT_ALIGNMENT);
+        void nextFrame();
+
+        const FrameMemoryStats & getStats() const;
+
+    private:
+        struct Arena
+        {
+            std::vector<unsigned char> memory;
+            std::atomic<size_t> offset;
+            std::atomic<size_t> overflowBytes;
+            std::vector<void *> overflow; //! Heap blocks handed out once the arena was full
+        };
+
+        static FrameAllocator * s_instance;
+
+        Arena m_arenas[2];
+        int m_current; //! Arena of the frame being built
+        std::mutex m_overflowMutex;
+        FrameMemoryStats m_stats;
+
+        FrameAllocator(const FrameAllocator &);
+        FrameAllocator & operator=(const FrameAllocator &);
+
+        void reset(Arena & arena);
+};
+
+/**
+    Per thread stack of scratch memory for temporaries inside a function. Take what is
+    needed inside a ScratchScope, everything taken since the scope opened is released
+    when it closes, innermost scope first. Like the frame arena, requests that do not
+    fit come from the heap.
+*/
+class ScratchStack
+{
+    public:
+        explicit ScratchStack(size_t capacity);
+        ~ScratchStack();
+
+        static ScratchStack & get();
+
+        void * allocate(size_t size, size_t alignment = DEFAULT_ALIGNMENT);
+
+        size_t getUsed() const;
+        size_t getPeak() const;
+
+    private:
+        friend class ScratchScope;
+
+        std::vector<unsigned char> m_memory;
+        size_t m_offset;
+        size_t m_peak;
+        std::vector<void *> m_overflow;
+
+        ScratchStack(const ScratchStack &);
+        ScratchStack & operator=(const ScratchStack &);
+
+        void rewind(size_t offset, size_t numOverflow);
+};
+
+/**
+    Releases the calling thread's scratch memory taken while it is alive
+*/
+class ScratchScope
+{
+    public:
+        ScratchScope();
+        ~ScratchScope();
+
+    private:
+        ScratchStack & m_stack;
+        size_t m_offset;
+        size_t m_numOverflow;
+
+        ScratchScope(const ScratchScope &);
+        ScratchScope & operator=(const ScratchScope &);
+};
+
+/**
+    Standard library allocator taking memory from the frame arena, for containers that
+    are built and thrown away within a frame. Freeing does nothing.
+*/
+template <typename T>
+class FrameStlAllocator
+{
+    public:
+        typedef T value_type;
+
+        FrameStlAllocator() {}
+        template <typename U>
+        FrameStlAllocator(const FrameStlAllocator<U> &) {}
+
+        T * allocate(size_t n)
+        {
+            return (T *)FrameAllocator::get()->allocate(n * sizeof(T), alignof(T) > DEFAULT_ALIGNMENT ? alignof(T) : DEFAULT_ALIGNMENT);
+        }
+        void deallocate(T *, size_t) {}
+
+        template <typename U>
+        bool operator==(const FrameStlAllocator<U> &) const { return true; }
+        template <typename U>
+        bool operator!=(const FrameStlAllocator<U> &) const { return false; }
+};
+
+/**
+    Standard library allocator taking memory from the calling thread's scratch stack.
+    The container must be destroyed before the enclosing ScratchScope closes, and must
+    stay on the thread that created it.
+*/
+template <typename T>
+class ScratchStlAllocator
+{
+    public:
+        typedef T value_type;
+
+        ScratchStlAllocator() {}
+        template <typename U>
+        ScratchStlAllocator(const ScratchStlAllocator<U> &) {}
+
+        T * allocate(size_t n)
+        {
+            return (T *)ScratchStack::get().allocate(n * sizeof(T), alignof(T) > DEFAULT_ALIGNMENT ? alignof(T) : DEFAULT_ALIGNMENT);
+        }
+        void deallocate(T *, size_t) {}
+
+        template <typename U>
+        bool operator==(const ScratchStlAllocator<U> &) const { return true; }
+        template <typename U>
+        bool operator!=(const ScratchStlAllocator<U> &) const { return false; }
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameStlAllocator<T>>;
+
+template <typename T>
+using ScratchVector = std::vector<T, ScratchStlAllocator<T>>;
+
+#endif // !_FRAME_ALLOCATOR_H
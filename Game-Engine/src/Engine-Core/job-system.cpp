@@ -0,0 +1,575 @@
+/**
+    @file job-system.cpp
+    @date 18/10/2026
+*/
+
+#include <Engine-Core\job-system.h>
+#include <Engine-Core\profiler.h>
+#include <algorithm>
+#include <chrono>
+
+namespace JobInfo
+{
+    const size_t DEQUE_CAPACITY = 4096; // Per thread, must be a power of two
+    const size_t EXTERNAL_POOL_SIZE = 1024;
+    const int SPINS_BEFORE_SLEEP = 64;
+
+    thread_local int threadIndex = -1; // -1 for threads the scheduler does not own
+    thread_local uint32_t stealSeed = 0;
+}
+
+JobSystem * JobSystem::s_instance = NULL;
+
+/**
+    Creates an empty deque
+    @param capacity - rounded up to a power of two
+*/
+JobDeque::JobDeque(size_t capacity) : m_top(0), m_bottom(0)
+{
+    size_t size = 1;
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+
+    m_jobs = std::vector<std::atomic<Job *> >(size);
+    m_mask = (int64_t)size - 1;
+}
+
+/**
+    Pushes a job at the bottom, owner thread only.
+    @return false when the deque is full
+*/
+bool JobDeque::push(Job * job)
+{
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t top = m_top.load(std::memory_order_acquire);
+    if (bottom - top > m_mask)
+    {
+        return false;
+    }
+
+    m_jobs[bottom & m_mask].store(job, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+    Pops the most recently pushed job, owner thread only.
+    @return NULL when empty or when a thief won the last job
+*/
+Job * JobDeque::pop()
+{
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        // Already empty, restore
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return NULL;
+    }
+
+    Job * job = m_jobs[bottom & m_mask].load(std::memory_order_relaxed);
+    if (top == bottom)
+    {
+        // Last job, race the thieves for it
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            job = NULL;
+        }
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+/**
+    Takes the oldest job, callable from any thread.
+    @return NULL when empty or when another thread got there first
+*/
+Job * JobDeque::steal()
+{
+    int64_t top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return NULL;
+    }
+
+    Job * job = m_jobs[top & m_mask].load(std::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return NULL;
+    }
+    return job;
+}
+
+JobSystem::ThreadContext::ThreadContext() :
+    deque(JobInfo::DEQUE_CAPACITY), jobPool(JobInfo::DEQUE_CAPACITY), nextJob(0)
+{
+    for (size_t i = 0; i < jobPool.size(); i++)
+    {
+        jobPool[i].inUse.store(false, std::memory_order_relaxed);
+    }
+}
+
+/**
+    Starts the worker threads. The calling thread becomes the main lane.
+    @param numWorkers - worker threads to start, 0 uses one per remaining core
+*/
+JobSystem::JobSystem(unsigned int numWorkers) :
+    m_running(true), m_externalPool(JobInfo::EXTERNAL_POOL_SIZE), m_nextExternalJob(0),
+    m_sleepingWorkers(0), m_queuedJobs(0)
+{
+    if (numWorkers == 0)
+    {
+        unsigned int cores = std::thread::hardware_concurrency();
+        numWorkers = cores > 1 ? cores - 1 : 1;
+    }
+
+    for (size_t i = 0; i < m_externalPool.size(); i++)
+    {
+        m_externalPool[i].inUse.store(false, std::memory_order_relaxed);
+    }
+
+    for (unsigned int i = 0; i <= numWorkers; i++)
+    {
+        m_contexts.push_back(new ThreadContext());
+    }
+
+    JobInfo::threadIndex = 0;
+    JobInfo::stealSeed = 1;
+    s_instance = this;
+
+    for (unsigned int i = 1; i <= numWorkers; i++)
+    {
+        m_workers.push_back(std::thread(&JobSystem::workerLoop, this, (int)i));
+    }
+}
+
+/**
+    Stops and joins the workers. Jobs still queued are not run.
+*/
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_running.store(false);
+    }
+    m_wakeCondition.notify_all();
+
+    for (size_t i = 0; i < m_workers.size(); i++)
+    {
+        m_workers[i].join();
+    }
+
+    for (size_t i = 0; i < m_contexts.size(); i++)
+    {
+        delete m_contexts[i];
+    }
+
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+/**
+    Gets the scheduler created by the engine
+    @return NULL before the window manager has started it
+*/
+JobSystem * JobSystem::get()
+{
+    return s_instance;
+}
+
+/**
+    Queues a task on the calling thread's deque, where idle workers can steal it.
+    @param task
+    @param counter - incremented now and decremented when the task is done, may be NULL
+    @param dependency - the task is not queued before this counter reaches zero, may be NULL
+*/
+void JobSystem::run(const std::function<void()> & task, JobCounter * counter, JobCounter * dependency)
+{
+    if (counter)
+    {
+        counter->m_value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Job * job = allocateJob();
+    job->task = task;
+    job->counter = counter;
+    job->dependency = dependency;
+    if (!park(job))
+    {
+        submit(job);
+    }
+}
+
+/**
+    Blocks until the counter reaches zero. The waiting thread keeps running other
+    jobs meanwhile, on the main thread that includes main lane jobs.
+    @param counter
+*/
+void JobSystem::wait(JobCounter * counter)
+{
+    int index = JobInfo::threadIndex;
+    while (!counter->isDone())
+    {
+        if (index == 0)
+        {
+            processMainThreadJobs();
+        }
+        if (index < 0 || !executeNext(index))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+    Splits [0, count) into batches and runs body(begin, end) for each as a job.
+    @param count - number of elements
+    @param batchSize - elements per job, 0 picks a size that gives each thread a few batches
+    @param body
+    @param counter - when NULL the call waits for all batches, otherwise it returns at once
+*/
+void JobSystem::parallelFor(size_t count, size_t batchSize,
+    const std::function<void(size_t, size_t)> & body, JobCounter * counter)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (batchSize == 0)
+    {
+        size_t batches = getThreadCount() * 4;
+        batchSize = std::max<size_t>(1, (count + batches - 1) / batches);
+    }
+
+    JobCounter localCounter;
+    JobCounter * groupCounter = counter ? counter : &localCounter;
+
+    for (size_t begin = 0; begin < count; begin += batchSize)
+    {
+        size_t end = std::min(begin + batchSize, count);
+        run([body, begin, end]() { body(begin, end); }, groupCounter);
+    }
+
+    if (!counter)
+    {
+        wait(&localCounter);
+    }
+}
+
+/**
+    Queues a task that may only run on the main thread, e.g. because it touches GL.
+    @param task
+    @param counter - may be NULL
+*/
+void JobSystem::runOnMainThread(const std::function<void()> & task, JobCounter * counter)
+{
+    if (counter)
+    {
+        counter->m_value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    MainThreadJob job;
+    job.task = task;
+    job.counter = counter;
+
+    std::lock_guard<std::mutex> lock(m_mainMutex);
+    m_mainJobs.push_back(job);
+}
+
+/**
+    Runs every main lane job queued so far. Called by the main loop once per frame.
+*/
+void JobSystem::processMainThreadJobs()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mainMutex);
+        if (m_mainJobs.empty())
+        {
+            return;
+        }
+        m_mainJobsRunning.swap(m_mainJobs);
+    }
+
+    for (size_t i = 0; i < m_mainJobsRunning.size(); i++)
+    {
+        m_mainJobsRunning[i].task();
+        finish(m_mainJobsRunning[i].counter);
+    }
+    m_mainJobsRunning.clear();
+}
+
+/**
+    Checks whether the caller is the thread that owns the GL context
+*/
+bool JobSystem::isMainThread() const
+{
+    return JobInfo::threadIndex == 0;
+}
+
+/**
+    Gets the number of threads running jobs, main thread included
+*/
+unsigned int JobSystem::getThreadCount() const
+{
+    return (unsigned int)m_contexts.size();
+}
+
+/**
+    Gets the caller's thread index, 0 for the main thread and -1 for foreign threads
+*/
+int JobSystem::getThreadIndex() const
+{
+    return JobInfo::threadIndex;
+}
+
+void JobSystem::workerLoop(int threadIndex)
+{
+    JobInfo::threadIndex = threadIndex;
+    JobInfo::stealSeed = (uint32_t)threadIndex * 2654435761u + 1;
+
+    if (Profiler::get())
+    {
+        Profiler::get()->setThreadName(("Worker " + std::to_string(threadIndex)).c_str());
+    }
+
+    int idleSpins = 0;
+    while (m_running.load(std::memory_order_relaxed))
+    {
+        if (executeNext(threadIndex))
+        {
+            idleSpins = 0;
+            continue;
+        }
+
+        if (++idleSpins < JobInfo::SPINS_BEFORE_SLEEP)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Nothing to do for a while, sleep until a job is queued
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_sleepingWorkers.fetch_add(1);
+        m_wakeCondition.wait_for(lock, std::chrono::milliseconds(2), [this]()
+        {
+            return m_queuedJobs.load() > 0 || !m_running.load();
+        });
+        m_sleepingWorkers.fetch_sub(1);
+        idleSpins = 0;
+    }
+}
+
+/**
+    Takes the next free job slot. Slots are recycled in ring order, if the oldest one
+    is still queued the caller helps out until it has been run.
+*/
+Job * JobSystem::allocateJob()
+{
+    int index = JobInfo::threadIndex;
+    if (index < 0)
+    {
+        for (;;)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_externalMutex);
+                Job * job = &m_externalPool[m_nextExternalJob];
+                if (!job->inUse.load(std::memory_order_acquire))
+                {
+                    m_nextExternalJob = (m_nextExternalJob + 1) % m_externalPool.size();
+                    job->inUse.store(true, std::memory_order_relaxed);
+                    return job;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    ThreadContext * context = m_contexts[index];
+    Job * job = &context->jobPool[context->nextJob];
+    while (job->inUse.load(std::memory_order_acquire))
+    {
+        if (!executeNext(index))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    context->nextJob = (context->nextJob + 1) % context->jobPool.size();
+    job->inUse.store(true, std::memory_order_relaxed);
+    return job;
+}
+
+void JobSystem::submit(Job * job)
+{
+    int index = JobInfo::threadIndex;
+    m_queuedJobs.fetch_add(1, std::memory_order_release);
+
+    if (index < 0)
+    {
+        std::lock_guard<std::mutex> lock(m_externalMutex);
+        m_externalJobs.push_back(job);
+    }
+    else if (!m_contexts[index]->deque.push(job))
+    {
+        // Deque is full, running the job right here keeps the producer from outrunning everyone
+        m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        while (job->dependency && !job->dependency->isDone())
+        {
+            executeNext(index);
+        }
+        execute(job);
+        return;
+    }
+
+    if (m_sleepingWorkers.load(std::memory_order_relaxed) > 0)
+    {
+        m_wakeCondition.notify_one();
+    }
+}
+
+Job * JobSystem::findJob(int threadIndex)
+{
+    Job * job = m_contexts[threadIndex]->deque.pop();
+    if (job)
+    {
+        return job;
+    }
+
+    // Own deque is empty, pick a random victim to steal from
+    size_t numThreads = m_contexts.size();
+    uint32_t & seed = JobInfo::stealSeed;
+    for (size_t attempt = 0; attempt < numThreads; attempt++)
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+
+        size_t victim = seed % numThreads;
+        if ((int)victim == threadIndex)
+        {
+            continue;
+        }
+
+        job = m_contexts[victim]->deque.steal();
+        if (job)
+        {
+            return job;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_externalMutex);
+    if (!m_externalJobs.empty())
+    {
+        job = m_externalJobs.back();
+        m_externalJobs.pop_back();
+        return job;
+    }
+    return NULL;
+}
+
+/**
+    Runs one job if any can be found.
+    @return false when there was nothing to run
+*/
+bool JobSystem::executeNext(int threadIndex)
+{
+    Job * job = findJob(threadIndex);
+    if (!job)
+    {
+        return false;
+    }
+
+    m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+
+    if (park(job))
+    {
+        // The dependency was started again after the job was released
+        return true;
+    }
+
+    execute(job);
+    return true;
+}
+
+void JobSystem::execute(Job * job)
+{
+    JobCounter * counter = job->counter;
+    {
+        PROFILE_SCOPE("job");
+        job->task();
+    }
+    job->task = nullptr;
+    job->inUse.store(false, std::memory_order_release);
+    finish(counter);
+}
+
+void JobSystem::finish(JobCounter * counter)
+{
+    if (counter && counter->m_value.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        release(counter);
+    }
+}
+
+/**
+    Holds a job back until its dependency is done, instead of queueing it where it
+    would be picked up and put back again
+    @return false if the job can run now
+*/
+bool JobSystem::park(Job * job)
+{
+    if (!job->dependency || job->dependency->isDone())
+    {
+        return false;
+    }
+
+    // Checked again under the lock, release takes it after the counter reaches zero
+    std::lock_guard<std::mutex> lock(m_parkedMutex);
+    if (job->dependency->isDone())
+    {
+        return false;
+    }
+    m_parkedJobs.push_back(job);
+    return true;
+}
+
+/**
+    Queues the jobs parked on a counter that just reached zero
+*/
+void JobSystem::release(JobCounter * counter)
+{
+    std::vector<Job *> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_parkedMutex);
+        for (size_t i = 0; i < m_parkedJobs.size();)
+        {
+            if (m_parkedJobs[i]->dependency == counter)
+            {
+                ready.push_back(m_parkedJobs[i]);
+                m_parkedJobs[i] = m_parkedJobs.back();
+                m_parkedJobs.pop_back();
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < ready.size(); i++)
+    {
+        submit(ready[i]);
+    }
+}
@@ -0,0 +1,152 @@
+/**
+    @headerfile job-system.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _JOB_SYSTEM_H
+#define _JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+    Counts the jobs of a group that have not finished yet. The group is complete
+    once the counter is back at zero, other jobs can be made to depend on it.
+*/
+class JobCounter
+{
+    public:
+        JobCounter() : m_value(0) {}
+
+        int  value() const { return m_value.load(std::memory_order_acquire); }
+        bool isDone() const { return value() == 0; }
+
+    private:
+        friend class JobSystem;
+        std::atomic<int> m_value;
+
+        // Jobs hold a pointer to the counter, so it must not move
+        JobCounter(const JobCounter & other);
+        JobCounter & operator=(const JobCounter & other);
+};
+
+struct Job
+{
+    std::function<void()> task;
+    JobCounter * counter;    //! Decremented once the task has run, may be NULL.
+    JobCounter * dependency; //! The job is parked until this reaches zero, may be NULL.
+    std::atomic<bool> inUse; //! Set while the slot is queued or running.
+};
+
+/**
+    Chase-Lev work-stealing deque. The owning thread pushes and pops at the bottom,
+    any other thread steals from the top. Capacity is fixed and a power of two.
+*/
+class JobDeque
+{
+    public:
+        explicit JobDeque(size_t capacity);
+
+        bool push(Job * job);
+        Job * pop();
+        Job * steal();
+
+    private:
+        std::atomic<int64_t> m_top;
+        std::atomic<int64_t> m_bottom;
+        std::vector<std::atomic<Job *> > m_jobs;
+        int64_t m_mask;
+};
+
+/**
+    Engine-wide task scheduler. One worker per remaining core runs jobs from its own
+    deque and steals from the others when it runs dry. The thread that created the
+    scheduler is the main lane: it owns the GL context, takes part in work while it
+    waits, and is the only thread that runs jobs queued with runOnMainThread.
+*/
+class JobSystem
+{
+    public:
+        explicit JobSystem(unsigned int numWorkers = 0);
+        ~JobSystem();
+
+        static JobSystem * get();
+
+        void run(const std::function<void()> & task, JobCounter * counter = NULL,
+            JobCounter * dependency = NULL);
+        void wait(JobCounter * counter);
+
+        void parallelFor(size_t count, size_t batchSize,
+            const std::function<void(size_t, size_t)> & body, JobCounter * counter = NULL);
+
+        void runOnMainThread(const std::function<void()> & task, JobCounter * counter = NULL);
+        void processMainThreadJobs();
+
+        bool isMainThread() const;
+        unsigned int getThreadCount() const;
+        int  getThreadIndex() const;
+
+    private:
+        struct ThreadContext
+        {
+            ThreadContext();
+
+            JobDeque deque;
+            std::vector<Job> jobPool; //! Ring of job slots owned by this thread
+            size_t nextJob;
+        };
+
+        static JobSystem * s_instance;
+
+        std::vector<ThreadContext *> m_contexts; //! Index 0 is the main thread
+        std::vector<std::thread> m_workers;
+        std::atomic<bool> m_running;
+
+        // Jobs submitted from threads the scheduler does not own
+        std::mutex m_externalMutex;
+        std::vector<Job *> m_externalJobs;
+        std::vector<Job> m_externalPool;
+        size_t m_nextExternalJob;
+
+        // Work that has to run on the thread owning the GL context
+        struct MainThreadJob
+        {
+            std::function<void()> task;
+            JobCounter * counter;
+        };
+        std::mutex m_mainMutex;
+        std::vector<MainThreadJob> m_mainJobs;
+        std::vector<MainThreadJob> m_mainJobsRunning;
+
+        // Jobs whose dependency has not finished, queued by the job that finishes it
+        std::mutex m_parkedMutex;
+        std::vector<Job *> m_parkedJobs;
+
+        // Idle workers sleep here until new work arrives
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeCondition;
+        std::atomic<int> m_sleepingWorkers;
+        std::atomic<int> m_queuedJobs;
+
+        void workerLoop(int threadIndex);
+        Job * allocateJob();
+        void submit(Job * job);
+        Job * findJob(int threadIndex);
+        bool executeNext(int threadIndex);
+        void execute(Job * job);
+        void finish(JobCounter * counter);
+        bool park(Job * job);
+        void release(JobCounter * counter);
+
+        JobSystem(const JobSystem & other);
+        JobSystem & operator=(const JobSystem & other);
+};
+
+#endif // !_JOB_SYSTEM_H
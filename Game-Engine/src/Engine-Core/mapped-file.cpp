@@ -0,0 +1,148 @@
+/**
+    @file mapped-file.cpp
+    @date 18/10/2026
+*/
+
+#include <Engine-Core\mapped-file.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+MappedFile::MappedFile() :
+    m_data(NULL), m_size(0), m_file(INVALID_HANDLE_VALUE), m_mapping(NULL)
+{
+}
+#else
+MappedFile::MappedFile() :
+    m_data(NULL), m_size(0), m_file(-1)
+{
+}
+#endif
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+/**
+    Maps a file, replacing any file mapped before
+    @param fileName - file to map
+    @return false if the file is missing, empty or cannot be mapped
+*/
+bool MappedFile::open(const std::string & fileName)
+{
+    close();
+
+#ifdef _WIN32
+    m_file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (m_file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file, &size) || size.QuadPart <= 0 || (unsigned long long)size.QuadPart > (size_t)-1)
+    {
+        close();
+        return false;
+    }
+    m_size = (size_t)size.QuadPart;
+
+    m_mapping = CreateFileMappingA(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!m_mapping)
+    {
+        close();
+        return false;
+    }
+    m_data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+#else
+    m_file = ::open(fileName.c_str(), O_RDONLY);
+    if (m_file < 0)
+    {
+        return false;
+    }
+
+    struct stat status;
+    if (fstat(m_file, &status) != 0 || status.st_size <= 0)
+    {
+        close();
+        return false;
+    }
+    m_size = (size_t)status.st_size;
+
+    void * data = mmap(NULL, m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+    m_data = data == MAP_FAILED ? NULL : data;
+    if (m_data)
+    {
+        // The whole file is read front to back soon after, start reading ahead now
+        madvise(data, m_size, MADV_WILLNEED);
+    }
+#endif
+
+    if (!m_data)
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
+/**
+    Unmaps the file, pointers into it are invalid afterwards
+*/
+void MappedFile::close()
+{
+#ifdef _WIN32
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapping)
+    {
+        CloseHandle(m_mapping);
+    }
+    if (m_file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_file);
+    }
+    m_mapping = NULL;
+    m_file = INVALID_HANDLE_VALUE;
+#else
+    if (m_data)
+    {
+        munmap(const_cast<void *>(m_data), m_size);
+    }
+    if (m_file >= 0)
+    {
+        ::close(m_file);
+    }
+    m_file = -1;
+#endif
+    m_data = NULL;
+    m_size = 0;
+}
+
+bool MappedFile::isOpen() const
+{
+    return m_data != NULL;
+}
+
+const void * MappedFile::getData() const
+{
+    return m_data;
+}
+
+size_t MappedFile::getSize() const
+{
+    return m_size;
+}
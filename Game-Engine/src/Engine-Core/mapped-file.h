@@ -0,0 +1,46 @@
+/**
+    @headerfile mapped-file.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _MAPPED_FILE_H
+#define _MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+/**
+    A whole file mapped read only into the address space. Pages are read by the OS as
+    they are first touched, so handing the mapping straight to a copy costs one pass
+    over the bytes and nothing is parsed or buffered on the way.
+*/
+class MappedFile
+{
+    public:
+        MappedFile();
+        ~MappedFile();
+
+        bool open(const std::string & fileName);
+        void close();
+
+        bool isOpen() const;
+        const void * getData() const;
+        size_t getSize() const;
+
+    private:
+        const void * m_data;
+        size_t m_size;
+#ifdef _WIN32
+        void * m_file; //! HANDLE of the file
+        void * m_mapping; //! HANDLE of the file mapping object
+#else
+        int m_file;
+#endif
+
+        MappedFile(const MappedFile &);
+        MappedFile & operator=(const MappedFile &);
+};
+
+#endif // !_MAPPED_FILE_H
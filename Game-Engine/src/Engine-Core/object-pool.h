@@ -0,0 +1,159 @@
+/**
+    @headerfile object-pool.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _OBJECT_POOL_H
+#define _OBJECT_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+    Refers to an object in an ObjectPool<T>. Like Entity, the generation changes
+    whenever a slot is reused, so a handle to a destroyed object never reaches the one
+    that replaced it. The type parameter keeps handles of different pools apart.
+*/
+template <typename T>
+struct PoolHandle
+{
+    PoolHandle() : index(0xFFFFFFFF), generation(0) {}
+    PoolHandle(uint32_t i, uint32_t g) : index(i), generation(g) {}
+
+    bool isValid() const { return index != 0xFFFFFFFF; }
+    bool operator==(const PoolHandle & other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const PoolHandle & other) const { return !(*this == other); }
+
+    uint32_t index;
+    uint32_t generation;
+};
+
+/**
+    Fixed number of slots for objects of one type, stored next to each other. Creating
+    and destroying are O(1) through a free list, objects never move, so pointers from
+    get() stay valid until the object is destroyed, and types that cannot be copied fit.
+    Looking up a stale or default handle gives NULL.
+*/
+template <typename T>
+class ObjectPool
+{
+    public:
+        explicit ObjectPool(uint32_t capacity) :
+            m_slots(capacity), m_generations(capacity, 1), m_alive(capacity, 0), m_count(0)
+        {
+            // Lowest indices are handed out first so live objects stay packed at the front
+            m_free.reserve(capacity);
+            for (uint32_t i = capacity; i > 0; i--)
+            {
+                m_free.push_back(i - 1);
+            }
+        }
+
+        ~ObjectPool()
+        {
+            for (uint32_t i = 0; i < getCapacity(); i++)
+            {
+                if (m_alive[i])
+                {
+                    object(i)->~T();
+                }
+            }
+        }
+
+        /**
+            Constructs an object in a free slot
+            @param args - forwarded to T's constructor
+            @return handle to the object, invalid if the pool is full
+        */
+        template <typename... Args>
+        PoolHandle<T> create(Args &&... args)
+        {
+            if (m_free.empty())
+            {
+                return PoolHandle<T>();
+            }
+
+            uint32_t index = m_free.back();
+            m_free.pop_back();
+            new (&m_slots[index]) T(std::forward<Args>(args)...);
+            m_alive[index] = 1;
+            ++m_count;
+            return PoolHandle<T>(index, m_generations[index]);
+        }
+
+        /**
+            Destroys the object, stale handles are ignored
+        */
+        void destroy(PoolHandle<T> handle)
+        {
+            if (!isAlive(handle))
+            {
+                return;
+            }
+
+            object(handle.index)->~T();
+            m_alive[handle.index] = 0;
+            ++m_generations[handle.index];
+            m_free.push_back(handle.index);
+            --m_count;
+        }
+
+        bool isAlive(PoolHandle<T> handle) const
+        {
+            return handle.index < getCapacity() && m_alive[handle.index] &&
+                m_generations[handle.index] == handle.generation;
+        }
+
+        T * get(PoolHandle<T> handle)
+        {
+            return isAlive(handle) ? object(handle.index) : NULL;
+        }
+
+        const T * get(PoolHandle<T> handle) const
+        {
+            return isAlive(handle) ? const_cast<ObjectPool *>(this)->object(handle.index) : NULL;
+        }
+
+        /**
+            Calls function(handle, object) for every live object in slot order
+        */
+        template <typename F>
+        void forEach(F function)
+        {
+            for (uint32_t i = 0; i < getCapacity(); i++)
+            {
+                if (m_alive[i])
+                {
+                    function(PoolHandle<T>(i, m_generations[i]), *object(i));
+                }
+            }
+        }
+
+        uint32_t getCount() const { return m_count; }
+        uint32_t getCapacity() const { return (uint32_t)m_slots.size(); }
+
+    private:
+        typedef typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type Slot;
+
+        std::vector<Slot> m_slots; //! Never resized, objects keep their address
+        std::vector<uint32_t> m_generations;
+        std::vector<uint8_t> m_alive;
+        std::vector<uint32_t> m_free; //! Free slot indices, the next one last
+        uint32_t m_count;
+
+        T * object(uint32_t index)
+        {
+            return reinterpret_cast<T *>(&m_slots[index]);
+        }
+
+        ObjectPool(const ObjectPool &);
+        ObjectPool & operator=(const ObjectPool &);
+};
+
+#endif // !_OBJECT_POOL_H
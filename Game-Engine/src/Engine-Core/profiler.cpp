@@ -0,0 +1,295 @@
+/**
+    @file profiler.cpp
+    @date 18/10/2026
+*/
+
+#include <Engine-Core\profiler.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+
+namespace ProfilerInfo
+{
+    typedef std::chrono::steady_clock Clock;
+
+    const Clock::time_point epoch = Clock::now();
+
+    //! The calling thread's ring, looked up again if the profiler changed.
+    struct ThreadSlot
+    {
+        Profiler * owner;
+        void * buffer;
+    };
+    thread_local ThreadSlot slot = { NULL, NULL };
+
+    /**
+        Writes a string as a JSON string literal
+    */
+    void writeString(std::ostream & out, const char * text)
+    {
+        out << '"';
+        for (; *text; text++)
+        {
+            if (*text == '"' || *text == '\\')
+            {
+                out << '\\';
+            }
+            out << *text;
+        }
+        out << '"';
+    }
+}
+
+Profiler * Profiler::s_instance = NULL;
+
+/**
+    Creates the profiler, PROFILE_SCOPE records into it from any thread
+*/
+Profiler::Profiler()
+{
+    s_instance = this;
+}
+
+Profiler::~Profiler()
+{
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+Profiler * Profiler::get()
+{
+    return s_instance;
+}
+
+/**
+    Gets the current time in nanoseconds, from a steady clock
+*/
+uint64_t Profiler::now()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        ProfilerInfo::Clock::now() - ProfilerInfo::epoch).count();
+}
+
+/**
+    Names the calling thread in exported traces
+    @param name - e.g. "Main" or "Worker 2"
+*/
+void Profiler::setThreadName(const char * name)
+{
+    getThreadBuffer().name = name;
+}
+
+/**
+    Adds an event to the calling thread's ring, normally done by ProfileScope
+*/
+void Profiler::record(const char * name, uint64_t start, uint64_t end, uint32_t depth)
+{
+    write(getThreadBuffer(), name, start, end, depth);
+}
+
+/**
+    Gets how many scopes are open on the calling thread
+*/
+uint32_t & Profiler::getDepth()
+{
+    return getThreadBuffer().depth;
+}
+
+/**
+    Adds a timeline that is not tied to a thread, shown under its name in exported traces
+    @param name - e.g. "GPU"
+    @return track id for recordTrack
+*/
+uint32_t Profiler::createTrack(const char * name)
+{
+    std::unique_ptr<ThreadBuffer> track(new ThreadBuffer());
+    track->name = name;
+    track->depth = 0;
+    track->track = true;
+    track->written = 0;
+    track->events.resize(PROFILE_EVENTS_PER_THREAD);
+
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    track->id = (uint32_t)m_threads.size() + 1;
+    m_threads.push_back(std::move(track));
+    return (uint32_t)m_threads.size() - 1;
+}
+
+/**
+    Adds an event to a track, times on the same clock as now()
+    @param track - see createTrack
+*/
+void Profiler::recordTrack(uint32_t track, const char * name, uint64_t start, uint64_t end, uint32_t depth)
+{
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    if (track < m_threads.size())
+    {
+        write(*m_threads[track], name, start, end, depth);
+    }
+}
+
+void Profiler::write(ThreadBuffer & thread, const char * name, uint64_t start, uint64_t end, uint32_t depth)
+{
+    uint64_t index = thread.written.load(std::memory_order_relaxed);
+    ProfileEvent & event = thread.events[index & (PROFILE_EVENTS_PER_THREAD - 1)];
+    event.name = name;
+    event.start = start;
+    event.end = end;
+    event.depth = depth;
+    thread.written.store(index + 1, std::memory_order_release);
+}
+
+/**
+    Saves every event still in the rings as a Chrome trace
+    @param fileName - JSON file to write
+    @return false if the file could not be written
+*/
+bool Profiler::writeChromeTrace(const std::string & fileName)
+{
+    std::ofstream file(fileName.c_str(), std::ios::out | std::ios::trunc);
+    if (!file)
+    {
+        std::cerr << "Profiler: unable to write " << fileName << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    std::vector<ProfileEvent> events;
+    char number[64];
+    bool bFirst = true;
+
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (size_t t = 0; t < m_threads.size(); t++)
+    {
+        const ThreadBuffer & thread = *m_threads[t];
+        file << (bFirst ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.id
+            << ",\"args\":{\"name\":";
+        ProfilerInfo::writeString(file, thread.name.c_str());
+        file << "}}";
+        bFirst = false;
+
+        // Complete events in microseconds, three decimals keep the nanoseconds
+        collect(thread, events);
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            file << ",\n{\"name\":";
+            ProfilerInfo::writeString(file, events[i].name);
+            snprintf(number, sizeof(number), ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                thread.id, events[i].start / 1000.0, (events[i].end - events[i].start) / 1000.0);
+            file << number;
+        }
+    }
+    file << "\n]}\n";
+
+    return (bool)file;
+}
+
+/**
+    Prints the total time spent in every scope name, deepest nesting level indented.
+    Threads add up under one name, a track's scopes are listed under the track's name.
+*/
+void Profiler::printSummary()
+{
+    struct Total
+    {
+        uint64_t nanoseconds;
+        uint64_t count;
+        uint32_t depth;
+    };
+
+    std::map<std::string, Total> totals;
+    std::vector<ProfileEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        for (size_t t = 0; t < m_threads.size(); t++)
+        {
+            const ThreadBuffer & thread = *m_threads[t];
+            std::string prefix = thread.track ? thread.name + " " : std::string();
+            collect(thread, events);
+            for (size_t i = 0; i < events.size(); i++)
+            {
+                std::string name = prefix + events[i].name;
+                std::map<std::string, Total>::iterator found = totals.find(name);
+                if (found == totals.end())
+                {
+                    Total total = { 0, 0, events[i].depth };
+                    found = totals.insert(std::make_pair(name, total)).first;
+                }
+                found->second.nanoseconds += events[i].end - events[i].start;
+                found->second.count++;
+                found->second.depth = std::min(found->second.depth, events[i].depth);
+            }
+        }
+    }
+
+    std::vector<std::pair<uint64_t, std::string>> order;
+    for (std::map<std::string, Total>::iterator it = totals.begin(); it != totals.end(); ++it)
+    {
+        order.push_back(std::make_pair(it->second.nanoseconds, it->first));
+    }
+    std::sort(order.rbegin(), order.rend());
+
+    std::cout << "Profile (total ms, calls, average ms):" << std::endl;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        const Total & total = totals[order[i].second];
+        int indent = (int)std::min(total.depth, 8u) * 2;
+        printf("%*s%-*s %10.3f %8llu %10.4f\n", indent, "", 32 - indent, order[i].second.c_str(),
+            total.nanoseconds / 1e6, (unsigned long long)total.count, total.nanoseconds / 1e6 / total.count);
+    }
+}
+
+/**
+    Drops every recorded event
+*/
+void Profiler::reset()
+{
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    for (size_t t = 0; t < m_threads.size(); t++)
+    {
+        m_threads[t]->written.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+    Gets the calling thread's ring, creating it on the first event
+*/
+Profiler::ThreadBuffer & Profiler::getThreadBuffer()
+{
+    if (ProfilerInfo::slot.owner != this)
+    {
+        std::unique_ptr<ThreadBuffer> thread(new ThreadBuffer());
+        thread->depth = 0;
+        thread->track = false;
+        thread->written = 0;
+        thread->events.resize(PROFILE_EVENTS_PER_THREAD);
+
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        thread->id = (uint32_t)m_threads.size() + 1;
+        thread->name = "Thread " + std::to_string(thread->id);
+        ProfilerInfo::slot.owner = this;
+        ProfilerInfo::slot.buffer = thread.get();
+        m_threads.push_back(std::move(thread));
+    }
+    return *(ThreadBuffer *)ProfilerInfo::slot.buffer;
+}
+
+/**
+    Copies a thread's events in the order they were written
+*/
+void Profiler::collect(const ThreadBuffer & thread, std::vector<ProfileEvent> & events) const
+{
+    uint64_t written = thread.written.load(std::memory_order_acquire);
+    uint64_t first = written > PROFILE_EVENTS_PER_THREAD ? written - PROFILE_EVENTS_PER_THREAD : 0;
+
+    events.clear();
+    for (uint64_t i = first; i < written; i++)
+    {
+        events.push_back(thread.events[i & (PROFILE_EVENTS_PER_THREAD - 1)]);
+    }
+}
@@ -0,0 +1,131 @@
+/**
+    @headerfile profiler.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _PROFILER_H
+#define _PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Define ENGINE_PROFILING as 0 to compile every PROFILE_SCOPE out of the build
+#ifndef ENGINE_PROFILING
+#define ENGINE_PROFILING 1
+#endif
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if ENGINE_PROFILING
+//! Times the rest of the enclosing block. The name must be a string literal.
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#endif
+
+const size_t PROFILE_EVENTS_PER_THREAD = 1 << 16; //! Power of two, older events are overwritten
+
+//! One timed scope, times are nanoseconds since the profiler was created.
+struct ProfileEvent
+{
+    const char * name;
+    uint64_t start;
+    uint64_t end;
+    uint32_t depth; //! Scopes open around it on the same thread
+};
+
+/**
+    Collects timed scopes from every thread. Each thread writes into its own ring of
+    events without locking, the profiler only locks to hand a thread its ring the
+    first time it records. Tracks are rings that belong to no thread, such as GPU time
+    read back from queries, and lock on every event. The rings keep the latest events, which writeChromeTrace
+    saves in the Chrome trace format that chrome://tracing and Perfetto open.
+
+    Export and reset read the rings of other threads, so call them at a frame
+    boundary while no jobs are running.
+*/
+class Profiler
+{
+    public:
+        Profiler();
+        ~Profiler();
+
+        static Profiler * get();
+        static uint64_t now();
+
+        void setThreadName(const char * name);
+        void record(const char * name, uint64_t start, uint64_t end, uint32_t depth);
+        uint32_t & getDepth();
+
+        uint32_t createTrack(const char * name);
+        void recordTrack(uint32_t track, const char * name, uint64_t start, uint64_t end, uint32_t depth);
+
+        bool writeChromeTrace(const std::string & fileName);
+        void printSummary();
+        void reset();
+
+    private:
+        struct ThreadBuffer
+        {
+            std::string name;
+            uint32_t id;
+            uint32_t depth;
+            bool track; //! Not a thread, see createTrack
+            std::atomic<uint64_t> written; //! Events ever written, the ring holds the latest
+            std::vector<ProfileEvent> events;
+        };
+
+        static Profiler * s_instance;
+
+        std::mutex m_threadMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> m_threads;
+
+        Profiler(const Profiler &);
+        Profiler & operator=(const Profiler &);
+
+        ThreadBuffer & getThreadBuffer();
+        void write(ThreadBuffer & thread, const char * name, uint64_t start, uint64_t end, uint32_t depth);
+        void collect(const ThreadBuffer & thread, std::vector<ProfileEvent> & events) const;
+};
+
+/**
+    Records the time between its construction and destruction, see PROFILE_SCOPE
+*/
+class ProfileScope
+{
+    public:
+        explicit ProfileScope(const char * name) : m_name(name), m_profiler(Profiler::get())
+        {
+            if (m_profiler)
+            {
+                m_start = Profiler::now();
+                ++m_profiler->getDepth();
+            }
+        }
+
+        ~ProfileScope()
+        {
+            if (m_profiler)
+            {
+                uint32_t depth = --m_profiler->getDepth();
+                m_profiler->record(m_name, m_start, Profiler::now(), depth);
+            }
+        }
+
+    private:
+        const char * m_name;
+        Profiler * m_profiler;
+        uint64_t m_start;
+
+        ProfileScope(const ProfileScope &);
+        ProfileScope & operator=(const ProfileScope &);
+};
+
+#endif // !_PROFILER_H
@@ -5,18 +5,214 @@
 	@version 0.0.0.0
 */
 
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <Graphics-Engine\window-manager.h>
+#include <Graphics-Engine\frustum-culling.h>
+#include <Graphics-Engine\mesh-converter.h>
+#include <Graphics-Engine\render-test.h>
+#include <Graphics-Engine\bounding-volume-hierarchy.h>
 
-int main()
+/**
+	Lists the command line options
+*/
+void printUsage()
 {
-	
+	std::cout << "Options:" << std::endl
+		<< "  --bench-culling          culling micro-benchmark" << std::endl
+		<< "  --bench-bvh              bounding volume hierarchy micro-benchmark" << std::endl
+		<< "  --test-render            check the GL commands of a rendered frame, without a driver" << std::endl
+		<< "  --convert-mesh <in> <out>  convert an .obj model into the engine's mesh format" << std::endl
+		<< "  --trace <file>           write a Chrome trace when the engine exits" << std::endl
+		<< "  --benchmark              render a scripted camera path and report frame times" << std::endl
+		<< "  --headless               as --benchmark, without showing a window" << std::endl
+		<< "  --null-gl                as --headless, without a GL driver, GL calls are only counted" << std::endl
+		<< "  --record-gl              count GL calls per frame in the benchmark report" << std::endl
+		<< "  --eager-gl               look up every GL function at startup, not on first call" << std::endl
+		<< "  --frames <n>             frames measured by the benchmark" << std::endl
+		<< "  --warmup <n>             frames rendered before measuring" << std::endl
+		<< "  --size <width>x<height>  offscreen target size" << std::endl
+		<< "  --camera-path <file>     keyframes, one \"time x y z pitch yaw\" per line" << std::endl
+		<< "  --json <file>            benchmark report, printed when not given" << std::endl
+		<< "  --budget-p95 <ms>        fail when the 95th percentile frame time exceeds it" << std::endl
+		<< "  --stream <n>             stream n copies of a mesh into the scene, reporting hitches" << std::endl
+		<< "  --stream-mesh <file>     mesh file streamed, resources/Models/cube.mesh when not given" << std::endl;
+}
+
+/**
+	Reads a "<width>x<height>" option value
+	@return false if either number is missing
+*/
+bool parseSize(const char * value, int & width, int & height)
+{
+	char * end = NULL;
+	long parsedWidth = strtol(value, &end, 10);
+	if (end == value || *end != 'x')
+	{
+		return false;
+	}
+	const char * heightText = end + 1;
+	long parsedHeight = strtol(heightText, &end, 10);
+	if (end == heightText || *end != '\0')
+	{
+		return false;
+	}
+	width = (int)parsedWidth;
+	height = (int)parsedHeight;
+	return true;
+}
+
+int main(int argc, char ** argv)
+{
+	// Runs the culling micro-benchmark instead of the engine
+	if (argc > 1 && std::string(argv[1]) == "--bench-culling")
+	{
+		benchmarkCulling(100000, 200);
+		return 0;
+	}
+	if (argc > 1 && std::string(argv[1]) == "--bench-bvh")
+	{
+		benchmarkBoundingVolumeHierarchy(10000);
+		benchmarkBoundingVolumeHierarchy(100000);
+		benchmarkBoundingVolumeHierarchy(1000000);
+		return 0;
+	}
+	// Checks the scene's command stream with the null driver, exits with 1 on failure
+	if (argc > 1 && std::string(argv[1]) == "--test-render")
+	{
+		return testSceneRendering() ? 0 : 1;
+	}
+	// Converts a model offline, the engine only ever maps the result
+	if (argc > 1 && std::string(argv[1]) == "--convert-mesh")
+	{
+		if (argc != 4)
+		{
+			printUsage();
+			return 1;
+		}
+		return convertMesh(argv[2], argv[3]) ? 0 : 1;
+	}
+
+	bool bBenchmark = false;
+	bool bRecordGL = false;
+	ContextMode contextMode = CONTEXT_WINDOW;
+	gl::sys::LoadMode glLoadMode = gl::sys::LOAD_LAZY;
+	std::string traceFile;
+	int streamedObjects = 0;
+	std::string streamedMesh = "resources/Models/cube.mesh";
+	BenchmarkSettings benchmark = getDefaultBenchmarkSettings();
+	for (int i = 1; i < argc; i++)
+	{
+		std::string option = argv[i];
+		const char * value = i + 1 < argc ? argv[i + 1] : NULL;
+
+		if (option == "--benchmark")
+		{
+			bBenchmark = true;
+		}
+		else if (option == "--headless")
+		{
+			bBenchmark = true;
+			contextMode = contextMode == CONTEXT_NULL ? CONTEXT_NULL : CONTEXT_HIDDEN;
+		}
+		else if (option == "--null-gl")
+		{
+			bBenchmark = true;
+			contextMode = CONTEXT_NULL;
+		}
+		else if (option == "--record-gl")
+		{
+			bRecordGL = true;
+		}
+		else if (option == "--eager-gl")
+		{
+			glLoadMode = gl::sys::LOAD_EAGER;
+		}
+		else if (value && option == "--trace")
+		{
+			traceFile = value;
+			i++;
+		}
+		else if (value && option == "--frames")
+		{
+			benchmark.frames = atoi(value);
+			i++;
+		}
+		else if (value && option == "--warmup")
+		{
+			benchmark.warmupFrames = atoi(value);
+			i++;
+		}
+		else if (value && option == "--size" && parseSize(value, benchmark.width, benchmark.height))
+		{
+			i++;
+		}
+		else if (value && option == "--camera-path")
+		{
+			benchmark.cameraPathFile = value;
+			i++;
+		}
+		else if (value && option == "--json")
+		{
+			benchmark.outputFile = value;
+			i++;
+		}
+		else if (value && option == "--budget-p95")
+		{
+			benchmark.budgetP95 = atof(value);
+			i++;
+		}
+		else if (value && option == "--stream")
+		{
+			streamedObjects = atoi(value);
+			i++;
+		}
+		else if (value && option == "--stream-mesh")
+		{
+			streamedMesh = value;
+			i++;
+		}
+		else
+		{
+			std::cerr << "Unknown or incomplete option: " << option << std::endl;
+			printUsage();
+			return 1;
+		}
+	}
+
+	if (benchmark.frames < 1 || benchmark.warmupFrames < 0 || benchmark.width < 1 || benchmark.height < 1)
+	{
+		std::cerr << "Benchmark frames and size must be positive" << std::endl;
+		return 1;
+	}
+
 	std::cout << "Engine Name: Dark Nebula" << std::endl;
 	std::cout << "Engine Version: 0.0.0.0" << std::endl;
 
-	WindowManager app(500, 500, "Dark Nebula");
+	// Most of the GL 4.3 functions are never called, looking them up on first use shortens startup
+	gl::sys::SetLoadMode(glLoadMode);
+	WindowManager app(500, 500, "Dark Nebula", contextMode);
+	if (bRecordGL)
+	{
+		app.recordGLCalls();
+	}
+
+	// Saves where the frames' time went once the window is closed
+	app.setTraceFile(traceFile);
+
+	// Loaded in the background while the first frames run
+	app.setStreamedScene(streamedMesh, streamedObjects);
+
 	app.initialiseGL();
+
+	// A failed or over budget run exits with 1, so build machines can gate on it
+	if (bBenchmark)
+	{
+		return app.runBenchmark(benchmark) ? 0 : 1;
+	}
+
 	app.mainLoop();
 
 	return 0;
@@ -0,0 +1,569 @@
+/**
+    @file asset-streamer.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\asset-streamer.h>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <Engine-Core\profiler.h>
+#include <Graphics-Engine\gl-state-cache.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace StreamingInfo
+{
+    const GLsizeiptr STAGING_SLACK = 256; //! Staging bytes per frame beyond the upload budget
+
+    /**
+        Reads a whole file with positional reads, so I/O threads never share a file
+        position
+        @param fileName - file to read
+        @param chunk - largest single read
+        @param data - replaced by the file's bytes, padded to whole 8 byte words
+        @param size - set to the file's size
+        @return false if the file is missing, empty or a read fails
+    */
+    bool readFile(const std::string & fileName, size_t chunk, std::vector<uint64_t> & data, size_t & size)
+    {
+        bool bRead = true;
+#ifdef _WIN32
+        HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+        size = (size_t)fileSize.QuadPart;
+        data.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+
+        char * out = (char *)data.data();
+        for (size_t offset = 0; offset < size;)
+        {
+            OVERLAPPED overlapped;
+            memset(&overlapped, 0, sizeof(overlapped));
+            overlapped.Offset = (DWORD)offset;
+            overlapped.OffsetHigh = (DWORD)((uint64_t)offset >> 32);
+
+            DWORD read = 0;
+            if (!ReadFile(file, out + offset, (DWORD)std::min(chunk, size - offset), &read, &overlapped) || read == 0)
+            {
+                bRead = false;
+                break;
+            }
+            offset += read;
+        }
+        CloseHandle(file);
+#else
+        int file = open(fileName.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            return false;
+        }
+
+        struct stat status;
+        if (fstat(file, &status) != 0 || status.st_size <= 0)
+        {
+            close(file);
+            return false;
+        }
+        size = (size_t)status.st_size;
+        data.resize((size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+
+        char * out = (char *)data.data();
+        for (size_t offset = 0; offset < size;)
+        {
+            ssize_t read = pread(file, out + offset, std::min(chunk, size - offset), (off_t)offset);
+            if (read < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (read <= 0)
+            {
+                bRead = false;
+                break;
+            }
+            offset += (size_t)read;
+        }
+        close(file);
+#endif
+        return bRead;
+    }
+
+    inline float distanceSquared(const glm::vec3 & a, const glm::vec3 & b)
+    {
+        glm::vec3 difference = a - b;
+        return glm::dot(difference, difference);
+    }
+}
+
+AssetStreamer * AssetStreamer::s_instance = NULL;
+
+StreamingSettings getDefaultStreamingSettings()
+{
+    StreamingSettings settings = { 2, 1024 * 1024, 4 * 1024 * 1024, 2.0, 1000.0 / 60.0 };
+    return settings;
+}
+
+/**
+    Starts the I/O threads, while it exists get() gives scenes access to it
+    @param settings - threads, chunk sizes and budgets, fixed for the streamer's lifetime
+*/
+AssetStreamer::AssetStreamer(const StreamingSettings & settings) :
+    m_settings(settings), m_bRunning(true), m_generation(0), m_cameraPosition(0.f), m_outstanding(0),
+    m_bytesRead(0), m_lastUpdate(0), m_firstRequest(0), m_bStreamedLastFrame(false)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+    s_instance = this;
+
+    for (int i = 0; i < m_settings.ioThreads; i++)
+    {
+        m_ioThreads.push_back(std::thread(&AssetStreamer::ioLoop, this, i));
+    }
+}
+
+/**
+    Stops the I/O threads and waits for running decode jobs. Meshes still being copied
+    are deleted, their callbacks are never called.
+*/
+AssetStreamer::~AssetStreamer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_bRunning = false;
+    }
+    m_wakeCondition.notify_all();
+    for (size_t i = 0; i < m_ioThreads.size(); i++)
+    {
+        m_ioThreads[i].join();
+    }
+    if (JobSystem::get())
+    {
+        JobSystem::get()->wait(&m_decodeJobs);
+    }
+
+    cancelAll();
+
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+AssetStreamer * AssetStreamer::get()
+{
+    return s_instance;
+}
+
+/**
+    Queues a mesh file for loading, call on the GL thread
+    @param fileName - file written by writeMeshFile
+    @param position - where the mesh will be drawn, nearer requests are served first
+    @param onLoaded - called from a later update() once the mesh is ready or has failed
+*/
+void AssetStreamer::requestMesh(const std::string & fileName, const glm::vec3 & position, const MeshCallback & onLoaded)
+{
+    // A file loaded or loading already is not read again, the request waits for its mesh
+    std::map<std::string, LoadedMesh>::iterator loaded = m_loadedMeshes.find(fileName);
+    std::map<std::string, std::vector<MeshCallback> >::iterator waiting = m_waiting.find(fileName);
+    bool bLoaded = loaded != m_loadedMeshes.end() && RenderResources::get()->getMesh(loaded->second.handle);
+    if (bLoaded || waiting != m_waiting.end())
+    {
+        if (bLoaded)
+        {
+            SharedRequest shared = { onLoaded, loaded->second.handle, loaded->second.bounds };
+            m_shared.push_back(shared);
+        }
+        else
+        {
+            waiting->second.push_back(onLoaded);
+        }
+        ++m_stats.requested;
+        ++m_stats.shared;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_outstanding == 0)
+        {
+            m_firstRequest = Profiler::now();
+        }
+        ++m_outstanding;
+        return;
+    }
+    m_waiting[fileName];
+
+    std::unique_ptr<Request> request(new Request());
+    request->fileName = fileName;
+    request->position = position;
+    request->onLoaded = onLoaded;
+    request->state = REQUEST_READING;
+    request->size = 0;
+    request->bAllocated = false;
+    memset(&request->mesh, 0, sizeof(request->mesh));
+    request->uploaded = 0;
+    ++m_stats.requested;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_outstanding == 0)
+        {
+            m_firstRequest = Profiler::now();
+        }
+        request->generation = m_generation;
+        m_readQueue.push_back(std::move(request));
+        ++m_outstanding;
+    }
+    m_wakeCondition.notify_one();
+}
+
+/**
+    Drops every request not finished yet without calling its callback, call on the GL
+    thread. Reads and decodes already running complete but are thrown away.
+*/
+void AssetStreamer::cancelAll()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_generation;
+        m_readQueue.clear();
+        m_decoded.clear();
+        m_outstanding = 0;
+    }
+    m_waiting.clear();
+    m_shared.clear();
+
+    for (size_t i = 0; i < m_uploads.size(); i++)
+    {
+        if (m_uploads[i]->bAllocated)
+        {
+            RenderResources::get()->deleteMesh(m_uploads[i]->mesh);
+        }
+    }
+    m_uploads.clear();
+}
+
+/**
+    Copies decoded meshes into their buffers, within the per frame budget, and hands out
+    the finished ones. Call on the GL thread once per frame, the time between two calls
+    is the frame time the hitch counts are based on.
+    @param cameraPosition - requests nearest to it are read and uploaded first
+*/
+void AssetStreamer::update(const glm::vec3 & cameraPosition)
+{
+    PROFILE_SCOPE("AssetStreamer::update");
+
+    uint64_t now = Profiler::now();
+    if (m_lastUpdate != 0 && m_bStreamedLastFrame)
+    {
+        double frameMs = (now - m_lastUpdate) / 1e6;
+        ++m_stats.framesStreaming;
+        if (frameMs > m_settings.frameBudgetMs)
+        {
+            ++m_stats.framesOverBudget;
+        }
+        m_stats.worstFrameMs = std::max(m_stats.worstFrameMs, frameMs);
+    }
+    m_lastUpdate = now;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cameraPosition = cameraPosition;
+        for (size_t i = 0; i < m_decoded.size(); i++)
+        {
+            if (m_decoded[i]->generation == m_generation)
+            {
+                m_uploads.push_back(std::move(m_decoded[i]));
+            }
+        }
+        m_decoded.clear();
+        m_stats.bytesRead = m_bytesRead;
+        m_bStreamedLastFrame = m_outstanding > 0;
+    }
+
+    // Swapped out first, a callback may request more meshes
+    std::vector<SharedRequest> shared;
+    shared.swap(m_shared);
+    for (size_t i = 0; i < shared.size(); i++)
+    {
+        deliver(shared[i].onLoaded, shared[i].handle, shared[i].bounds);
+    }
+
+    if (m_uploads.empty())
+    {
+        return;
+    }
+
+    std::sort(m_uploads.begin(), m_uploads.end(),
+        [&cameraPosition](const std::unique_ptr<Request> & a, const std::unique_ptr<Request> & b)
+    {
+        return StreamingInfo::distanceSquared(a->position, cameraPosition) <
+            StreamingInfo::distanceSquared(b->position, cameraPosition);
+    });
+
+    // Failed requests finish at once, the rest share the budgets nearest first
+    GLsizeiptr budget = m_settings.uploadBudget;
+    uint64_t deadline = now + (uint64_t)(m_settings.uploadTimeMs * 1e6);
+    for (size_t i = 0; i < m_uploads.size();)
+    {
+        bool bDone = m_uploads[i]->state == REQUEST_FAILED ||
+            (Profiler::now() < deadline && upload(*m_uploads[i], budget));
+        if (bDone)
+        {
+            finish(m_uploads[i]);
+            m_uploads.erase(m_uploads.begin() + i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    m_staging.endFrame();
+
+    m_stats.worstUploadMs = std::max(m_stats.worstUploadMs, (Profiler::now() - now) / 1e6);
+}
+
+bool AssetStreamer::isIdle() const
+{
+    return getOutstandingCount() == 0;
+}
+
+size_t AssetStreamer::getOutstandingCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_outstanding;
+}
+
+const StreamingStats & AssetStreamer::getStats() const
+{
+    return m_stats;
+}
+
+void AssetStreamer::printStats() const
+{
+    printf("Streaming: %zu of %zu meshes loaded, %zu failed, %zu shared, %.1f MB read, %.1f MB uploaded, %.3f s to idle\n",
+        m_stats.loaded, m_stats.requested, m_stats.failed, m_stats.shared, m_stats.bytesRead / 1048576.0,
+        m_stats.bytesUploaded / 1048576.0, m_stats.secondsToIdle);
+    printf("Streaming: %zu of %zu frames over %.2f ms, worst frame %.3f ms, worst upload %.3f ms\n",
+        m_stats.framesOverBudget, m_stats.framesStreaming, m_settings.frameBudgetMs, m_stats.worstFrameMs,
+        m_stats.worstUploadMs);
+}
+
+/**
+    Serves the read queue until the streamer is destroyed, nearest request first
+*/
+void AssetStreamer::ioLoop(int threadIndex)
+{
+    if (Profiler::get())
+    {
+        Profiler::get()->setThreadName(("IO " + std::to_string(threadIndex)).c_str());
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;)
+    {
+        m_wakeCondition.wait(lock, [this] { return !m_bRunning || !m_readQueue.empty(); });
+        if (!m_bRunning)
+        {
+            return;
+        }
+
+        size_t nearest = 0;
+        for (size_t i = 1; i < m_readQueue.size(); i++)
+        {
+            if (StreamingInfo::distanceSquared(m_readQueue[i]->position, m_cameraPosition) <
+                StreamingInfo::distanceSquared(m_readQueue[nearest]->position, m_cameraPosition))
+            {
+                nearest = i;
+            }
+        }
+        std::unique_ptr<Request> request = std::move(m_readQueue[nearest]);
+        m_readQueue.erase(m_readQueue.begin() + nearest);
+        lock.unlock();
+
+        bool bRead;
+        {
+            PROFILE_SCOPE("AssetStreamer::read");
+            bRead = StreamingInfo::readFile(request->fileName, m_settings.readChunkBytes, request->data, request->size);
+        }
+        request->state = bRead ? REQUEST_DECODING : REQUEST_FAILED;
+        size_t bytesRead = bRead ? request->size : 0;
+
+        // Decoding runs on the workers, the job owns the request until it is queued for upload.
+        // Once queued the GL thread may finish and free it, it is not touched here after this.
+        Request * pRequest = request.release();
+        if (JobSystem::get())
+        {
+            JobSystem::get()->run([this, pRequest] { decode(pRequest); }, &m_decodeJobs);
+        }
+        else
+        {
+            decode(pRequest);
+        }
+
+        lock.lock();
+        m_bytesRead += bytesRead;
+    }
+}
+
+/**
+    Checks a file that was read and queues it for upload. Mesh files need no more than
+    that, formats that are compressed or converted on load would do it here.
+*/
+void AssetStreamer::decode(Request * pRequest)
+{
+    std::unique_ptr<Request> request(pRequest);
+    if (request->state == REQUEST_DECODING)
+    {
+        PROFILE_SCOPE("AssetStreamer::decode");
+        request->state = request->file.openMemory(request->data.data(), request->size) ? REQUEST_UPLOADING : REQUEST_FAILED;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_decoded.push_back(std::move(request));
+}
+
+/**
+    Copies the next part of a mesh's vertex and index sections through the staging ring
+    @param request - decoded request, its GL objects are created on the first call
+    @param budget - bytes still allowed this frame, reduced by what was copied
+    @return true once the whole mesh is in its buffers
+*/
+bool AssetStreamer::upload(Request & request, GLsizeiptr & budget)
+{
+    if (budget <= 0)
+    {
+        return false;
+    }
+
+    if (!request.bAllocated)
+    {
+        if (m_staging.getHandle() == 0)
+        {
+            // A frame's share covers the budget plus alignment padding between its pieces
+            m_staging.create(gl::COPY_READ_BUFFER, m_settings.uploadBudget + StreamingInfo::STAGING_SLACK);
+        }
+        request.mesh = request.file.allocate();
+        request.bAllocated = true;
+    }
+
+    const MeshFileHeader & header = request.file.getHeader();
+    GLsizeiptr vertexBytes = (GLsizeiptr)header.vertices.size;
+    GLsizeiptr totalBytes = vertexBytes + (GLsizeiptr)header.indices.size;
+    GLStateCache * state = GLStateCache::get();
+
+    while (request.uploaded < totalBytes && budget > 0)
+    {
+        bool bVertices = request.uploaded < vertexBytes;
+        GLintptr offset = bVertices ? request.uploaded : request.uploaded - vertexBytes;
+        GLsizeiptr sectionBytes = bVertices ? vertexBytes : (GLsizeiptr)header.indices.size;
+        const unsigned char * source = bVertices ? (const unsigned char *)request.file.getVertices() :
+            (const unsigned char *)request.file.getIndices();
+        GLsizeiptr size = std::min(sectionBytes - offset, budget);
+
+        // Padding of many small pieces can use up the frame's share early, the rest waits for the next frame
+        StreamAllocation staging = m_staging.allocate(size);
+        if (!staging.isValid())
+        {
+            budget = 0;
+            break;
+        }
+        memcpy(staging.pointer, source + offset, (size_t)size);
+        m_staging.flush();
+
+        state->bindBuffer(gl::COPY_READ_BUFFER, m_staging.getHandle());
+        state->bindBuffer(gl::COPY_WRITE_BUFFER, bVertices ? request.mesh.vertexBuffer : request.mesh.indexBuffer);
+        gl::CopyBufferSubData(gl::COPY_READ_BUFFER, gl::COPY_WRITE_BUFFER, staging.offset, offset, size);
+
+        request.uploaded += size;
+        budget -= size;
+        m_stats.bytesUploaded += (size_t)size;
+    }
+    return request.uploaded >= totalBytes;
+}
+
+/**
+    Hands a finished request's mesh to the pool and calls its callback, then those of
+    the requests for the same file that came after it
+*/
+void AssetStreamer::finish(std::unique_ptr<Request> & request)
+{
+    MeshHandle handle;
+    if (request->state != REQUEST_FAILED)
+    {
+        handle = RenderResources::get()->createMesh(request->mesh);
+        if (!handle.isValid())
+        {
+            RenderResources::get()->deleteMesh(request->mesh);
+        }
+    }
+
+    MeshFileBounds bounds;
+    memset(&bounds, 0, sizeof(bounds));
+    if (handle.isValid())
+    {
+        bounds = request->file.getBounds();
+        LoadedMesh loaded = { handle, bounds };
+        m_loadedMeshes[request->fileName] = loaded;
+    }
+    else
+    {
+        std::cerr << "Streaming: cannot load mesh " << request->fileName << std::endl;
+    }
+
+    std::vector<MeshCallback> waiting;
+    std::map<std::string, std::vector<MeshCallback> >::iterator found = m_waiting.find(request->fileName);
+    if (found != m_waiting.end())
+    {
+        waiting.swap(found->second);
+        m_waiting.erase(found);
+    }
+
+    deliver(request->onLoaded, handle, bounds);
+    for (size_t i = 0; i < waiting.size(); i++)
+    {
+        deliver(waiting[i], handle, bounds);
+    }
+}
+
+/**
+    Counts a request as finished and calls its callback
+    @param handle - the request's mesh, invalid if loading failed
+*/
+void AssetStreamer::deliver(const MeshCallback & onLoaded, MeshHandle handle, const MeshFileBounds & bounds)
+{
+    if (handle.isValid())
+    {
+        ++m_stats.loaded;
+    }
+    else
+    {
+        ++m_stats.failed;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_outstanding;
+        if (m_outstanding == 0)
+        {
+            m_stats.secondsToIdle = (Profiler::now() - m_firstRequest) / 1e9;
+        }
+    }
+
+    onLoaded(handle, bounds);
+}
@@ -0,0 +1,169 @@
+/**
+    @headerfile asset-streamer.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _ASSET_STREAMER_H
+#define _ASSET_STREAMER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gl_core_4_3.hpp>
+#include <glm\glm.hpp>
+#include <Engine-Core\job-system.h>
+#include <Graphics-Engine\mesh-file.h>
+#include <Graphics-Engine\render-resources.h>
+#include <Graphics-Engine\stream-buffer.h>
+
+//! How AssetStreamer splits its work.
+struct StreamingSettings
+{
+    int ioThreads; //! Threads blocking on file reads
+    size_t readChunkBytes; //! Largest single read
+    GLsizeiptr uploadBudget; //! Bytes copied to GL per frame at most, also the staging ring's frame size
+    double uploadTimeMs; //! Time update() may spend on uploads, checked between meshes since small ones cost more in GL objects than in bytes
+    double frameBudgetMs; //! Frames taking longer while streaming count as hitches
+};
+
+StreamingSettings getDefaultStreamingSettings();
+
+//! Progress of the streamer, frame counts only cover frames with requests outstanding.
+struct StreamingStats
+{
+    size_t requested;
+    size_t loaded;
+    size_t failed;
+    size_t shared; //! Requests given the mesh of another request for the same file
+    size_t bytesRead;
+    size_t bytesUploaded;
+    size_t framesStreaming; //! Frames that began with requests outstanding
+    size_t framesOverBudget; //! Of those, frames longer than the frame budget
+    double worstFrameMs;
+    double worstUploadMs; //! Longest time one frame spent copying to GL
+    double secondsToIdle; //! From the first request to the last one finishing
+};
+
+/**
+    Loads mesh files without blocking the GL thread. Each request goes through three
+    stages:
+
+    - an I/O thread reads the file with positional reads, taking the queued request
+      nearest the camera first,
+    - a job on the JobSystem workers checks and decodes it,
+    - update() on the GL thread copies it into the mesh's buffers through a staging
+      ring, at most uploadBudget bytes and uploadTimeMs per frame, nearest first again, and calls the
+      request's callback once the mesh is complete.
+
+    A large mesh is therefore spread over several frames rather than stalling one, and
+    the stats show how many frames still ran over budget while streaming. A file is read
+    and uploaded once: requests for a file already loading or loaded share its mesh.
+*/
+class AssetStreamer
+{
+    public:
+        //! Called on the GL thread with the loaded mesh, or an invalid handle if loading failed.
+        //! Requests for the same file are given the same handle.
+        typedef std::function<void(MeshHandle, const MeshFileBounds &)> MeshCallback;
+
+        explicit AssetStreamer(const StreamingSettings & settings = getDefaultStreamingSettings());
+        ~AssetStreamer();
+
+        static AssetStreamer * get();
+
+        void requestMesh(const std::string & fileName, const glm::vec3 & position, const MeshCallback & onLoaded);
+        void cancelAll();
+        void update(const glm::vec3 & cameraPosition);
+
+        bool isIdle() const;
+        size_t getOutstandingCount() const;
+        const StreamingStats & getStats() const;
+        void printStats() const;
+
+    private:
+        //! A mesh already in the pool, reused while its handle stays valid.
+        struct LoadedMesh
+        {
+            MeshHandle handle;
+            MeshFileBounds bounds;
+        };
+
+        //! A request answered by a loaded mesh, called back from the next update().
+        struct SharedRequest
+        {
+            MeshCallback onLoaded;
+            MeshHandle handle;
+            MeshFileBounds bounds;
+        };
+
+        enum RequestState
+        {
+            REQUEST_READING,
+            REQUEST_DECODING,
+            REQUEST_UPLOADING,
+            REQUEST_FAILED
+        };
+
+        struct Request
+        {
+            std::string fileName;
+            glm::vec3 position;
+            MeshCallback onLoaded;
+            uint32_t generation; //! Requests from before the last cancelAll are dropped
+            RequestState state;
+            std::vector<uint64_t> data; //! The whole file, 8 byte aligned for the header
+            size_t size; //! Bytes of data used
+            MeshFile file;
+            bool bAllocated; //! The mesh's GL objects exist
+            Mesh mesh;
+            GLsizeiptr uploaded; //! Bytes of the vertex then index section copied so far
+        };
+
+        static AssetStreamer * s_instance;
+
+        StreamingSettings m_settings;
+        std::vector<std::thread> m_ioThreads;
+        JobCounter m_decodeJobs;
+
+        // Shared with the I/O threads and decode jobs
+        mutable std::mutex m_mutex;
+        std::condition_variable m_wakeCondition;
+        bool m_bRunning;
+        uint32_t m_generation;
+        glm::vec3 m_cameraPosition;
+        std::vector<std::unique_ptr<Request>> m_readQueue;
+        std::vector<std::unique_ptr<Request>> m_decoded;
+        size_t m_outstanding; //! Requested and neither loaded nor failed yet
+        size_t m_bytesRead;
+
+        // GL thread only
+        std::vector<std::unique_ptr<Request>> m_uploads;
+        std::map<std::string, std::vector<MeshCallback> > m_waiting; //! Files loading, with the callbacks of later requests for them
+        std::map<std::string, LoadedMesh> m_loadedMeshes;
+        std::vector<SharedRequest> m_shared;
+        StreamBuffer m_staging;
+        StreamingStats m_stats;
+        uint64_t m_lastUpdate;
+        uint64_t m_firstRequest;
+        bool m_bStreamedLastFrame;
+
+        AssetStreamer(const AssetStreamer &);
+        AssetStreamer & operator=(const AssetStreamer &);
+
+        void ioLoop(int threadIndex);
+        void decode(Request * request);
+        bool upload(Request & request, GLsizeiptr & budget);
+        void finish(std::unique_ptr<Request> & request);
+        void deliver(const MeshCallback & onLoaded, MeshHandle handle, const MeshFileBounds & bounds);
+};
+
+#endif // !_ASSET_STREAMER_H
@@ -0,0 +1,407 @@
+/**
+    @file benchmark.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\benchmark.h>
+#include <Graphics-Engine\gl-state-cache.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace BenchmarkInfo
+{
+    /**
+        Nearest rank percentile of sorted values
+        @param fPercent - in [0, 100]
+    */
+    inline double percentile(const std::vector<double> & sorted, double fPercent)
+    {
+        size_t rank = (size_t)std::ceil(fPercent / 100.0 * sorted.size());
+        return sorted[rank > 0 ? rank - 1 : 0];
+    }
+
+    /**
+        Reads a GL string, empty if the driver returns none
+    */
+    inline std::string glString(GLenum name)
+    {
+        const GLubyte * value = gl::GetString(name);
+        return value ? std::string((const char *)value) : std::string();
+    }
+
+    /**
+        Writes a string as a JSON string literal
+    */
+    void writeString(std::ostream & out, const std::string & text)
+    {
+        out << '"';
+        for (size_t i = 0; i < text.size(); i++)
+        {
+            unsigned char c = (unsigned char)text[i];
+            switch (c)
+            {
+                case '"': out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\r': out << "\\r"; break;
+                case '\t': out << "\\t"; break;
+                case '\b': out << "\\b"; break;
+                case '\f': out << "\\f"; break;
+                default:
+                    if (c < 0x20)
+                    {
+                        char escaped[8];
+                        snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        out << escaped;
+                    }
+                    else
+                    {
+                        out << text[i];
+                    }
+                    break;
+            }
+        }
+        out << '"';
+    }
+}
+
+/**
+    Gets the settings used when the command line does not change them
+*/
+BenchmarkSettings getDefaultBenchmarkSettings()
+{
+    BenchmarkSettings settings;
+    settings.frames = 1000;
+    settings.warmupFrames = 60;
+    settings.width = 1280;
+    settings.height = 720;
+    settings.budgetP95 = 0.0;
+    return settings;
+}
+
+/**
+    Summarises frame times
+    @param milliseconds - one entry per measured frame, in any order
+    @return statistics, all zero when there are no frames
+*/
+FrameTimeStats computeFrameTimeStats(const std::vector<double> & milliseconds)
+{
+    FrameTimeStats stats = { milliseconds.size(), 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    if (milliseconds.empty())
+    {
+        return stats;
+    }
+
+    std::vector<double> sorted(milliseconds);
+    std::sort(sorted.begin(), sorted.end());
+
+    double total = 0.0;
+    for (size_t i = 0; i < sorted.size(); i++)
+    {
+        total += sorted[i];
+    }
+
+    stats.mean = total / sorted.size();
+    stats.min = sorted.front();
+    stats.p50 = BenchmarkInfo::percentile(sorted, 50.0);
+    stats.p95 = BenchmarkInfo::percentile(sorted, 95.0);
+    stats.p99 = BenchmarkInfo::percentile(sorted, 99.0);
+    stats.max = sorted.back();
+    return stats;
+}
+
+/**
+    Writes the result of a benchmark run as JSON, together with the driver it ran on
+    @param settings - settings the run used, the report goes to settings.outputFile
+    @param stats - measured frame times
+    @param gpuAverages - per pass GPU times, see GpuProfiler::takeAverages
+    @param gpuDropped - frames the GPU profiler dropped over the run
+    @param glCalls - GL calls per frame, NULL when they were not recorded
+    @param streaming - asset streaming over the run, NULL when nothing was streamed
+    @param bPassed - whether the run stayed within the budget
+    @return false if the file could not be written
+*/
+bool writeBenchmarkReport(const BenchmarkSettings & settings, const FrameTimeStats & stats,
+    const std::vector<GpuTiming> & gpuAverages, int gpuDropped, const GLRecorderStats * glCalls, const StreamingStats * streaming, bool bPassed)
+{
+    std::ostringstream json;
+    char number[256];
+
+    json << "{\n  \"renderer\": ";
+    BenchmarkInfo::writeString(json, BenchmarkInfo::glString(gl::RENDERER));
+    json << ",\n  \"version\": ";
+    BenchmarkInfo::writeString(json, BenchmarkInfo::glString(gl::VERSION));
+    json << ",\n  \"cameraPath\": ";
+    BenchmarkInfo::writeString(json, settings.cameraPathFile);
+    snprintf(number, sizeof(number), ",\n  \"width\": %d,\n  \"height\": %d,\n  \"warmupFrames\": %d,\n  \"frames\": %zu",
+        settings.width, settings.height, settings.warmupFrames, stats.frames);
+    json << number;
+    snprintf(number, sizeof(number),
+        ",\n  \"frameTimeMs\": { \"mean\": %.4f, \"min\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }",
+        stats.mean, stats.min, stats.p50, stats.p95, stats.p99, stats.max);
+    json << number;
+    json << ",\n  \"gpuMs\": {";
+    for (size_t i = 0; i < gpuAverages.size(); i++)
+    {
+        json << (i > 0 ? ", " : " ");
+        BenchmarkInfo::writeString(json, gpuAverages[i].name);
+        snprintf(number, sizeof(number), ": %.4f", gpuAverages[i].milliseconds);
+        json << number;
+    }
+    snprintf(number, sizeof(number), " },\n  \"gpuDroppedFrames\": %d", gpuDropped);
+    json << number;
+    if (glCalls)
+    {
+        snprintf(number, sizeof(number),
+            ",\n  \"glCallsPerFrame\": { \"calls\": %zu, \"draws\": %zu, \"vertices\": %zu, \"binds\": %zu, \"stateChanges\": %zu, ",
+            glCalls->calls, glCalls->draws, glCalls->vertices, glCalls->binds, glCalls->stateChanges);
+        json << number;
+        snprintf(number, sizeof(number), "\"uniformUploads\": %zu, \"bufferUploads\": %zu, \"bytesUploaded\": %zu }",
+            glCalls->uniformUploads, glCalls->bufferUploads, glCalls->bytesUploaded);
+        json << number;
+    }
+    if (streaming)
+    {
+        // Covers the whole run, warmup included, streaming starts with the first frame
+        snprintf(number, sizeof(number),
+            ",\n  \"streaming\": { \"requested\": %zu, \"loaded\": %zu, \"failed\": %zu, \"shared\": %zu, \"bytesRead\": %zu, \"bytesUploaded\": %zu, ",
+            streaming->requested, streaming->loaded, streaming->failed, streaming->shared, streaming->bytesRead,
+            streaming->bytesUploaded);
+        json << number;
+        snprintf(number, sizeof(number),
+            "\"framesStreaming\": %zu, \"framesOverBudget\": %zu, \"worstFrameMs\": %.4f, \"worstUploadMs\": %.4f, \"secondsToIdle\": %.4f }",
+            streaming->framesStreaming, streaming->framesOverBudget, streaming->worstFrameMs, streaming->worstUploadMs,
+            streaming->secondsToIdle);
+        json << number;
+    }
+    snprintf(number, sizeof(number), ",\n  \"budgetP95Ms\": %.4f,\n  \"passed\": %s\n}\n",
+        settings.budgetP95, bPassed ? "true" : "false");
+    json << number;
+
+    if (settings.outputFile.empty())
+    {
+        std::cout << json.str();
+        return true;
+    }
+
+    std::ofstream file(settings.outputFile.c_str(), std::ios::out | std::ios::trunc);
+    if (!file)
+    {
+        std::cerr << "Benchmark: unable to write " << settings.outputFile << std::endl;
+        return false;
+    }
+    file << json.str();
+    return (bool)file;
+}
+
+CameraPath::CameraPath()
+{
+}
+
+/**
+    Adds a key, keys may be added in any order
+    @param fTime - seconds from the start of the path
+    @param position - camera position
+    @param fPitch - radians, see Camera::setOrientation
+    @param fYaw - radians
+*/
+void CameraPath::addKey(float fTime, glm::vec3 position, float fPitch, float fYaw)
+{
+    Key key = { fTime, position, fPitch, fYaw };
+    std::vector<Key>::iterator it = m_keys.begin();
+    while (it != m_keys.end() && it->time <= fTime)
+    {
+        ++it;
+    }
+    m_keys.insert(it, key);
+}
+
+/**
+    Replaces the keys with those of a path file
+    @param fileName - see the class description for the format
+    @return false if the file is missing or holds no valid key
+*/
+bool CameraPath::load(const std::string & fileName)
+{
+    std::ifstream file(fileName.c_str());
+    if (!file)
+    {
+        std::cerr << "Camera path: unable to open " << fileName << std::endl;
+        return false;
+    }
+
+    m_keys.clear();
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream values(line);
+        float fTime, fPitch, fYaw;
+        glm::vec3 position;
+        if (!(values >> fTime >> position.x >> position.y >> position.z >> fPitch >> fYaw))
+        {
+            std::cerr << "Camera path: " << fileName << "(" << lineNumber << ") expected \"time x y z pitch yaw\"" << std::endl;
+            continue;
+        }
+        addKey(fTime, position, glm::radians(fPitch), glm::radians(fYaw));
+    }
+
+    return !m_keys.empty();
+}
+
+/**
+    Places the camera where the path is at a point in time
+    @param camera - receives the position and orientation
+    @param fTime - seconds, wraps around the path's duration
+*/
+void CameraPath::apply(Camera & camera, float fTime) const
+{
+    if (m_keys.empty())
+    {
+        return;
+    }
+
+    float fDuration = getDuration();
+    if (fDuration > 0.f)
+    {
+        fTime = m_keys.front().time + std::fmod(std::max(fTime, 0.f), fDuration);
+    }
+
+    size_t next = 0;
+    while (next < m_keys.size() && m_keys[next].time <= fTime)
+    {
+        ++next;
+    }
+
+    const Key & a = m_keys[next > 0 ? next - 1 : 0];
+    const Key & b = m_keys[next < m_keys.size() ? next : m_keys.size() - 1];
+    float fSpan = b.time - a.time;
+    float t = fSpan > 0.f ? glm::clamp((fTime - a.time) / fSpan, 0.f, 1.f) : 0.f;
+
+    camera.setCameraPosition(glm::mix(a.position, b.position, t));
+    camera.setOrientation(glm::mix(a.pitch, b.pitch, t), glm::mix(a.yaw, b.yaw, t));
+}
+
+size_t CameraPath::size() const
+{
+    return m_keys.size();
+}
+
+/**
+    Gets the time between the first and the last key
+*/
+float CameraPath::getDuration() const
+{
+    return m_keys.empty() ? 0.f : m_keys.back().time - m_keys.front().time;
+}
+
+/**
+    Gets the path used when no file is given: a slow sweep around the origin that turns
+    the scene into and out of view, ten seconds long
+*/
+CameraPath CameraPath::makeDefault()
+{
+    CameraPath path;
+    path.addKey(0.f, glm::vec3(0.f, 0.f, 5.f), 0.f, 0.f);
+    path.addKey(2.5f, glm::vec3(3.f, 1.f, 4.f), glm::radians(-10.f), glm::radians(35.f));
+    path.addKey(5.f, glm::vec3(0.f, 2.f, 8.f), glm::radians(-15.f), 0.f);
+    path.addKey(7.5f, glm::vec3(-3.f, 1.f, 4.f), glm::radians(-10.f), glm::radians(-35.f));
+    path.addKey(10.f, glm::vec3(0.f, 0.f, 5.f), 0.f, 0.f);
+    return path;
+}
+
+OffscreenTarget::OffscreenTarget() :
+    m_framebuffer(0), m_colour(0), m_depth(0), m_width(0), m_height(0)
+{
+}
+
+OffscreenTarget::~OffscreenTarget()
+{
+    release();
+}
+
+/**
+    Creates the framebuffer, replacing any earlier one
+    @param width - in pixels
+    @param height - in pixels
+    @return false if the driver reports the framebuffer incomplete
+*/
+bool OffscreenTarget::create(int width, int height)
+{
+    release();
+    m_width = width;
+    m_height = height;
+
+    gl::GenRenderbuffers(1, &m_colour);
+    gl::BindRenderbuffer(gl::RENDERBUFFER, m_colour);
+    gl::RenderbufferStorage(gl::RENDERBUFFER, gl::RGBA8, width, height);
+    gl::GenRenderbuffers(1, &m_depth);
+    gl::BindRenderbuffer(gl::RENDERBUFFER, m_depth);
+    gl::RenderbufferStorage(gl::RENDERBUFFER, gl::DEPTH24_STENCIL8, width, height);
+    gl::BindRenderbuffer(gl::RENDERBUFFER, 0);
+
+    GLStateCache * state = GLStateCache::get();
+    gl::GenFramebuffers(1, &m_framebuffer);
+    state->bindFramebuffer(gl::FRAMEBUFFER, m_framebuffer);
+    gl::FramebufferRenderbuffer(gl::FRAMEBUFFER, gl::COLOR_ATTACHMENT0, gl::RENDERBUFFER, m_colour);
+    gl::FramebufferRenderbuffer(gl::FRAMEBUFFER, gl::DEPTH_STENCIL_ATTACHMENT, gl::RENDERBUFFER, m_depth);
+    GLenum status = gl::CheckFramebufferStatus(gl::FRAMEBUFFER);
+    state->bindFramebuffer(gl::FRAMEBUFFER, 0);
+
+    if (status != gl::FRAMEBUFFER_COMPLETE)
+    {
+        std::cerr << "Offscreen target: framebuffer incomplete (0x" << std::hex << status << std::dec << ")" << std::endl;
+        release();
+        return false;
+    }
+    return true;
+}
+
+/**
+    Draws into the target from now on and sets the viewport to cover it
+*/
+void OffscreenTarget::bind()
+{
+    GLStateCache * state = GLStateCache::get();
+    state->bindFramebuffer(gl::FRAMEBUFFER, m_framebuffer);
+    state->viewport(0, 0, m_width, m_height);
+}
+
+/**
+    Deletes the framebuffer and its renderbuffers
+*/
+void OffscreenTarget::release()
+{
+    if (m_framebuffer)
+    {
+        GLStateCache::get()->releaseFramebuffer(m_framebuffer);
+        gl::DeleteFramebuffers(1, &m_framebuffer);
+    }
+    if (m_colour)
+    {
+        gl::DeleteRenderbuffers(1, &m_colour);
+    }
+    if (m_depth)
+    {
+        gl::DeleteRenderbuffers(1, &m_depth);
+    }
+    m_framebuffer = 0;
+    m_colour = 0;
+    m_depth = 0;
+}
+
+GLuint OffscreenTarget::getFramebuffer() const
+{
+    return m_framebuffer;
+}
@@ -0,0 +1,113 @@
+/**
+    @headerfile benchmark.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <gl_core_4_3.hpp>
+#include <glm\glm.hpp>
+#include <Graphics-Engine\asset-streamer.h>
+#include <Graphics-Engine\camera.h>
+#include <Graphics-Engine\gl-recorder.h>
+#include <Graphics-Engine\gpu-profiler.h>
+
+//! How WindowManager::runBenchmark renders and where it reports.
+struct BenchmarkSettings
+{
+    int frames; //! Frames measured
+    int warmupFrames; //! Frames rendered first and not measured, while caches and drivers settle
+    int width; //! Offscreen target size
+    int height;
+    std::string cameraPathFile; //! Keyframes to fly along, empty for the built in path
+    std::string outputFile; //! JSON report, empty prints it to the console
+    double budgetP95; //! Milliseconds the 95th percentile may reach, 0 for no budget
+};
+
+BenchmarkSettings getDefaultBenchmarkSettings();
+
+//! Distribution of frame times in milliseconds.
+struct FrameTimeStats
+{
+    size_t frames;
+    double mean;
+    double min;
+    double p50;
+    double p95;
+    double p99;
+    double max;
+};
+
+FrameTimeStats computeFrameTimeStats(const std::vector<double> & milliseconds);
+
+bool writeBenchmarkReport(const BenchmarkSettings & settings, const FrameTimeStats & stats,
+    const std::vector<GpuTiming> & gpuAverages, int gpuDropped, const GLRecorderStats * glCalls, const StreamingStats * streaming, bool bPassed);
+
+/**
+    Camera positions and angles at points in time. Between two keys the camera moves in
+    a straight line and turns linearly, past the last key the path loops, so a run of any
+    length sees the same views every time.
+
+    A path file holds one key per line as "time x y z pitch yaw", seconds and degrees.
+    Lines starting with '#' are ignored.
+*/
+class CameraPath
+{
+    public:
+        CameraPath();
+
+        void addKey(float fTime, glm::vec3 position, float fPitch, float fYaw);
+        bool load(const std::string & fileName);
+        void apply(Camera & camera, float fTime) const;
+
+        size_t size() const;
+        float getDuration() const;
+
+        static CameraPath makeDefault();
+
+    private:
+        struct Key
+        {
+            float time;
+            glm::vec3 position;
+            float pitch; //! Radians
+            float yaw;
+        };
+
+        std::vector<Key> m_keys; //! Sorted by time
+};
+
+/**
+    A framebuffer with colour and depth renderbuffers, for rendering without a visible
+    window
+*/
+class OffscreenTarget
+{
+    public:
+        OffscreenTarget();
+        ~OffscreenTarget();
+
+        bool create(int width, int height);
+        void bind();
+        void release();
+
+        GLuint getFramebuffer() const;
+
+    private:
+        GLuint m_framebuffer;
+        GLuint m_colour;
+        GLuint m_depth;
+        int m_width;
+        int m_height;
+
+        OffscreenTarget(const OffscreenTarget &);
+        OffscreenTarget & operator=(const OffscreenTarget &);
+};
+
+#endif // !_BENCHMARK_H
@@ -0,0 +1,906 @@
+/**
+    @file bounding-volume-hierarchy.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\bounding-volume-hierarchy.h>
+#include <Engine-Core\frame-allocator.h>
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+namespace BvhInfo
+{
+    const int BIN_COUNT = 16; //! Split candidates per axis in build()
+
+    struct Bin
+    {
+        BoundingBox box;
+        int count;
+    };
+
+    /**
+        An empty box that any merge replaces
+    */
+    inline BoundingBox emptyBox()
+    {
+        BoundingBox box = { glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX) };
+        return box;
+    }
+
+    /**
+        Gets which bin a centroid falls in along an axis
+    */
+    inline int binIndex(float fCentroid, float fMin, float fScale)
+    {
+        int bin = (int)((fCentroid - fMin) * fScale);
+        return glm::clamp(bin, 0, BIN_COUNT - 1);
+    }
+
+    /**
+        Distance along the ray to where it enters the box, FLT_MAX when it misses.
+        @param inverse - 1 / direction per component
+    */
+    inline float rayEntry(const BoundingBox & box, const glm::vec3 & origin, const glm::vec3 & inverse, float fMaxDistance)
+    {
+        glm::vec3 t1 = (box.min - origin) * inverse;
+        glm::vec3 t2 = (box.max - origin) * inverse;
+        glm::vec3 entries = glm::min(t1, t2);
+        glm::vec3 exits = glm::max(t1, t2);
+        float fEnter = glm::max(glm::max(entries.x, entries.y), glm::max(entries.z, 0.f));
+        float fExit = glm::min(glm::min(exits.x, exits.y), glm::min(exits.z, fMaxDistance));
+        return fEnter <= fExit ? fEnter : FLT_MAX;
+    }
+}
+
+/**
+    Gets the surface area, the cost of a node in the SAH is proportional to it
+*/
+float BoundingBox::surfaceArea() const
+{
+    glm::vec3 size = max - min;
+    return 2.f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+/**
+    Checks if other lies completely inside this box
+*/
+bool BoundingBox::contains(const BoundingBox & other) const
+{
+    return glm::all(glm::lessThanEqual(min, other.min)) && glm::all(glm::greaterThanEqual(max, other.max));
+}
+
+/**
+    Checks if the boxes share any point
+*/
+bool BoundingBox::overlaps(const BoundingBox & other) const
+{
+    return glm::all(glm::lessThanEqual(min, other.max)) && glm::all(glm::greaterThanEqual(max, other.min));
+}
+
+/**
+    Gets the smallest box enclosing both boxes
+*/
+BoundingBox BoundingBox::merge(const BoundingBox & a, const BoundingBox & b)
+{
+    BoundingBox box = { glm::min(a.min, b.min), glm::max(a.max, b.max) };
+    return box;
+}
+
+/**
+    Creates an empty tree
+    @param fMargin - distance every leaf box is grown by, movements within it are free
+*/
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(float fMargin) :
+    m_root(INVALID_PROXY), m_freeList(INVALID_PROXY), m_proxyCount(0), m_fMargin(fMargin)
+{
+
+}
+
+/**
+    Adds an object to the tree
+    @param box - world space bounds of the object
+    @param userData - returned by queries for this object
+    @return proxy used to move or remove the object
+*/
+int BoundingVolumeHierarchy::insert(const BoundingBox & box, uint32_t userData)
+{
+    int proxy = allocateNode();
+    Node & node = m_nodes[proxy];
+    node.box.min = box.min - glm::vec3(m_fMargin);
+    node.box.max = box.max + glm::vec3(m_fMargin);
+    node.tightBox = box;
+    node.userData = userData;
+
+    insertLeaf(proxy);
+    ++m_proxyCount;
+    return proxy;
+}
+
+/**
+    Removes an object from the tree
+    @param proxy - returned by insert
+*/
+void BoundingVolumeHierarchy::remove(int proxy)
+{
+    removeLeaf(proxy);
+    freeNode(proxy);
+    --m_proxyCount;
+}
+
+/**
+    Updates an object's bounds. Nothing changes while the box stays inside the enlarged
+    leaf box. A box that still overlaps it refits the ancestors in place, a box that left
+    it completely is taken out and inserted again where it now belongs.
+    @param proxy - returned by insert
+    @param box - new world space bounds
+    @return true if the tree changed
+*/
+bool BoundingVolumeHierarchy::move(int proxy, const BoundingBox & box)
+{
+    Node & node = m_nodes[proxy];
+    node.tightBox = box;
+    if (node.box.contains(box))
+    {
+        return false;
+    }
+
+    BoundingBox fatBox = { box.min - glm::vec3(m_fMargin), box.max + glm::vec3(m_fMargin) };
+    if (!node.box.overlaps(fatBox))
+    {
+        removeLeaf(proxy);
+        m_nodes[proxy].box = fatBox;
+        insertLeaf(proxy);
+        return true;
+    }
+
+    node.box = fatBox;
+    refitFrom(node.parent);
+    return true;
+}
+
+/**
+    Rebuilds every internal node top-down, splitting each range where the binned surface
+    area heuristic is lowest. Leaves, and so every proxy, are kept.
+*/
+void BoundingVolumeHierarchy::build()
+{
+    ScratchScope scratch;
+    ScratchVector<int> leaves;
+    leaves.reserve(m_proxyCount);
+    for (size_t i = 0; i < m_nodes.size(); i++)
+    {
+        Node & node = m_nodes[i];
+        if (node.height < 0)
+        {
+            continue;
+        }
+        if (node.isLeaf())
+        {
+            leaves.push_back((int)i);
+        }
+        else
+        {
+            freeNode((int)i);
+        }
+    }
+
+    m_root = leaves.empty() ? INVALID_PROXY : buildRange(&leaves[0], (int)leaves.size());
+    if (m_root != INVALID_PROXY)
+    {
+        m_nodes[m_root].parent = INVALID_PROXY;
+    }
+}
+
+/**
+    Removes every object
+*/
+void BoundingVolumeHierarchy::clear()
+{
+    m_nodes.clear();
+    m_root = INVALID_PROXY;
+    m_freeList = INVALID_PROXY;
+    m_proxyCount = 0;
+}
+
+uint32_t BoundingVolumeHierarchy::getUserData(int proxy) const
+{
+    return m_nodes[proxy].userData;
+}
+
+/**
+    Gets the enlarged box the tree stores for an object
+*/
+const BoundingBox & BoundingVolumeHierarchy::getFatBox(int proxy) const
+{
+    return m_nodes[proxy].box;
+}
+
+/**
+    Finds every object whose box reaches into the frustum. Planes a node lies completely
+    inside of are not tested again below it, and a node inside all of them adds its whole
+    subtree without further tests. Leaves still crossing a plane are gathered and their
+    object boxes culled together by cullBoxes once the traversal is done.
+    @param frustum - normalised planes, see Camera::getFrustum
+    @param results - cleared, then receives the user data of every visible object
+    @return number of visible objects
+*/
+size_t BoundingVolumeHierarchy::queryFrustum(const Frustum & frustum, std::vector<uint32_t> & results) const
+{
+    results.clear();
+    m_leafBoxes.clear();
+    m_leafData.clear();
+    if (m_root == INVALID_PROXY)
+    {
+        return 0;
+    }
+
+    // Pairs of node and the planes it still has to be tested against
+    m_stack.clear();
+    m_stack.push_back(m_root);
+    m_stack.push_back(0x3F);
+
+    while (!m_stack.empty())
+    {
+        int mask = m_stack.back();
+        m_stack.pop_back();
+        const Node & node = m_nodes[m_stack.back()];
+        m_stack.pop_back();
+
+        // Planes a node's box is inside of hold for the object box within it as well, so
+        // testing a leaf against all six planes in the batch gives the same answer
+        if (node.isLeaf() && mask != 0)
+        {
+            m_leafBoxes.add(node.tightBox.min, node.tightBox.max);
+            m_leafData.push_back(node.userData);
+            continue;
+        }
+        if (mask != 0)
+        {
+            const BoundingBox & box = node.box;
+            glm::vec3 center = (box.min + box.max) * 0.5f;
+            glm::vec3 extent = (box.max - box.min) * 0.5f;
+
+            bool bOutside = false;
+            for (int p = 0; p < 6 && !bOutside; p++)
+            {
+                if (!(mask & (1 << p)))
+                {
+                    continue;
+                }
+                const glm::vec4 & plane = frustum.planes[p];
+                float fDistance = glm::dot(glm::vec3(plane), center) + plane.w;
+                float fRadius = glm::dot(glm::abs(glm::vec3(plane)), extent);
+                if (fDistance + fRadius <= 0.f)
+                {
+                    bOutside = true;
+                }
+                else if (fDistance - fRadius >= 0.f)
+                {
+                    mask &= ~(1 << p);
+                }
+            }
+            if (bOutside)
+            {
+                continue;
+            }
+        }
+
+        if (node.isLeaf())
+        {
+            results.push_back(node.userData);
+        }
+        else
+        {
+            m_stack.push_back(node.child1);
+            m_stack.push_back(mask);
+            m_stack.push_back(node.child2);
+            m_stack.push_back(mask);
+        }
+    }
+
+    cullBoxes(frustum, m_leafBoxes, m_leafVisible);
+    for (size_t i = 0; i < m_leafVisible.size(); i++)
+    {
+        results.push_back(m_leafData[m_leafVisible[i]]);
+    }
+
+    return results.size();
+}
+
+/**
+    Finds every object whose box comes within a distance of a point
+    @param center - point to search around
+    @param fRadius - search distance
+    @param results - cleared, then receives the user data of every object found
+    @return number of objects found
+*/
+size_t BoundingVolumeHierarchy::queryProximity(const glm::vec3 & center, float fRadius, std::vector<uint32_t> & results) const
+{
+    results.clear();
+    if (m_root == INVALID_PROXY)
+    {
+        return 0;
+    }
+
+    float fRadiusSquared = fRadius * fRadius;
+    m_stack.clear();
+    m_stack.push_back(m_root);
+
+    while (!m_stack.empty())
+    {
+        const Node & node = m_nodes[m_stack.back()];
+        m_stack.pop_back();
+
+        const BoundingBox & box = node.isLeaf() ? node.tightBox : node.box;
+        glm::vec3 offset = center - glm::clamp(center, box.min, box.max);
+        if (glm::dot(offset, offset) > fRadiusSquared)
+        {
+            continue;
+        }
+
+        if (node.isLeaf())
+        {
+            results.push_back(node.userData);
+        }
+        else
+        {
+            m_stack.push_back(node.child1);
+            m_stack.push_back(node.child2);
+        }
+    }
+
+    return results.size();
+}
+
+/**
+    Finds the first object box a ray enters. Children are visited nearest first and
+    anything further than the closest hit so far is skipped.
+    @param origin - start of the ray
+    @param direction - direction of the ray, does not need to be normalised
+    @param fMaxDistance - length of the ray in units of direction
+    @param userData - receives the hit object's user data
+    @param fDistance - receives the distance to the hit, in units of direction
+    @return true if anything was hit
+*/
+bool BoundingVolumeHierarchy::raycast(const glm::vec3 & origin, const glm::vec3 & direction, float fMaxDistance,
+    uint32_t & userData, float & fDistance) const
+{
+    if (m_root == INVALID_PROXY)
+    {
+        return false;
+    }
+
+    glm::vec3 inverse = 1.f / direction;
+    float fClosest = fMaxDistance;
+    bool bHit = false;
+
+    m_stack.clear();
+    m_stack.push_back(m_root);
+
+    while (!m_stack.empty())
+    {
+        const Node & node = m_nodes[m_stack.back()];
+        m_stack.pop_back();
+
+        if (node.isLeaf())
+        {
+            float fEntry = BvhInfo::rayEntry(node.tightBox, origin, inverse, fClosest);
+            if (fEntry != FLT_MAX)
+            {
+                fClosest = fEntry;
+                userData = node.userData;
+                bHit = true;
+            }
+            continue;
+        }
+
+        if (BvhInfo::rayEntry(node.box, origin, inverse, fClosest) == FLT_MAX)
+        {
+            continue;
+        }
+
+        // The nearer child goes on top so it is searched first
+        float fEntry1 = BvhInfo::rayEntry(m_nodes[node.child1].box, origin, inverse, fClosest);
+        float fEntry2 = BvhInfo::rayEntry(m_nodes[node.child2].box, origin, inverse, fClosest);
+        int nearChild = fEntry1 <= fEntry2 ? node.child1 : node.child2;
+        int farChild = fEntry1 <= fEntry2 ? node.child2 : node.child1;
+        if (glm::max(fEntry1, fEntry2) != FLT_MAX)
+        {
+            m_stack.push_back(farChild);
+        }
+        if (glm::min(fEntry1, fEntry2) != FLT_MAX)
+        {
+            m_stack.push_back(nearChild);
+        }
+    }
+
+    if (bHit)
+    {
+        fDistance = fClosest;
+    }
+    return bHit;
+}
+
+size_t BoundingVolumeHierarchy::getProxyCount() const
+{
+    return m_proxyCount;
+}
+
+/**
+    Gets the number of levels below the root, 0 for a single object
+*/
+int BoundingVolumeHierarchy::getHeight() const
+{
+    return m_root != INVALID_PROXY ? m_nodes[m_root].height : 0;
+}
+
+/**
+    Gets the summed surface area of the internal nodes over the root's, lower is a better tree
+*/
+float BoundingVolumeHierarchy::getAreaRatio() const
+{
+    if (m_root == INVALID_PROXY)
+    {
+        return 0.f;
+    }
+
+    float fTotal = 0.f;
+    for (size_t i = 0; i < m_nodes.size(); i++)
+    {
+        if (m_nodes[i].height > 0)
+        {
+            fTotal += m_nodes[i].box.surfaceArea();
+        }
+    }
+    return fTotal / m_nodes[m_root].box.surfaceArea();
+}
+
+/**
+    Takes a node off the free list, or grows the node array
+*/
+int BoundingVolumeHierarchy::allocateNode()
+{
+    int index = m_freeList;
+    if (index != INVALID_PROXY)
+    {
+        m_freeList = m_nodes[index].parent;
+    }
+    else
+    {
+        index = (int)m_nodes.size();
+        m_nodes.push_back(Node());
+    }
+
+    Node & node = m_nodes[index];
+    node.parent = INVALID_PROXY;
+    node.child1 = INVALID_PROXY;
+    node.child2 = INVALID_PROXY;
+    node.height = 0;
+    node.userData = 0;
+    return index;
+}
+
+/**
+    Puts a node on the free list, a height of -1 marks it unused
+*/
+void BoundingVolumeHierarchy::freeNode(int index)
+{
+    m_nodes[index].parent = m_freeList;
+    m_nodes[index].height = -1;
+    m_freeList = index;
+}
+
+/**
+    Descends from the root towards the sibling that adds the least surface area, then
+    pairs the leaf with it under a new parent.
+*/
+void BoundingVolumeHierarchy::insertLeaf(int leaf)
+{
+    if (m_root == INVALID_PROXY)
+    {
+        m_root = leaf;
+        m_nodes[leaf].parent = INVALID_PROXY;
+        return;
+    }
+
+    BoundingBox leafBox = m_nodes[leaf].box;
+    int index = m_root;
+    while (!m_nodes[index].isLeaf())
+    {
+        const Node & node = m_nodes[index];
+        float fArea = node.box.surfaceArea();
+        float fCombinedArea = BoundingBox::merge(node.box, leafBox).surfaceArea();
+
+        // Cost of pairing with this node, and the growth every level below has to pay anyway
+        float fCost = 2.f * fCombinedArea;
+        float fInheritedCost = 2.f * (fCombinedArea - fArea);
+
+        float fChildCost[2];
+        int children[2] = { node.child1, node.child2 };
+        for (int c = 0; c < 2; c++)
+        {
+            const Node & child = m_nodes[children[c]];
+            float fMerged = BoundingBox::merge(child.box, leafBox).surfaceArea();
+            fChildCost[c] = (child.isLeaf() ? fMerged : fMerged - child.box.surfaceArea()) + fInheritedCost;
+        }
+
+        if (fCost < fChildCost[0] && fCost < fChildCost[1])
+        {
+            break;
+        }
+        index = fChildCost[0] < fChildCost[1] ? children[0] : children[1];
+    }
+
+    int sibling = index;
+    int oldParent = m_nodes[sibling].parent;
+    int newParent = allocateNode();
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].child1 = sibling;
+    m_nodes[newParent].child2 = leaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+    updateNode(newParent);
+
+    if (oldParent == INVALID_PROXY)
+    {
+        m_root = newParent;
+    }
+    else if (m_nodes[oldParent].child1 == sibling)
+    {
+        m_nodes[oldParent].child1 = newParent;
+    }
+    else
+    {
+        m_nodes[oldParent].child2 = newParent;
+    }
+
+    refitFrom(oldParent);
+}
+
+/**
+    Unlinks a leaf, its sibling takes the place of their shared parent
+*/
+void BoundingVolumeHierarchy::removeLeaf(int leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = INVALID_PROXY;
+        return;
+    }
+
+    int parent = m_nodes[leaf].parent;
+    int grandParent = m_nodes[parent].parent;
+    int sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    m_nodes[sibling].parent = grandParent;
+    if (grandParent == INVALID_PROXY)
+    {
+        m_root = sibling;
+    }
+    else
+    {
+        if (m_nodes[grandParent].child1 == parent)
+        {
+            m_nodes[grandParent].child1 = sibling;
+        }
+        else
+        {
+            m_nodes[grandParent].child2 = sibling;
+        }
+    }
+    freeNode(parent);
+    m_nodes[leaf].parent = INVALID_PROXY;
+
+    refitFrom(grandParent);
+}
+
+/**
+    Recomputes boxes and heights from a node up to the root, rotating every node passed
+*/
+void BoundingVolumeHierarchy::refitFrom(int index)
+{
+    while (index != INVALID_PROXY)
+    {
+        updateNode(index);
+        rotate(index);
+        index = m_nodes[index].parent;
+    }
+}
+
+/**
+    Swaps one of a node's children with a grandchild on the other side when that shrinks
+    the child box that changes. The node's own box stays the same, so nothing above it
+    is affected.
+*/
+void BoundingVolumeHierarchy::rotate(int index)
+{
+    Node & node = m_nodes[index];
+    if (node.height < 2)
+    {
+        return;
+    }
+
+    int b = node.child1;
+    int c = node.child2;
+    float fBestGain = 0.f;
+    int swapChild = INVALID_PROXY; // Child of this node being moved down
+    int swapGrandChild = INVALID_PROXY; // Grandchild on the other side moved up
+
+    // Try moving each child under its sibling in place of one of the sibling's children
+    int children[2] = { b, c };
+    for (int side = 0; side < 2; side++)
+    {
+        int moved = children[side];
+        int other = children[1 - side];
+        const Node & otherNode = m_nodes[other];
+        if (otherNode.isLeaf())
+        {
+            continue;
+        }
+
+        float fArea = otherNode.box.surfaceArea();
+        int grandChildren[2] = { otherNode.child1, otherNode.child2 };
+        for (int g = 0; g < 2; g++)
+        {
+            // The grandchild that stays pairs with the moved child
+            const Node & kept = m_nodes[grandChildren[1 - g]];
+            float fGain = fArea - BoundingBox::merge(kept.box, m_nodes[moved].box).surfaceArea();
+            if (fGain > fBestGain)
+            {
+                fBestGain = fGain;
+                swapChild = moved;
+                swapGrandChild = grandChildren[g];
+            }
+        }
+    }
+
+    if (swapChild == INVALID_PROXY)
+    {
+        return;
+    }
+
+    int other = m_nodes[index].child1 == swapChild ? m_nodes[index].child2 : m_nodes[index].child1;
+    if (m_nodes[index].child1 == swapChild)
+    {
+        m_nodes[index].child1 = swapGrandChild;
+    }
+    else
+    {
+        m_nodes[index].child2 = swapGrandChild;
+    }
+    m_nodes[swapGrandChild].parent = index;
+
+    if (m_nodes[other].child1 == swapGrandChild)
+    {
+        m_nodes[other].child1 = swapChild;
+    }
+    else
+    {
+        m_nodes[other].child2 = swapChild;
+    }
+    m_nodes[swapChild].parent = other;
+
+    updateNode(other);
+    updateNode(index);
+}
+
+/**
+    Recomputes an internal node's box and height from its children
+*/
+void BoundingVolumeHierarchy::updateNode(int index)
+{
+    Node & node = m_nodes[index];
+    const Node & child1 = m_nodes[node.child1];
+    const Node & child2 = m_nodes[node.child2];
+    node.box = BoundingBox::merge(child1.box, child2.box);
+    node.height = 1 + glm::max(child1.height, child2.height);
+}
+
+/**
+    Builds the subtree over a range of leaves. Leaf centroids are sorted into bins along
+    each axis and the range is split at the bin boundary with the lowest SAH cost.
+    @param leaves - leaf indices, reordered in place
+    @param count - number of leaves in the range
+    @return root of the subtree
+*/
+int BoundingVolumeHierarchy::buildRange(int * leaves, int count)
+{
+    if (count == 1)
+    {
+        return leaves[0];
+    }
+
+    BoundingBox centroidBox = BvhInfo::emptyBox();
+    for (int i = 0; i < count; i++)
+    {
+        const BoundingBox & box = m_nodes[leaves[i]].box;
+        glm::vec3 centroid = (box.min + box.max) * 0.5f;
+        centroidBox.min = glm::min(centroidBox.min, centroid);
+        centroidBox.max = glm::max(centroidBox.max, centroid);
+    }
+
+    float fBestCost = FLT_MAX;
+    int bestAxis = -1;
+    int bestSplit = 0;
+    glm::vec3 extent = centroidBox.max - centroidBox.min;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        if (extent[axis] <= 0.f)
+        {
+            continue;
+        }
+
+        float fScale = BvhInfo::BIN_COUNT / extent[axis];
+        BvhInfo::Bin bins[BvhInfo::BIN_COUNT];
+        for (int b = 0; b < BvhInfo::BIN_COUNT; b++)
+        {
+            bins[b].box = BvhInfo::emptyBox();
+            bins[b].count = 0;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            const BoundingBox & box = m_nodes[leaves[i]].box;
+            float fCentroid = (box.min[axis] + box.max[axis]) * 0.5f;
+            BvhInfo::Bin & bin = bins[BvhInfo::binIndex(fCentroid, centroidBox.min[axis], fScale)];
+            bin.box = BoundingBox::merge(bin.box, box);
+            ++bin.count;
+        }
+
+        // Sweep from the right to get the cost of everything after each split
+        float fRightArea[BvhInfo::BIN_COUNT];
+        int rightCount[BvhInfo::BIN_COUNT];
+        BoundingBox right = BvhInfo::emptyBox();
+        int rightTotal = 0;
+        for (int b = BvhInfo::BIN_COUNT - 1; b > 0; b--)
+        {
+            right = BoundingBox::merge(right, bins[b].box);
+            rightTotal += bins[b].count;
+            fRightArea[b] = rightTotal > 0 ? right.surfaceArea() : 0.f;
+            rightCount[b] = rightTotal;
+        }
+
+        BoundingBox left = BvhInfo::emptyBox();
+        int leftCount = 0;
+        for (int split = 1; split < BvhInfo::BIN_COUNT; split++)
+        {
+            left = BoundingBox::merge(left, bins[split - 1].box);
+            leftCount += bins[split - 1].count;
+            if (leftCount == 0 || rightCount[split] == 0)
+            {
+                continue;
+            }
+
+            float fCost = left.surfaceArea() * leftCount + fRightArea[split] * rightCount[split];
+            if (fCost < fBestCost)
+            {
+                fBestCost = fCost;
+                bestAxis = axis;
+                bestSplit = split;
+            }
+        }
+    }
+
+    int middle;
+    if (bestAxis >= 0)
+    {
+        float fScale = BvhInfo::BIN_COUNT / extent[bestAxis];
+        float fMin = centroidBox.min[bestAxis];
+        int * split = std::partition(leaves, leaves + count, [this, bestAxis, bestSplit, fMin, fScale](int leaf)
+        {
+            const BoundingBox & box = m_nodes[leaf].box;
+            return BvhInfo::binIndex((box.min[bestAxis] + box.max[bestAxis]) * 0.5f, fMin, fScale) < bestSplit;
+        });
+        middle = (int)(split - leaves);
+    }
+    else
+    {
+        // Every centroid is the same point, any split is as good as another
+        middle = count / 2;
+    }
+
+    int left = buildRange(leaves, middle);
+    int right = buildRange(leaves + middle, count - middle);
+
+    int index = allocateNode();
+    m_nodes[index].child1 = left;
+    m_nodes[index].child2 = right;
+    m_nodes[left].parent = index;
+    m_nodes[right].parent = index;
+    updateNode(index);
+    return index;
+}
+
+/**
+    Times building, refitting and querying a tree of randomly placed boxes and prints the
+    results. Run with --bench-bvh.
+    @param objectCount - objects in the tree
+*/
+void benchmarkBoundingVolumeHierarchy(size_t objectCount)
+{
+    typedef std::chrono::high_resolution_clock Clock;
+
+    // Keep the density the same at every size, about one object per 64 cubic units
+    float fHalfSize = 2.f * std::cbrt((float)objectCount);
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(-fHalfSize, fHalfSize);
+    std::uniform_real_distribution<float> size(0.25f, 1.f);
+    std::uniform_real_distribution<float> jitter(-0.2f, 0.2f);
+
+    std::vector<BoundingBox> boxes(objectCount);
+    for (size_t i = 0; i < objectCount; i++)
+    {
+        glm::vec3 center(position(random), position(random), position(random));
+        glm::vec3 extent(size(random), size(random), size(random));
+        boxes[i].min = center - extent;
+        boxes[i].max = center + extent;
+    }
+
+    BoundingVolumeHierarchy tree;
+    std::vector<int> proxies(objectCount);
+    std::printf("BVH with %zu objects\n", objectCount);
+
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < objectCount; i++)
+    {
+        proxies[i] = tree.insert(boxes[i], (uint32_t)i);
+    }
+    double fMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::printf("  Insert: %.1f ms, height %d, area ratio %.1f\n", fMs, tree.getHeight(), tree.getAreaRatio());
+
+    start = Clock::now();
+    tree.build();
+    fMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::printf("  SAH build: %.1f ms, height %d, area ratio %.1f\n", fMs, tree.getHeight(), tree.getAreaRatio());
+
+    start = Clock::now();
+    for (size_t i = 0; i < objectCount; i++)
+    {
+        glm::vec3 offset(jitter(random), jitter(random), jitter(random));
+        BoundingBox moved = { boxes[i].min + offset, boxes[i].max + offset };
+        tree.move(proxies[i], moved);
+    }
+    fMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::printf("  Move all: %.1f ms, area ratio %.1f\n", fMs, tree.getAreaRatio());
+
+    std::vector<uint32_t> results;
+    const int queryCount = 1000;
+
+    Camera camera(glm::vec3(0.f), glm::radians(60.f), 1.f, 0.1f, 100.f);
+    Frustum frustum = camera.getFrustum();
+    size_t found = 0;
+    start = Clock::now();
+    for (int i = 0; i < queryCount / 10; i++)
+    {
+        found += tree.queryFrustum(frustum, results);
+    }
+    fMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::printf("  Frustum: %.0f queries/s, %zu visible each\n", queryCount / 10 * 1000.0 / fMs, found / (queryCount / 10));
+
+    std::uniform_real_distribution<float> direction(-1.f, 1.f);
+    int hits = 0;
+    start = Clock::now();
+    for (int i = 0; i < queryCount; i++)
+    {
+        uint32_t userData;
+        float fDistance;
+        glm::vec3 ray(direction(random), direction(random), direction(random));
+        hits += tree.raycast(glm::vec3(0.f), ray, fHalfSize * 2.f, userData, fDistance) ? 1 : 0;
+    }
+    fMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::printf("  Ray: %.0f queries/s, %d hits\n", queryCount * 1000.0 / fMs, hits);
+
+    found = 0;
+    start = Clock::now();
+    for (int i = 0; i < queryCount; i++)
+    {
+        glm::vec3 center(position(random), position(random), position(random));
+        found += tree.queryProximity(center, 5.f, results);
+    }
+    fMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    std::printf("  Proximity: %.0f queries/s, %zu found each\n", queryCount * 1000.0 / fMs, found / queryCount);
+}
@@ -0,0 +1,105 @@
+/**
+    @headerfile bounding-volume-hierarchy.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _BOUNDING_VOLUME_HIERARCHY_H
+#define _BOUNDING_VOLUME_HIERARCHY_H
+
+#include <cstdint>
+#include <vector>
+#include <glm\glm.hpp>
+#include <Graphics-Engine\camera.h>
+#include <Graphics-Engine\frustum-culling.h>
+
+//! Axis aligned box in world space.
+struct BoundingBox
+{
+    glm::vec3 min;
+    glm::vec3 max;
+
+    float surfaceArea() const;
+    bool contains(const BoundingBox & other) const;
+    bool overlaps(const BoundingBox & other) const;
+    static BoundingBox merge(const BoundingBox & a, const BoundingBox & b);
+};
+
+const int INVALID_PROXY = -1;
+
+/**
+    Dynamic bounding volume hierarchy used as the scene's spatial index. Leaves hold a box
+    enlarged by a margin, so small movements do not touch the tree at all, and queries
+    test the object's own box once they reach a leaf, frustum queries a batch of leaves
+    at a time with cullBoxes; larger movements refit
+    the ancestors and apply tree rotations on the way up to keep the surface area low.
+    Objects inserted one by one descend by surface area cost, build() rebuilds the whole
+    tree top-down with a binned SAH split when quality has drifted or after a bulk load.
+
+    Proxies are node indices and stay valid until removed, including across build().
+    Queries share a traversal stack, so a tree must not be queried from two threads at once.
+*/
+class BoundingVolumeHierarchy
+{
+    public:
+        BoundingVolumeHierarchy(float fMargin = 0.1f);
+
+        int insert(const BoundingBox & box, uint32_t userData);
+        void remove(int proxy);
+        bool move(int proxy, const BoundingBox & box);
+        void build();
+        void clear();
+
+        uint32_t getUserData(int proxy) const;
+        const BoundingBox & getFatBox(int proxy) const;
+
+        size_t queryFrustum(const Frustum & frustum, std::vector<uint32_t> & results) const;
+        size_t queryProximity(const glm::vec3 & center, float fRadius, std::vector<uint32_t> & results) const;
+        bool raycast(const glm::vec3 & origin, const glm::vec3 & direction, float fMaxDistance,
+            uint32_t & userData, float & fDistance) const;
+
+        size_t getProxyCount() const;
+        int getHeight() const;
+        float getAreaRatio() const;
+
+    private:
+        struct Node
+        {
+            BoundingBox box; //! Enlarged by the margin for leaves
+            BoundingBox tightBox; //! The object's own box, leaves only
+            int parent; //! Next free node while on the free list
+            int child1; //! INVALID_PROXY for leaves
+            int child2;
+            int height; //! 0 for leaves
+            uint32_t userData;
+
+            bool isLeaf() const { return child1 == INVALID_PROXY; }
+        };
+
+        std::vector<Node> m_nodes;
+        int m_root;
+        int m_freeList;
+        size_t m_proxyCount;
+        float m_fMargin;
+        mutable std::vector<int> m_stack; //! Traversal scratch, reused between queries
+        mutable BoxBatch m_leafBoxes; //! Leaves a frustum query still has planes to test for
+        mutable std::vector<uint32_t> m_leafData; //! User data of each box in m_leafBoxes
+        mutable std::vector<uint32_t> m_leafVisible;
+
+        BoundingVolumeHierarchy(const BoundingVolumeHierarchy &);
+        BoundingVolumeHierarchy & operator=(const BoundingVolumeHierarchy &);
+
+        int allocateNode();
+        void freeNode(int index);
+        void insertLeaf(int leaf);
+        void removeLeaf(int leaf);
+        void refitFrom(int index);
+        void rotate(int index);
+        void updateNode(int index);
+        int buildRange(int * leaves, int count);
+};
+
+void benchmarkBoundingVolumeHierarchy(size_t objectCount);
+
+#endif // !_BOUNDING_VOLUME_HIERARCHY_H
@@ -27,6 +27,7 @@ Camera::Camera(glm::vec3 position, float fov, float aspectRatio, float nearPlane
 
     m_cameraPosition = position;
     m_fFieldOfView = fov;
+    m_fAspectRatio = aspectRatio;
     m_fFarPlane = farPlane;
     m_fNearPlane = nearPlane;
 
@@ -181,6 +182,18 @@ void Camera::rotateCamera(const float pitch, const float yaw)
     updateCameraView();
 }
 
+/**
+    Replaces the camera's orientation, unlike rotateCamera the result does not depend
+    on earlier rotations
+    @param pitch - radians about the world x axis
+    @param yaw - radians about the world y axis
+*/
+void Camera::setOrientation(float pitch, float yaw)
+{
+    m_orientation = glm::quat(1.f, 0.f, 0.f, 0.f);
+    rotateCamera(pitch, yaw);
+}
+
 /**
     Enables camera zooming
 */
@@ -229,6 +242,29 @@ glm::mat4 Camera::getProjectionMatrix()
     return m_projectionMatrix;
 }
 
+/**
+    Extracts the view frustum planes from the view-projection matrix. The planes are
+    normalised so plane distances are in world units and can be compared to radii.
+    @return frustum in world space
+*/
+Frustum Camera::getFrustum()
+{
+    glm::mat4 m = glm::transpose(m_projectionMatrix * m_viewMatrix);
+    Frustum frustum;
+    frustum.planes[0] = m[3] + m[0]; // Left
+    frustum.planes[1] = m[3] - m[0]; // Right
+    frustum.planes[2] = m[3] + m[1]; // Bottom
+    frustum.planes[3] = m[3] - m[1]; // Top
+    frustum.planes[4] = m[3] + m[2]; // Near
+    frustum.planes[5] = m[3] - m[2]; // Far
+
+    for (int i = 0; i < 6; i++)
+    {
+        frustum.planes[i] /= glm::length(glm::vec3(frustum.planes[i]));
+    }
+    return frustum;
+}
+
 /**
     Gets the camera's axis angle.
     @param axis
@@ -14,6 +14,13 @@
 #include <glm\gtc\matrix_transform.hpp>
 #include <glm\gtc\type_ptr.hpp>
 
+//! View frustum as six planes (left, right, bottom, top, near, far) in world space.
+//! A point p is inside when dot(plane.xyz, p) + plane.w >= 0 for every plane.
+struct Frustum
+{
+    glm::vec4 planes[6];
+};
+
 class Camera
 {
 public:
@@ -35,12 +42,14 @@ public:
     void resetCamera(glm::vec3, float, float, float, float);
     void updateCameraView();
     void rotateCamera(const float, const float);
+    void setOrientation(float, float);
     void zoom(float);
     void pan(float, float);
     void roll(float);
 
     glm::mat4 getViewMatrix();
     glm::mat4 getProjectionMatrix();
+    Frustum getFrustum();
     glm::quat getAxisAngle(glm::vec3, float);
 
 private:
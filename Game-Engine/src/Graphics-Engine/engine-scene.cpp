@@ -1,11 +1,45 @@
 #include<Graphics-Engine\engine-scene.h>
+#include <algorithm>
+#include <cmath>
+#include <Graphics-Engine\asset-streamer.h>
+#include <Graphics-Engine\gl-state-cache.h>
+#include <Graphics-Engine\gpu-profiler.h>
+#include <Graphics-Engine\mesh-file.h>
+#include <Graphics-Engine\shader-batch.h>
+#include <Graphics-Engine\shader-watcher.h>
 
 /**
-    Defualt constructor for our scene in an engine
+    Defualt constructor for our scene in an engine, its program and buffers come from
+    the RenderResources pools
 */
 EngineScene::EngineScene()
 {
+    m_program = RenderResources::get()->createShader();
+    m_cameraBuffer = RenderResources::get()->createBuffer();
+    m_materialBuffer = RenderResources::get()->createBuffer();
+}
 
+/**
+    Hands the program, buffers and meshes back to the pools
+*/
+EngineScene::~EngineScene()
+{
+    // Callbacks of meshes still streaming point at this scene
+    if (AssetStreamer::get())
+    {
+        AssetStreamer::get()->cancelAll();
+    }
+    for (size_t i = 0; i < m_meshes.size(); i++)
+    {
+        RenderResources::get()->destroyMesh(m_meshes[i]);
+    }
+    if (ShaderWatcher::get() && RenderResources::get()->getShader(m_program))
+    {
+        ShaderWatcher::get()->unwatch(getProgram());
+    }
+    RenderResources::get()->destroyShader(m_program);
+    RenderResources::get()->destroyBuffer(m_cameraBuffer);
+    RenderResources::get()->destroyBuffer(m_materialBuffer);
 }
 
 /**
@@ -16,24 +50,50 @@ void EngineScene::initScene(Camera camera)
 {
     //Compile and link the shader into the initialised scene
     compileAndLinkShader();
+    findUniforms();
 
-    gl::Enable(gl::DEPTH_TEST);
+    RenderResources::get()->getBuffer(m_cameraBuffer)->create(gl::UNIFORM_BUFFER, CAMERA_BLOCK, sizeof(CameraBlock));
+    RenderResources::get()->getBuffer(m_materialBuffer)->create(gl::UNIFORM_BUFFER, MATERIAL_BLOCK, sizeof(MaterialBlock));
+    m_objectBuffer.create(gl::UNIFORM_BUFFER, OBJECT_BLOCK, sizeof(ObjectBlock), 1024);
+    m_renderBackend.setObjectBuffer(&m_objectBuffer);
+
+    GLStateCache::get()->setEnabled(gl::DEPTH_TEST, true);
 
     //Set up the lighting in the initialised scene
     setLightingParameters(camera);
+    setMaterial(glm::vec3(0.7f, 1.0f, 0.7f), glm::vec3(0.1f, 0.1f, 0.1f), glm::vec3(0.7f, 1.0f, 0.7f), 100.f);
 
-    //Insert Objects Here using m_filename
-
+    //Insert Objects Here
+    Bounds bounds = { glm::vec3(0.f), 1.f };
+    MeshHandle model = loadModel("resources/Models/cube.mesh", bounds);
+    Entity object = createObject(glm::vec3(0.f), model, 0, bounds);
+    Spin spin = { glm::vec3(0.f, 1.f, 0.f), glm::radians(30.f) };
+    m_world.add(object, spin);
 }
 
 /**
-Updates the scene, this will be mainly used fir animation
+Updates the scene, this will be mainly used fir animation. Called at a fixed rate by the
+main loop, so anything advanced here should scale by the step rather than by frame time.
 
-@param fTime <float> - timer so that the function can update at a specific time rate.
+@param fTimeStep <float> - fixed simulation step in seconds.
 */
-void EngineScene::updateScene(float fTime)
+void EngineScene::updateScene(float fTimeStep)
 {
+    // Keep the last state so rendering can interpolate towards the new one
+    m_world.parallelForEach<Transform, PreviousTransform>([](Transform & current, PreviousTransform & previous)
+    {
+        previous.position = current.position;
+        previous.rotation = current.rotation;
+        previous.scale = current.scale;
+    });
 
+    if (m_bAnimate)
+    {
+        m_world.parallelForEach<Transform, Spin>([fTimeStep](Transform & transform, Spin & spin)
+        {
+            transform.rotation = glm::normalize(glm::angleAxis(spin.fSpeed * fTimeStep, spin.axis) * transform.rotation);
+        });
+    }
 }
 
 /**
@@ -49,57 +109,182 @@ void EngineScene::setLightingParameters(Camera camera)
     LIGHTING SET UP GOES HERE.
     USE THE SET UNIFORM TO SET UP VARIBLES IN THE SHADER FILES.
     */
-    program.setUniform("Ld", 1.0f, 1.0f, 1.0f);
-    program.setUniform("n", 100);
-    program.setUniform("LightPosition", worldLight);
+    ShaderManager & program = getProgram();
+    program.setUniform(m_uniforms.lightIntensity, 1.0f, 1.0f, 1.0f);
+    program.setUniform(m_uniforms.lightPosition, worldLight);
 }
 
 /**
 Render the scene
 
 @param camera <Camera> - use the camera as the viewport.
+@param fAlpha <float> - blend factor between the previous and the latest simulation step.
 */
-void EngineScene::render(Camera camera)
+void EngineScene::render(Camera camera, float fAlpha)
 {
-    gl::Clear(gl::COLOR_BUFFER_BIT | gl::DEPTH_BUFFER_BIT);
+    {
+        GPU_PROFILE_SCOPE("clear");
+        gl::Clear(gl::COLOR_BUFFER_BIT | gl::DEPTH_BUFFER_BIT);
+    }
+
+    // Camera matrices go up once for every object drawn this frame
+    setCameraBlock(camera);
 
     /*
     OBJECTS GO HERE.
-    REMEBER TO SET THE OBJECTS SHADER MATERIALS HERE AS WELL.
+    RECORD A DRAW PACKET PER OBJECT, THE RING IS FLUSHED BEFORE THE BACKEND DRAWS THEM.
     */
+    updateTransforms(fAlpha);
+
+    // Only objects whose bounds reach into the frustum get a block
+    updateSpatialIndex();
+    m_spatialIndex.queryFrustum(camera.getFrustum(), m_visible);
+
+    // Scene code only records packets, the backend decides the order GL sees them in
+    m_renderQueue.clear();
+    glm::mat4 view = camera.getViewMatrix();
+    GLuint program = (GLuint)getProgram().getHandle();
+    const RenderResources * resources = RenderResources::get();
+    for (size_t i = 0; i < m_visible.size(); i++)
+    {
+        TransformHandle node = m_visible[i];
+        const glm::mat4 & world = m_transforms.getWorld(node);
+        const Renderable & renderable = m_spatialEntries[node].renderable;
+
+        // Objects whose mesh is not loaded, or already gone, carry their state but no vertices
+        const Mesh * mesh = resources->getMesh(renderable.mesh);
+        DrawPacket packet = { program, mesh ? mesh->vertexArray : 0, 0, renderable.material,
+            setMatrices(camera, world), mesh ? mesh->mode : (GLenum)gl::TRIANGLES,
+            mesh ? mesh->indexType : 0, 0, mesh ? mesh->count : 0 };
+        float fDepth = -(view * world[3]).z / camera.getFarPlane();
+        m_renderQueue.submit(makeSortKey(PASS_OPAQUE, packet.program, renderable.material, fDepth), packet);
+    }
+
+    m_objectBuffer.flush();
+    m_renderQueue.sort();
+    m_renderBackend.submit(m_renderQueue);
+    m_objectBuffer.endFrame();
+}
+
+/**
+Feeds the interpolated transform of every moving object into the hierarchy and updates
+the world matrices. Objects that did not move keep their matrices untouched.
+
+@param fAlpha <float> - blend factor between the previous and the latest simulation step.
+*/
+void EngineScene::updateTransforms(float fAlpha)
+{
+    m_world.forEach<Transform, PreviousTransform, TransformNode>(
+        [this, fAlpha](Transform & current, PreviousTransform & previous, TransformNode & node)
+    {
+        bool bMoved = previous.position != current.position || previous.rotation != current.rotation ||
+            previous.scale != current.scale;
 
-    model = glm::mat4(1.0f);
-    setMatrices(camera);
+        // One more update after stopping, so the matrix ends up exactly at the final transform
+        if (!bMoved && !node.moving)
+        {
+            return;
+        }
+        node.moving = bMoved ? 1 : 0;
 
-    program.setUniform("Kd", 0.7f, 1.0f, 0.7f);
-    program.setUniform("Ka", 0.1f, 0.1f, 0.1f);
-    program.setUniform("Ep", camera.getCameraPosition());
-    program.setUniform("Ks", 0.7f, 1.0f, 0.7f);
+        glm::vec3 position = glm::mix(previous.position, current.position, fAlpha);
+        glm::quat rotation = glm::slerp(previous.rotation, current.rotation, fAlpha);
+        glm::vec3 scale = glm::mix(previous.scale, current.scale, fAlpha);
 
+        glm::mat4 local = glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation);
+        m_transforms.setLocal(node.handle, glm::scale(local, scale));
+    });
+
+    m_transforms.update();
 }
 
 /**
-Set the matrices so that the MVP matrices are sent to the GPU
+Moves the spatial index entries of every object whose world matrix changed this frame.
+Objects that stayed inside their enlarged box in the index cost nothing more.
+*/
+void EngineScene::updateSpatialIndex()
+{
+    const std::vector<TransformHandle> & updated = m_transforms.getUpdatedNodes();
+    for (size_t i = 0; i < updated.size(); i++)
+    {
+        TransformHandle node = updated[i];
+        if (node >= m_spatialEntries.size() || m_spatialEntries[node].proxy == INVALID_PROXY)
+        {
+            continue;
+        }
+        m_spatialIndex.move(m_spatialEntries[node].proxy, worldBounds(node, m_spatialEntries[node].bounds));
+    }
+}
+
+/**
+Gets the world space box around an object's bounding sphere. The radius grows by the
+largest axis scale so scaled objects stay enclosed.
+
+@param node <TransformHandle> - the object's transform.
+@param bounds <Bounds> - bounding sphere in the object's local space.
+@return box in world space.
+*/
+BoundingBox EngineScene::worldBounds(TransformHandle node, const Bounds & bounds)
+{
+    const glm::mat4 & world = m_transforms.getWorld(node);
+    float fScale = glm::max(glm::length(glm::vec3(world[0])),
+        glm::max(glm::length(glm::vec3(world[1])), glm::length(glm::vec3(world[2]))));
+
+    glm::vec3 center = glm::vec3(world * glm::vec4(bounds.center, 1.f));
+    glm::vec3 extent = glm::vec3(bounds.fRadius * fScale);
+    BoundingBox box = { center - extent, center + extent };
+    return box;
+}
+
+/**
+Writes an object's transforms into the per-object ring buffer.
 
 @param camera <Camera> - use the camera as the viewport.
+@param model <glm::mat4> - the object's model matrix.
+@return offset of the object's block, pass it to the ring's bind before drawing.
 */
-void EngineScene::setMatrices(Camera camera)
+GLintptr EngineScene::setMatrices(Camera & camera, const glm::mat4 & model)
 {
-    glm::mat4 modelView = camera.getViewMatrix() * model;
+    ObjectBlock block;
+    block.model = model;
+    block.modelView = camera.getViewMatrix() * model;
+    block.normalMatrix = glm::mat4(glm::mat3(block.modelView));
 
-    /*
-    SET THE MODEL MATRIX VIEW HERE
-    */
+    return m_objectBuffer.push(&block);
+}
+
+/**
+Uploads the per-frame camera block.
+
+@param camera <Camera> - use the camera as the viewport.
+*/
+void EngineScene::setCameraBlock(Camera camera)
+{
+    CameraBlock block;
+    block.view = camera.getViewMatrix();
+    block.projection = camera.getProjectionMatrix();
+    block.viewProjection = block.projection * block.view;
+    block.eyePosition = glm::vec4(camera.getCameraPosition(), 1.f);
+
+    RenderResources::get()->getBuffer(m_cameraBuffer)->update(&block, sizeof(block));
+}
+
+/**
+Uploads the material block used by the following draws.
 
-    glm::mat4 mv = camera.getViewMatrix() * model;
-    program.setUniform("ModelMatrixView", mv);
-    program.setUniform("NormalMatrix", glm::mat3(glm::vec3(mv[0]), glm::vec3(mv[1]), glm::vec3(mv[2])));
-    program.setUniform("MVP", camera.getProjectionMatrix() * mv);
-    glm::mat3 normMat = glm::transpose(glm::inverse(glm::mat3(model)));
-    program.setUniform("M", model);
-    program.setUniform("V", camera.getViewMatrix());
-    program.setUniform("P", camera.getProjectionMatrix());
+@param diffuse <glm::vec3> - diffuse reflectivity.
+@param ambient <glm::vec3> - ambient reflectivity.
+@param specular <glm::vec3> - specular reflectivity.
+@param fShininess <float> - specular exponent.
+*/
+void EngineScene::setMaterial(glm::vec3 diffuse, glm::vec3 ambient, glm::vec3 specular, float fShininess)
+{
+    MaterialBlock block;
+    block.diffuse = glm::vec4(diffuse, 1.f);
+    block.ambient = glm::vec4(ambient, 1.f);
+    block.specular = glm::vec4(specular, fShininess);
 
+    RenderResources::get()->getBuffer(m_materialBuffer)->update(&block, sizeof(block));
 }
 
 /**
@@ -109,7 +294,7 @@ Resizes the viewport.
 */
 void  EngineScene::resize(Camera camera, int winWidth, int winHeight)
 {
-    gl::Viewport(0, 0, winWidth, winHeight);
+    GLStateCache::get()->viewport(0, 0, winWidth, winHeight);
     iWidth = winWidth;
     iHeight = winHeight;
     camera.setAspectRatio((float)winWidth / winHeight);
@@ -120,17 +305,190 @@ Compile and link the shaders
 */
 void EngineScene::compileAndLinkShader()
 {
+    ShaderManager & program = getProgram();
     try
     {
-        program.compileShader("resources/Shaders/shader.vs"); // Vertex Shader File Location
-        program.compileShader("resources/Shaders/shader.fs"); // Fragment Shader File Location
-        program.link();
+        // Vertex and fragment shader file locations, linked from the binary cache when possible.
+        // Programs added to the batch compile together, status is only checked in finish().
+        ShaderBatch shaders;
+        shaders.add(program, { "resources/Shaders/shader.vs", "resources/Shaders/shader.fs" });
+        shaders.submit();
+        shaders.finish();
+        program.bindUniformBlock("CameraBlock", CAMERA_BLOCK);
+        program.bindUniformBlock("MaterialBlock", MATERIAL_BLOCK);
+        program.bindUniformBlock("ObjectBlock", OBJECT_BLOCK);
         program.validate();
         program.use();
+
+        // Edits to the shader files are picked up while running
+        if (ShaderWatcher::get())
+        {
+            ShaderWatcher::get()->watch(program, [this](ShaderManager & reloaded)
+            {
+                reloaded.use();
+                findUniforms();
+                setLightingParameters(Camera());
+            });
+        }
     }
     catch (ShaderProgramException & exception)
     {
         std::cerr << exception.what() << std::endl;
         exit(EXIT_FAILURE);
     }
-}
\ No newline at end of file
+}
+
+/**
+Looks up the uniform handles used by the scene. Uniforms the shaders do not use
+come back as invalid handles, setting those is a no-op.
+*/
+void EngineScene::findUniforms()
+{
+    ShaderManager & program = getProgram();
+    m_uniforms.lightIntensity = program.uniform("Ld");
+    m_uniforms.lightPosition = program.uniform("LightPosition");
+}
+
+/**
+Maps a mesh file written by the converter and uploads it. Nothing in the file is parsed,
+so the load takes as long as reading it from disk.
+
+@param fileName <std::string> - mesh file, see convertMesh.
+@param bounds <Bounds> - set to the mesh's bounding sphere, left alone when loading fails.
+@return handle to the mesh, invalid if the file is missing or not a valid mesh file, or if the
+mesh pool is full.
+*/
+MeshHandle EngineScene::loadModel(const std::string & fileName, Bounds & bounds)
+{
+    PROFILE_SCOPE("EngineScene::loadModel");
+
+    MeshFile file;
+    if (!file.open(fileName))
+    {
+        std::cerr << "Cannot load mesh " << fileName << ", convert models with --convert-mesh" << std::endl;
+        return MeshHandle();
+    }
+
+    // A full pool refuses the mesh, its GL objects are then deleted right away
+    Mesh uploaded = file.upload();
+    MeshHandle mesh = RenderResources::get()->createMesh(uploaded);
+    if (!mesh.isValid())
+    {
+        RenderResources::get()->deleteMesh(uploaded);
+        std::cerr << "Cannot load mesh " << fileName << ", the mesh pool is full" << std::endl;
+        return mesh;
+    }
+
+    const MeshFileBounds & fileBounds = file.getBounds();
+    bounds.center = glm::vec3(fileBounds.center[0], fileBounds.center[1], fileBounds.center[2]);
+    bounds.fRadius = fileBounds.radius;
+
+    m_meshes.push_back(mesh);
+    return mesh;
+}
+
+/**
+Adds an object whose mesh is loaded in the background. Until the mesh arrives the object
+has unit bounds and draws nothing, without a streamer the mesh is loaded at once.
+
+@param fileName <std::string> - mesh file, see convertMesh.
+@param position <glm::vec3> - world position, nearer objects are loaded first.
+@return the object's entity.
+*/
+Entity EngineScene::streamModel(const std::string & fileName, glm::vec3 position)
+{
+    Bounds bounds = { glm::vec3(0.f), 1.f };
+    if (!AssetStreamer::get())
+    {
+        MeshHandle mesh = loadModel(fileName, bounds);
+        return createObject(position, mesh, 0, bounds);
+    }
+
+    Entity entity = createObject(position, MeshHandle(), 0, bounds);
+    AssetStreamer::get()->requestMesh(fileName, position, [this, entity](MeshHandle mesh, const MeshFileBounds & fileBounds)
+    {
+        Renderable * renderable = m_world.get<Renderable>(entity);
+        TransformNode * node = m_world.get<TransformNode>(entity);
+        if (!mesh.isValid() || !renderable || !node)
+        {
+            return;
+        }
+        // Objects streaming the same file share its mesh, it is handed back once
+        if (std::find(m_meshes.begin(), m_meshes.end(), mesh) == m_meshes.end())
+        {
+            m_meshes.push_back(mesh);
+        }
+        renderable->mesh = mesh;
+
+        // Moving the node once more refits its spatial index entry to the real bounds
+        SpatialEntry & entry = m_spatialEntries[node->handle];
+        entry.renderable = *renderable;
+        entry.bounds.center = glm::vec3(fileBounds.center[0], fileBounds.center[1], fileBounds.center[2]);
+        entry.bounds.fRadius = fileBounds.radius;
+        node->moving = 1;
+    });
+    return entity;
+}
+
+/**
+Streams copies of a mesh laid out in a square grid below the scene, to measure how
+loading many objects affects frame times.
+
+@param fileName <std::string> - mesh file, see convertMesh.
+@param count <int> - number of objects.
+*/
+void EngineScene::streamGrid(const std::string & fileName, int count)
+{
+    const float fSpacing = 3.f;
+    int side = (int)std::ceil(std::sqrt((float)count));
+    float fOffset = 0.5f * fSpacing * (side - 1);
+    for (int i = 0; i < count; i++)
+    {
+        glm::vec3 position((i % side) * fSpacing - fOffset, -3.f, (i / side) * fSpacing - fOffset);
+        streamModel(fileName, position);
+    }
+}
+
+/**
+Adds a drawable object to the scene.
+
+@param position <glm::vec3> - world position.
+@param mesh <MeshHandle> - mesh drawn, may be invalid until it is loaded.
+@param material <uint32_t> - material index.
+@param bounds <Bounds> - bounding sphere of the mesh in the object's local space.
+@param parent <TransformHandle> - node the object is attached to, INVALID_TRANSFORM for none.
+@return the object's entity.
+*/
+Entity EngineScene::createObject(glm::vec3 position, MeshHandle mesh, uint32_t material, const Bounds & bounds,
+    TransformHandle parent)
+{
+    Transform transform = { position, glm::quat(1.f, 0.f, 0.f, 0.f), glm::vec3(1.f) };
+    PreviousTransform previous = { position, transform.rotation, transform.scale };
+    Renderable renderable = { mesh, material };
+    TransformNode node = { m_transforms.createNode(parent), 1 };
+
+    Entity entity = m_world.create();
+    m_world.add(entity, node);
+    m_world.add(entity, transform);
+    m_world.add(entity, previous);
+    m_world.add(entity, renderable);
+
+    // The world matrix is not known until the next update, which moves the entry into place
+    SpatialEntry entry = { INVALID_PROXY, bounds, renderable };
+    BoundingBox box = { position + bounds.center - bounds.fRadius, position + bounds.center + bounds.fRadius };
+    entry.proxy = m_spatialIndex.insert(box, node.handle);
+    if (node.handle >= m_spatialEntries.size())
+    {
+        m_spatialEntries.resize(node.handle + 1, SpatialEntry{ INVALID_PROXY, { glm::vec3(0.f), 0.f }, { MeshHandle(), 0 } });
+    }
+    m_spatialEntries[node.handle] = entry;
+    return entity;
+}
+
+/**
+Gets the scene's program from the shader pool.
+*/
+ShaderManager & EngineScene::getProgram()
+{
+    return *RenderResources::get()->getShader(m_program);
+}
@@ -9,32 +9,76 @@
 #define _ENGINE_SCENE_H
 
 #include <iostream>
+#include <string>
 #include <vector>
 #include <gl_core_4_3.hpp>
+#include <Engine-Core\entity-world.h>
+#include <Graphics-Engine\bounding-volume-hierarchy.h>
+#include <Graphics-Engine\render-queue.h>
+#include <Graphics-Engine\render-resources.h>
+#include <Graphics-Engine\scene-components.h>
 #include <Graphics-Engine\shader-manager.h>
+#include <Graphics-Engine\uniform-buffer.h>
 #include <Graphics-Engine\scene.h>
 
 class EngineScene : public Scene
 {
     public:
         EngineScene();
+        ~EngineScene();
 
         void setLightingParameters(Camera camera);
         void initScene(Camera camera);
-        void updateScene(float fTime);
-        void render(Camera camera);
+        void updateScene(float fTimeStep);
+        void render(Camera camera, float fAlpha);
         void resize(Camera camera, int, int);
+        void streamGrid(const std::string & fileName, int count);
 
     private:
-        ShaderManager program; // GLSL Program
+        ShaderHandle m_program; // GLSL Program
+
+        // Uniform handles looked up once after the program is linked
+        struct SceneUniforms
+        {
+            UniformHandle lightIntensity, lightPosition;
+        } m_uniforms;
+
+        BufferHandle m_cameraBuffer; // CameraBlock, written once per frame
+        BufferHandle m_materialBuffer; // MaterialBlock, written when the material changes
+        UniformRingBuffer m_objectBuffer; // ObjectBlock per drawn object
         int iHeight, iWidth; // Scene width and height
 
-        std::vector<std::string> m_fileName;
+        EntityWorld m_world; // Every object in the scene
+        TransformHierarchy m_transforms; // World matrices of every object, parents before children
+        RenderQueue m_renderQueue; // Draw packets recorded this frame
+        RenderBackend m_renderBackend; // Issues the sorted packets
+
+        // Spatial index entry of a renderable, indexed by its TransformHandle
+        struct SpatialEntry
+        {
+            int proxy;
+            Bounds bounds;
+            Renderable renderable;
+        };
+        BoundingVolumeHierarchy m_spatialIndex; // World bounds of every renderable, queried for visibility
+        std::vector<SpatialEntry> m_spatialEntries;
+        std::vector<uint32_t> m_visible; // Transforms of the renderables inside the frustum this frame
 
-        glm::mat4 model; // Matrix for models that will be uploaded
+        std::vector<MeshHandle> m_meshes; // Meshes loaded by the scene, handed back to the pool with it
 
-        void setMatrices(Camera camera);
+        MeshHandle loadModel(const std::string & fileName, Bounds & bounds);
+        Entity streamModel(const std::string & fileName, glm::vec3 position);
+        Entity createObject(glm::vec3 position, MeshHandle mesh, uint32_t material, const Bounds & bounds,
+            TransformHandle parent = INVALID_TRANSFORM);
+        void updateTransforms(float fAlpha);
+        void updateSpatialIndex();
+        BoundingBox worldBounds(TransformHandle node, const Bounds & bounds);
+        GLintptr setMatrices(Camera & camera, const glm::mat4 & model);
+        void setCameraBlock(Camera camera);
+        void setMaterial(glm::vec3 diffuse, glm::vec3 ambient, glm::vec3 specular, float fShininess);
         void compileAndLinkShader();
+        void findUniforms();
+        ShaderManager & getProgram();
 };
 
 #endif // !_ENGINE_SCENE_H
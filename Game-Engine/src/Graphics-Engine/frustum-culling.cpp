@@ -0,0 +1,360 @@
+/**
+    @file frustum-culling.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\frustum-culling.h>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+#include <immintrin.h>
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+#include <emmintrin.h>
+#endif
+
+namespace CullInfo
+{
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+    /**
+        a * b + c. AVX2 builds are not guaranteed FMA, so this stays a separate multiply and add.
+    */
+    inline __m256 mulAdd(__m256 a, __m256 b, __m256 c)
+    {
+        return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+    }
+#endif
+
+    /**
+        Appends the indices of the set lanes in mask without branching. The output needs
+        room for a full batch past the current count, the unused slots are overwritten later.
+        @param mask - one bit per lane, lane 0 in bit 0
+        @param first - index of lane 0
+        @param out - write position
+        @return number of indices written
+    */
+    inline size_t compact(int mask, uint32_t first, uint32_t * out)
+    {
+        size_t count = 0;
+        for (uint32_t lane = 0; lane < CULL_BATCH_WIDTH; lane++)
+        {
+            out[count] = first + lane;
+            count += (mask >> lane) & 1;
+        }
+        return count;
+    }
+
+    /**
+        Sphere against the frustum, one object at a time. Used for the batch remainder.
+    */
+    inline bool sphereVisible(const Frustum & frustum, float x, float y, float z, float r)
+    {
+        for (int p = 0; p < 6; p++)
+        {
+            const glm::vec4 & plane = frustum.planes[p];
+            if (plane.x * x + plane.y * y + plane.z * z + plane.w <= -r)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+        Box against the frustum, one object at a time. The box is projected onto each
+        plane normal, giving the radius of the box along that normal.
+    */
+    inline bool boxVisible(const Frustum & frustum, float cx, float cy, float cz, float ex, float ey, float ez)
+    {
+        for (int p = 0; p < 6; p++)
+        {
+            const glm::vec4 & plane = frustum.planes[p];
+            float distance = plane.x * cx + plane.y * cy + plane.z * cz + plane.w;
+            float radius = glm::abs(plane.x) * ex + glm::abs(plane.y) * ey + glm::abs(plane.z) * ez;
+            if (distance <= -radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+/**
+    Adds a sphere
+    @param center - world space centre
+    @param fRadius - world space radius
+*/
+void SphereBatch::add(const glm::vec3 & center, float fRadius)
+{
+    x.push_back(center.x);
+    y.push_back(center.y);
+    z.push_back(center.z);
+    radius.push_back(fRadius);
+}
+
+/**
+    Removes every sphere, keeping the memory for the next frame
+*/
+void SphereBatch::clear()
+{
+    x.clear();
+    y.clear();
+    z.clear();
+    radius.clear();
+}
+
+/**
+    Adds a box
+    @param min - world space minimum corner
+    @param max - world space maximum corner
+*/
+void BoxBatch::add(const glm::vec3 & min, const glm::vec3 & max)
+{
+    glm::vec3 center = (min + max) * 0.5f;
+    glm::vec3 extent = (max - min) * 0.5f;
+    centerX.push_back(center.x);
+    centerY.push_back(center.y);
+    centerZ.push_back(center.z);
+    extentX.push_back(extent.x);
+    extentY.push_back(extent.y);
+    extentZ.push_back(extent.z);
+}
+
+/**
+    Removes every box, keeping the memory for the next frame
+*/
+void BoxBatch::clear()
+{
+    centerX.clear();
+    centerY.clear();
+    centerZ.clear();
+    extentX.clear();
+    extentY.clear();
+    extentZ.clear();
+}
+
+/**
+    Tests every sphere against the frustum, CULL_BATCH_WIDTH at a time. The scene keeps
+    boxes, so only benchmarkCulling uses this.
+    @param frustum - normalised planes, see Camera::getFrustum
+    @param spheres - spheres to test
+    @param visible - receives the indices of the spheres at least partly inside, in order
+    @return number of visible spheres
+*/
+size_t cullSpheres(const Frustum & frustum, const SphereBatch & spheres, std::vector<uint32_t> & visible)
+{
+    size_t count = spheres.size();
+    visible.resize(count + CULL_BATCH_WIDTH);
+    uint32_t * out = visible.data();
+    size_t visibleCount = 0;
+    size_t i = 0;
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+    __m256 planeX[6], planeY[6], planeZ[6], planeW[6];
+    for (int p = 0; p < 6; p++)
+    {
+        planeX[p] = _mm256_set1_ps(frustum.planes[p].x);
+        planeY[p] = _mm256_set1_ps(frustum.planes[p].y);
+        planeZ[p] = _mm256_set1_ps(frustum.planes[p].z);
+        planeW[p] = _mm256_set1_ps(frustum.planes[p].w);
+    }
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 x = _mm256_loadu_ps(&spheres.x[i]);
+        __m256 y = _mm256_loadu_ps(&spheres.y[i]);
+        __m256 z = _mm256_loadu_ps(&spheres.z[i]);
+        __m256 negRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(&spheres.radius[i]));
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; p++)
+        {
+            __m256 distance = CullInfo::mulAdd(planeX[p], x,
+                CullInfo::mulAdd(planeY[p], y, CullInfo::mulAdd(planeZ[p], z, planeW[p])));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negRadius, _CMP_GT_OQ));
+        }
+        visibleCount += CullInfo::compact(_mm256_movemask_ps(inside), (uint32_t)i, out + visibleCount);
+    }
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+    __m128 planeX[6], planeY[6], planeZ[6], planeW[6];
+    for (int p = 0; p < 6; p++)
+    {
+        planeX[p] = _mm_set1_ps(frustum.planes[p].x);
+        planeY[p] = _mm_set1_ps(frustum.planes[p].y);
+        planeZ[p] = _mm_set1_ps(frustum.planes[p].z);
+        planeW[p] = _mm_set1_ps(frustum.planes[p].w);
+    }
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(&spheres.x[i]);
+        __m128 y = _mm_loadu_ps(&spheres.y[i]);
+        __m128 z = _mm_loadu_ps(&spheres.z[i]);
+        __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&spheres.radius[i]));
+
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < 6; p++)
+        {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(planeX[p], x), _mm_mul_ps(planeY[p], y)),
+                _mm_add_ps(_mm_mul_ps(planeZ[p], z), planeW[p]));
+            inside = _mm_and_ps(inside, _mm_cmpgt_ps(distance, negRadius));
+        }
+        visibleCount += CullInfo::compact(_mm_movemask_ps(inside), (uint32_t)i, out + visibleCount);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        out[visibleCount] = (uint32_t)i;
+        visibleCount += CullInfo::sphereVisible(frustum, spheres.x[i], spheres.y[i], spheres.z[i], spheres.radius[i]) ? 1 : 0;
+    }
+
+    visible.resize(visibleCount);
+    return visibleCount;
+}
+
+/**
+    Tests every box against the frustum, CULL_BATCH_WIDTH at a time. Used for the leaves
+    of BoundingVolumeHierarchy::queryFrustum.
+    @param frustum - normalised planes, see Camera::getFrustum
+    @param boxes - boxes to test
+    @param visible - receives the indices of the boxes at least partly inside, in order
+    @return number of visible boxes
+*/
+size_t cullBoxes(const Frustum & frustum, const BoxBatch & boxes, std::vector<uint32_t> & visible)
+{
+    size_t count = boxes.size();
+    visible.resize(count + CULL_BATCH_WIDTH);
+    uint32_t * out = visible.data();
+    size_t visibleCount = 0;
+    size_t i = 0;
+
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+    __m256 planeX[6], planeY[6], planeZ[6], planeW[6];
+    __m256 absX[6], absY[6], absZ[6];
+    for (int p = 0; p < 6; p++)
+    {
+        planeX[p] = _mm256_set1_ps(frustum.planes[p].x);
+        planeY[p] = _mm256_set1_ps(frustum.planes[p].y);
+        planeZ[p] = _mm256_set1_ps(frustum.planes[p].z);
+        planeW[p] = _mm256_set1_ps(frustum.planes[p].w);
+        absX[p] = _mm256_set1_ps(glm::abs(frustum.planes[p].x));
+        absY[p] = _mm256_set1_ps(glm::abs(frustum.planes[p].y));
+        absZ[p] = _mm256_set1_ps(glm::abs(frustum.planes[p].z));
+    }
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 cx = _mm256_loadu_ps(&boxes.centerX[i]);
+        __m256 cy = _mm256_loadu_ps(&boxes.centerY[i]);
+        __m256 cz = _mm256_loadu_ps(&boxes.centerZ[i]);
+        __m256 ex = _mm256_loadu_ps(&boxes.extentX[i]);
+        __m256 ey = _mm256_loadu_ps(&boxes.extentY[i]);
+        __m256 ez = _mm256_loadu_ps(&boxes.extentZ[i]);
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; p++)
+        {
+            __m256 distance = CullInfo::mulAdd(planeX[p], cx,
+                CullInfo::mulAdd(planeY[p], cy, CullInfo::mulAdd(planeZ[p], cz, planeW[p])));
+            __m256 radius = CullInfo::mulAdd(absX[p], ex, CullInfo::mulAdd(absY[p], ey, _mm256_mul_ps(absZ[p], ez)));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), _mm256_setzero_ps(), _CMP_GT_OQ));
+        }
+        visibleCount += CullInfo::compact(_mm256_movemask_ps(inside), (uint32_t)i, out + visibleCount);
+    }
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+    __m128 planeX[6], planeY[6], planeZ[6], planeW[6];
+    __m128 absX[6], absY[6], absZ[6];
+    for (int p = 0; p < 6; p++)
+    {
+        planeX[p] = _mm_set1_ps(frustum.planes[p].x);
+        planeY[p] = _mm_set1_ps(frustum.planes[p].y);
+        planeZ[p] = _mm_set1_ps(frustum.planes[p].z);
+        planeW[p] = _mm_set1_ps(frustum.planes[p].w);
+        absX[p] = _mm_set1_ps(glm::abs(frustum.planes[p].x));
+        absY[p] = _mm_set1_ps(glm::abs(frustum.planes[p].y));
+        absZ[p] = _mm_set1_ps(glm::abs(frustum.planes[p].z));
+    }
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 cx = _mm_loadu_ps(&boxes.centerX[i]);
+        __m128 cy = _mm_loadu_ps(&boxes.centerY[i]);
+        __m128 cz = _mm_loadu_ps(&boxes.centerZ[i]);
+        __m128 ex = _mm_loadu_ps(&boxes.extentX[i]);
+        __m128 ey = _mm_loadu_ps(&boxes.extentY[i]);
+        __m128 ez = _mm_loadu_ps(&boxes.extentZ[i]);
+
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < 6; p++)
+        {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(planeX[p], cx), _mm_mul_ps(planeY[p], cy)),
+                _mm_add_ps(_mm_mul_ps(planeZ[p], cz), planeW[p]));
+            __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absX[p], ex), _mm_mul_ps(absY[p], ey)),
+                _mm_mul_ps(absZ[p], ez));
+            inside = _mm_and_ps(inside, _mm_cmpgt_ps(_mm_add_ps(distance, radius), _mm_setzero_ps()));
+        }
+        visibleCount += CullInfo::compact(_mm_movemask_ps(inside), (uint32_t)i, out + visibleCount);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        out[visibleCount] = (uint32_t)i;
+        visibleCount += CullInfo::boxVisible(frustum, boxes.centerX[i], boxes.centerY[i], boxes.centerZ[i],
+            boxes.extentX[i], boxes.extentY[i], boxes.extentZ[i]) ? 1 : 0;
+    }
+
+    visible.resize(visibleCount);
+    return visibleCount;
+}
+
+/**
+    Culls randomly placed spheres and boxes against a default camera and prints how many
+    objects are tested per millisecond. Run with --bench-culling.
+    @param objectCount - objects in each batch
+    @param iterations - passes timed per volume type
+*/
+void benchmarkCulling(size_t objectCount, int iterations)
+{
+    Camera camera(glm::vec3(0.f, 0.f, 0.f), glm::radians(60.f), 1.f, 0.1f, 100.f);
+    Frustum frustum = camera.getFrustum();
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(-150.f, 150.f);
+    std::uniform_real_distribution<float> size(0.1f, 2.f);
+
+    SphereBatch spheres;
+    BoxBatch boxes;
+    for (size_t i = 0; i < objectCount; i++)
+    {
+        glm::vec3 center(position(random), position(random), position(random));
+        glm::vec3 extent(size(random), size(random), size(random));
+        spheres.add(center, glm::length(extent));
+        boxes.add(center - extent, center + extent);
+    }
+
+    std::vector<uint32_t> visible;
+    visible.reserve(objectCount + CULL_BATCH_WIDTH);
+
+    std::printf("Culling %zu objects, %zu per batch, %d iterations\n", objectCount, CULL_BATCH_WIDTH, iterations);
+
+    size_t visibleCount = 0;
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        visibleCount = cullSpheres(frustum, spheres, visible);
+    }
+    double sphereMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    std::printf("Spheres: %zu visible, %.0f objects/ms\n", visibleCount, objectCount * iterations / sphereMs);
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        visibleCount = cullBoxes(frustum, boxes, visible);
+    }
+    double boxMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    std::printf("Boxes: %zu visible, %.0f objects/ms\n", visibleCount, objectCount * iterations / boxMs);
+}
@@ -0,0 +1,50 @@
+/**
+    @headerfile frustum-culling.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _FRUSTUM_CULLING_H
+#define _FRUSTUM_CULLING_H
+
+#include <cstdint>
+#include <vector>
+#include <glm\glm.hpp>
+#include <Graphics-Engine\camera.h>
+
+//! Objects tested per instruction by the widest path this build was compiled for.
+#if GLM_ARCH & GLM_ARCH_AVX2_BIT
+const size_t CULL_BATCH_WIDTH = 8;
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+const size_t CULL_BATCH_WIDTH = 4;
+#else
+const size_t CULL_BATCH_WIDTH = 1;
+#endif
+
+//! World space bounding spheres, one array per component so a batch loads straight into registers.
+struct SphereBatch
+{
+    std::vector<float> x, y, z, radius;
+
+    void add(const glm::vec3 & center, float fRadius);
+    void clear();
+    size_t size() const { return radius.size(); }
+};
+
+//! World space axis aligned boxes stored as centre and half extent per component.
+struct BoxBatch
+{
+    std::vector<float> centerX, centerY, centerZ;
+    std::vector<float> extentX, extentY, extentZ;
+
+    void add(const glm::vec3 & min, const glm::vec3 & max);
+    void clear();
+    size_t size() const { return centerX.size(); }
+};
+
+size_t cullSpheres(const Frustum & frustum, const SphereBatch & spheres, std::vector<uint32_t> & visible);
+size_t cullBoxes(const Frustum & frustum, const BoxBatch & boxes, std::vector<uint32_t> & visible);
+void benchmarkCulling(size_t objectCount, int iterations);
+
+#endif // !_FRUSTUM_CULLING_H
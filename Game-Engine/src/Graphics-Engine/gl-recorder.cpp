@@ -0,0 +1,1083 @@
+/**
+    @file gl-recorder.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\gl-recorder.h>
+#include <cstring>
+
+namespace RecorderInfo
+{
+    /**
+        Stands in for any function with nothing worth recording but its name. Forwards
+        to the loaded function, or returns zero from the null driver.
+    */
+    template <int Id, typename Function>
+    struct GenericHook;
+
+    template <int Id, typename R, typename... Args>
+    struct GenericHook<Id, R (CODEGEN_FUNCPTR *)(Args...)>
+    {
+        static R (CODEGEN_FUNCPTR * original)(Args...);
+        static const char * name;
+        static GLCommandType type;
+
+        static R CODEGEN_FUNCPTR call(Args... args)
+        {
+            GLRecorder * recorder = GLRecorder::get();
+            recorder->record(name, type);
+            return recorder->getMode() == GLRecorder::RECORD_FORWARD ? original(args...) : R();
+        }
+    };
+
+    template <int Id, typename R, typename... Args>
+    R (CODEGEN_FUNCPTR * GenericHook<Id, R (CODEGEN_FUNCPTR *)(Args...)>::original)(Args...) = NULL;
+    template <int Id, typename R, typename... Args>
+    const char * GenericHook<Id, R (CODEGEN_FUNCPTR *)(Args...)>::name = NULL;
+    template <int Id, typename R, typename... Args>
+    GLCommandType GenericHook<Id, R (CODEGEN_FUNCPTR *)(Args...)>::type = COMMAND_OTHER;
+
+    //! Loaded functions replaced by the recording functions below.
+    namespace Loaded
+    {
+        decltype(gl::DrawArrays) DrawArrays = NULL;
+        decltype(gl::DrawElements) DrawElements = NULL;
+        decltype(gl::DrawArraysInstanced) DrawArraysInstanced = NULL;
+        decltype(gl::DrawElementsInstanced) DrawElementsInstanced = NULL;
+        decltype(gl::Clear) Clear = NULL;
+        decltype(gl::UseProgram) UseProgram = NULL;
+        decltype(gl::BindVertexArray) BindVertexArray = NULL;
+        decltype(gl::BindBuffer) BindBuffer = NULL;
+        decltype(gl::BindBufferBase) BindBufferBase = NULL;
+        decltype(gl::BindBufferRange) BindBufferRange = NULL;
+        decltype(gl::BindTexture) BindTexture = NULL;
+        decltype(gl::BindFramebuffer) BindFramebuffer = NULL;
+        decltype(gl::BufferData) BufferData = NULL;
+        decltype(gl::BufferSubData) BufferSubData = NULL;
+        decltype(gl::BufferStorage) BufferStorage = NULL;
+        decltype(gl::MapBufferRange) MapBufferRange = NULL;
+        decltype(gl::UnmapBuffer) UnmapBuffer = NULL;
+        decltype(gl::TexSubImage2D) TexSubImage2D = NULL;
+        decltype(gl::Uniform1i) Uniform1i = NULL;
+        decltype(gl::Uniform1ui) Uniform1ui = NULL;
+        decltype(gl::Uniform1f) Uniform1f = NULL;
+        decltype(gl::Uniform2f) Uniform2f = NULL;
+        decltype(gl::Uniform3f) Uniform3f = NULL;
+        decltype(gl::Uniform4f) Uniform4f = NULL;
+        decltype(gl::UniformMatrix3fv) UniformMatrix3fv = NULL;
+        decltype(gl::UniformMatrix4fv) UniformMatrix4fv = NULL;
+        decltype(gl::GenBuffers) GenBuffers = NULL;
+        decltype(gl::GenVertexArrays) GenVertexArrays = NULL;
+        decltype(gl::GenTextures) GenTextures = NULL;
+        decltype(gl::GenFramebuffers) GenFramebuffers = NULL;
+        decltype(gl::GenRenderbuffers) GenRenderbuffers = NULL;
+        decltype(gl::GenQueries) GenQueries = NULL;
+        decltype(gl::CreateProgram) CreateProgram = NULL;
+        decltype(gl::CreateShader) CreateShader = NULL;
+        decltype(gl::DeleteBuffers) DeleteBuffers = NULL;
+        decltype(gl::GetString) GetString = NULL;
+        decltype(gl::GetIntegerv) GetIntegerv = NULL;
+        decltype(gl::GetInteger64v) GetInteger64v = NULL;
+        decltype(gl::GetQueryiv) GetQueryiv = NULL;
+        decltype(gl::GetProgramInterfaceiv) GetProgramInterfaceiv = NULL;
+        decltype(gl::GetShaderiv) GetShaderiv = NULL;
+        decltype(gl::GetProgramiv) GetProgramiv = NULL;
+        decltype(gl::GetShaderInfoLog) GetShaderInfoLog = NULL;
+        decltype(gl::GetProgramInfoLog) GetProgramInfoLog = NULL;
+        decltype(gl::GetAttachedShaders) GetAttachedShaders = NULL;
+        decltype(gl::GetProgramResourceIndex) GetProgramResourceIndex = NULL;
+        decltype(gl::GetUniformLocation) GetUniformLocation = NULL;
+        decltype(gl::GetQueryObjectui64v) GetQueryObjectui64v = NULL;
+        decltype(gl::CheckFramebufferStatus) CheckFramebufferStatus = NULL;
+        decltype(gl::FenceSync) FenceSync = NULL;
+        decltype(gl::ClientWaitSync) ClientWaitSync = NULL;
+    }
+
+    inline bool forwarding()
+    {
+        return GLRecorder::get()->getMode() == GLRecorder::RECORD_FORWARD;
+    }
+
+    /**
+        Size of one texel for the formats and types uploads use
+    */
+    inline int64_t texelSize(GLenum format, GLenum type)
+    {
+        int64_t channels = format == gl::RED ? 1 : format == gl::RG ? 2 : format == gl::RGB || format == gl::BGR ? 3 : 4;
+        int64_t bytes = type == gl::FLOAT || type == gl::UNSIGNED_INT || type == gl::INT ? 4 :
+            type == gl::HALF_FLOAT || type == gl::UNSIGNED_SHORT || type == gl::SHORT ? 2 : 1;
+        return channels * bytes;
+    }
+
+    // Draws
+
+    void CODEGEN_FUNCPTR recordDrawArrays(GLenum mode, GLint first, GLsizei count)
+    {
+        GLRecorder::get()->record("DrawArrays", COMMAND_DRAW, mode, 0, count);
+        if (forwarding())
+        {
+            Loaded::DrawArrays(mode, first, count);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordDrawElements(GLenum mode, GLsizei count, GLenum type, const void * indices)
+    {
+        GLRecorder::get()->record("DrawElements", COMMAND_DRAW, mode, 0, count);
+        if (forwarding())
+        {
+            Loaded::DrawElements(mode, count, type, indices);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instances)
+    {
+        GLRecorder::get()->record("DrawArraysInstanced", COMMAND_DRAW, mode, 0, (int64_t)count * instances);
+        if (forwarding())
+        {
+            Loaded::DrawArraysInstanced(mode, first, count, instances);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instances)
+    {
+        GLRecorder::get()->record("DrawElementsInstanced", COMMAND_DRAW, mode, 0, (int64_t)count * instances);
+        if (forwarding())
+        {
+            Loaded::DrawElementsInstanced(mode, count, type, indices, instances);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordClear(GLbitfield mask)
+    {
+        GLRecorder::get()->record("Clear", COMMAND_CLEAR, mask);
+        if (forwarding())
+        {
+            Loaded::Clear(mask);
+        }
+    }
+
+    // Binds
+
+    void CODEGEN_FUNCPTR recordUseProgram(GLuint program)
+    {
+        GLRecorder::get()->record("UseProgram", COMMAND_BIND, 0, program);
+        if (forwarding())
+        {
+            Loaded::UseProgram(program);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordBindVertexArray(GLuint vertexArray)
+    {
+        GLRecorder::get()->record("BindVertexArray", COMMAND_BIND, 0, vertexArray);
+        if (forwarding())
+        {
+            Loaded::BindVertexArray(vertexArray);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordBindBuffer(GLenum target, GLuint buffer)
+    {
+        GLRecorder::get()->record("BindBuffer", COMMAND_BIND, target, buffer);
+        GLRecorder::get()->bindBuffer(target, buffer);
+        if (forwarding())
+        {
+            Loaded::BindBuffer(target, buffer);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+    {
+        GLRecorder::get()->record("BindBufferBase", COMMAND_BIND, target, buffer);
+        GLRecorder::get()->bindBuffer(target, buffer);
+        if (forwarding())
+        {
+            Loaded::BindBufferBase(target, index, buffer);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+    {
+        GLRecorder::get()->record("BindBufferRange", COMMAND_BIND, target, buffer);
+        GLRecorder::get()->bindBuffer(target, buffer);
+        if (forwarding())
+        {
+            Loaded::BindBufferRange(target, index, buffer, offset, size);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordBindTexture(GLenum target, GLuint texture)
+    {
+        GLRecorder::get()->record("BindTexture", COMMAND_BIND, target, texture);
+        if (forwarding())
+        {
+            Loaded::BindTexture(target, texture);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordBindFramebuffer(GLenum target, GLuint framebuffer)
+    {
+        GLRecorder::get()->record("BindFramebuffer", COMMAND_BIND, target, framebuffer);
+        if (forwarding())
+        {
+            Loaded::BindFramebuffer(target, framebuffer);
+        }
+    }
+
+    // Uploads, allocating a store without data counts as no bytes
+
+    void CODEGEN_FUNCPTR recordBufferData(GLenum target, GLsizeiptr size, const void * data, GLenum usage)
+    {
+        GLRecorder::get()->record("BufferData", COMMAND_UPLOAD, target, 0, data ? size : 0);
+        GLRecorder::get()->resizeBuffer(target, size);
+        if (forwarding())
+        {
+            Loaded::BufferData(target, size, data, usage);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void * data)
+    {
+        GLRecorder::get()->record("BufferSubData", COMMAND_UPLOAD, target, 0, size);
+        if (forwarding())
+        {
+            Loaded::BufferSubData(target, offset, size, data);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordBufferStorage(GLenum target, GLsizeiptr size, const void * data, GLbitfield flags)
+    {
+        GLRecorder::get()->record("BufferStorage", COMMAND_UPLOAD, target, 0, data ? size : 0);
+        GLRecorder::get()->resizeBuffer(target, size);
+        if (forwarding())
+        {
+            Loaded::BufferStorage(target, size, data, flags);
+        }
+    }
+
+    void * CODEGEN_FUNCPTR recordMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+    {
+        GLRecorder::get()->record("MapBufferRange", COMMAND_OTHER, target, 0, length);
+        if (forwarding())
+        {
+            return Loaded::MapBufferRange(target, offset, length, access);
+        }
+        return GLRecorder::get()->mapBuffer(target, offset, length);
+    }
+
+    GLboolean CODEGEN_FUNCPTR recordUnmapBuffer(GLenum target)
+    {
+        GLRecorder::get()->record("UnmapBuffer", COMMAND_OTHER, target);
+        if (forwarding())
+        {
+            return Loaded::UnmapBuffer(target);
+        }
+        return gl::TRUE_;
+    }
+
+    void CODEGEN_FUNCPTR recordTexSubImage2D(GLenum target, GLint level, GLint x, GLint y, GLsizei width, GLsizei height,
+        GLenum format, GLenum type, const void * pixels)
+    {
+        GLRecorder::get()->record("TexSubImage2D", COMMAND_UPLOAD, target, 0, (int64_t)width * height * texelSize(format, type));
+        if (forwarding())
+        {
+            Loaded::TexSubImage2D(target, level, x, y, width, height, format, type, pixels);
+        }
+    }
+
+    // Uniforms, the value counts as uploaded bytes
+
+    void CODEGEN_FUNCPTR recordUniform1i(GLint location, GLint v0)
+    {
+        GLRecorder::get()->record("Uniform1i", COMMAND_UNIFORM, 0, (GLuint)location, 4);
+        if (forwarding())
+        {
+            Loaded::Uniform1i(location, v0);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordUniform1ui(GLint location, GLuint v0)
+    {
+        GLRecorder::get()->record("Uniform1ui", COMMAND_UNIFORM, 0, (GLuint)location, 4);
+        if (forwarding())
+        {
+            Loaded::Uniform1ui(location, v0);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordUniform1f(GLint location, GLfloat v0)
+    {
+        GLRecorder::get()->record("Uniform1f", COMMAND_UNIFORM, 0, (GLuint)location, 4);
+        if (forwarding())
+        {
+            Loaded::Uniform1f(location, v0);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordUniform2f(GLint location, GLfloat v0, GLfloat v1)
+    {
+        GLRecorder::get()->record("Uniform2f", COMMAND_UNIFORM, 0, (GLuint)location, 8);
+        if (forwarding())
+        {
+            Loaded::Uniform2f(location, v0, v1);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+    {
+        GLRecorder::get()->record("Uniform3f", COMMAND_UNIFORM, 0, (GLuint)location, 12);
+        if (forwarding())
+        {
+            Loaded::Uniform3f(location, v0, v1, v2);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+    {
+        GLRecorder::get()->record("Uniform4f", COMMAND_UNIFORM, 0, (GLuint)location, 16);
+        if (forwarding())
+        {
+            Loaded::Uniform4f(location, v0, v1, v2, v3);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+    {
+        GLRecorder::get()->record("UniformMatrix3fv", COMMAND_UNIFORM, 0, (GLuint)location, (int64_t)count * 36);
+        if (forwarding())
+        {
+            Loaded::UniformMatrix3fv(location, count, transpose, value);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+    {
+        GLRecorder::get()->record("UniformMatrix4fv", COMMAND_UNIFORM, 0, (GLuint)location, (int64_t)count * 64);
+        if (forwarding())
+        {
+            Loaded::UniformMatrix4fv(location, count, transpose, value);
+        }
+    }
+
+    // Objects, the null driver makes up names
+
+    inline void makeNames(GLsizei n, GLuint * names)
+    {
+        for (GLsizei i = 0; i < n; i++)
+        {
+            names[i] = GLRecorder::get()->makeName();
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGenBuffers(GLsizei n, GLuint * names)
+    {
+        GLRecorder::get()->record("GenBuffers", COMMAND_CREATE, 0, 0, n);
+        if (forwarding())
+        {
+            Loaded::GenBuffers(n, names);
+        }
+        else
+        {
+            makeNames(n, names);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGenVertexArrays(GLsizei n, GLuint * names)
+    {
+        GLRecorder::get()->record("GenVertexArrays", COMMAND_CREATE, 0, 0, n);
+        if (forwarding())
+        {
+            Loaded::GenVertexArrays(n, names);
+        }
+        else
+        {
+            makeNames(n, names);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGenTextures(GLsizei n, GLuint * names)
+    {
+        GLRecorder::get()->record("GenTextures", COMMAND_CREATE, 0, 0, n);
+        if (forwarding())
+        {
+            Loaded::GenTextures(n, names);
+        }
+        else
+        {
+            makeNames(n, names);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGenFramebuffers(GLsizei n, GLuint * names)
+    {
+        GLRecorder::get()->record("GenFramebuffers", COMMAND_CREATE, 0, 0, n);
+        if (forwarding())
+        {
+            Loaded::GenFramebuffers(n, names);
+        }
+        else
+        {
+            makeNames(n, names);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGenRenderbuffers(GLsizei n, GLuint * names)
+    {
+        GLRecorder::get()->record("GenRenderbuffers", COMMAND_CREATE, 0, 0, n);
+        if (forwarding())
+        {
+            Loaded::GenRenderbuffers(n, names);
+        }
+        else
+        {
+            makeNames(n, names);
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGenQueries(GLsizei n, GLuint * names)
+    {
+        GLRecorder::get()->record("GenQueries", COMMAND_CREATE, 0, 0, n);
+        if (forwarding())
+        {
+            Loaded::GenQueries(n, names);
+        }
+        else
+        {
+            makeNames(n, names);
+        }
+    }
+
+    GLuint CODEGEN_FUNCPTR recordCreateProgram()
+    {
+        GLRecorder::get()->record("CreateProgram", COMMAND_CREATE, 0, 0, 1);
+        return forwarding() ? Loaded::CreateProgram() : GLRecorder::get()->makeName();
+    }
+
+    GLuint CODEGEN_FUNCPTR recordCreateShader(GLenum type)
+    {
+        GLRecorder::get()->record("CreateShader", COMMAND_CREATE, type, 0, 1);
+        return forwarding() ? Loaded::CreateShader(type) : GLRecorder::get()->makeName();
+    }
+
+    void CODEGEN_FUNCPTR recordDeleteBuffers(GLsizei n, const GLuint * names)
+    {
+        GLRecorder::get()->record("DeleteBuffers", COMMAND_DELETE, 0, 0, n);
+        for (GLsizei i = 0; i < n; i++)
+        {
+            GLRecorder::get()->deleteBuffer(names[i]);
+        }
+        if (forwarding())
+        {
+            Loaded::DeleteBuffers(n, names);
+        }
+    }
+
+    // Queries, the null driver reports success and empty programs
+
+    const GLubyte * CODEGEN_FUNCPTR recordGetString(GLenum name)
+    {
+        GLRecorder::get()->record("GetString", COMMAND_QUERY, name);
+        if (forwarding())
+        {
+            return Loaded::GetString(name);
+        }
+        switch (name)
+        {
+            case gl::VENDOR: return (const GLubyte *)"Dark Nebula";
+            case gl::RENDERER: return (const GLubyte *)"Null GL recorder";
+            case gl::VERSION: return (const GLubyte *)"4.3 (Core Profile) null";
+            case gl::SHADING_LANGUAGE_VERSION: return (const GLubyte *)"4.30";
+            default: return (const GLubyte *)"";
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGetIntegerv(GLenum name, GLint * data)
+    {
+        GLRecorder::get()->record("GetIntegerv", COMMAND_QUERY, name);
+        if (forwarding())
+        {
+            Loaded::GetIntegerv(name, data);
+            return;
+        }
+        switch (name)
+        {
+            case gl::UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+            case gl::SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT: *data = 256; break;
+            case gl::MAX_UNIFORM_BLOCK_SIZE: *data = 65536; break;
+            default: *data = 0; break;
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGetInteger64v(GLenum name, GLint64 * data)
+    {
+        GLRecorder::get()->record("GetInteger64v", COMMAND_QUERY, name);
+        if (forwarding())
+        {
+            Loaded::GetInteger64v(name, data);
+        }
+        else
+        {
+            *data = 0;
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGetQueryiv(GLenum target, GLenum name, GLint * params)
+    {
+        GLRecorder::get()->record("GetQueryiv", COMMAND_QUERY, target);
+        if (forwarding())
+        {
+            Loaded::GetQueryiv(target, name, params);
+        }
+        else
+        {
+            *params = 0;
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum name, GLint * params)
+    {
+        GLRecorder::get()->record("GetProgramInterfaceiv", COMMAND_QUERY, programInterface, program);
+        if (forwarding())
+        {
+            Loaded::GetProgramInterfaceiv(program, programInterface, name, params);
+        }
+        else
+        {
+            *params = 0;
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGetShaderiv(GLuint shader, GLenum name, GLint * params)
+    {
+        GLRecorder::get()->record("GetShaderiv", COMMAND_QUERY, name, shader);
+        if (forwarding())
+        {
+            Loaded::GetShaderiv(shader, name, params);
+            return;
+        }
+        *params = name == gl::COMPILE_STATUS ? (GLint)gl::TRUE_ : 0;
+    }
+
+    void CODEGEN_FUNCPTR recordGetProgramiv(GLuint program, GLenum name, GLint * params)
+    {
+        GLRecorder::get()->record("GetProgramiv", COMMAND_QUERY, name, program);
+        if (forwarding())
+        {
+            Loaded::GetProgramiv(program, name, params);
+            return;
+        }
+        *params = name == gl::LINK_STATUS || name == gl::VALIDATE_STATUS || name == gl::COMPLETION_STATUS_KHR ? (GLint)gl::TRUE_ : 0;
+    }
+
+    void CODEGEN_FUNCPTR recordGetShaderInfoLog(GLuint shader, GLsizei size, GLsizei * length, GLchar * log)
+    {
+        GLRecorder::get()->record("GetShaderInfoLog", COMMAND_QUERY, 0, shader);
+        if (forwarding())
+        {
+            Loaded::GetShaderInfoLog(shader, size, length, log);
+            return;
+        }
+        if (length)
+        {
+            *length = 0;
+        }
+        if (log && size > 0)
+        {
+            log[0] = '\0';
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGetProgramInfoLog(GLuint program, GLsizei size, GLsizei * length, GLchar * log)
+    {
+        GLRecorder::get()->record("GetProgramInfoLog", COMMAND_QUERY, 0, program);
+        if (forwarding())
+        {
+            Loaded::GetProgramInfoLog(program, size, length, log);
+            return;
+        }
+        if (length)
+        {
+            *length = 0;
+        }
+        if (log && size > 0)
+        {
+            log[0] = '\0';
+        }
+    }
+
+    void CODEGEN_FUNCPTR recordGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei * count, GLuint * shaders)
+    {
+        GLRecorder::get()->record("GetAttachedShaders", COMMAND_QUERY, 0, program);
+        if (forwarding())
+        {
+            Loaded::GetAttachedShaders(program, maxCount, count, shaders);
+            return;
+        }
+        if (count)
+        {
+            *count = 0;
+        }
+    }
+
+    GLuint CODEGEN_FUNCPTR recordGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar * name)
+    {
+        GLRecorder::get()->record("GetProgramResourceIndex", COMMAND_QUERY, programInterface, program);
+        return forwarding() ? Loaded::GetProgramResourceIndex(program, programInterface, name) : 0;
+    }
+
+    GLint CODEGEN_FUNCPTR recordGetUniformLocation(GLuint program, const GLchar * name)
+    {
+        GLRecorder::get()->record("GetUniformLocation", COMMAND_QUERY, 0, program);
+        return forwarding() ? Loaded::GetUniformLocation(program, name) : -1;
+    }
+
+    void CODEGEN_FUNCPTR recordGetQueryObjectui64v(GLuint query, GLenum name, GLuint64 * params)
+    {
+        GLRecorder::get()->record("GetQueryObjectui64v", COMMAND_QUERY, name, query);
+        if (forwarding())
+        {
+            Loaded::GetQueryObjectui64v(query, name, params);
+            return;
+        }
+        *params = name == gl::QUERY_RESULT_AVAILABLE ? 1 : 0;
+    }
+
+    GLenum CODEGEN_FUNCPTR recordCheckFramebufferStatus(GLenum target)
+    {
+        GLRecorder::get()->record("CheckFramebufferStatus", COMMAND_QUERY, target);
+        return forwarding() ? Loaded::CheckFramebufferStatus(target) : (GLenum)gl::FRAMEBUFFER_COMPLETE;
+    }
+
+    GLsync CODEGEN_FUNCPTR recordFenceSync(GLenum condition, GLbitfield flags)
+    {
+        GLRecorder::get()->record("FenceSync", COMMAND_OTHER, condition);
+        return forwarding() ? Loaded::FenceSync(condition, flags) : (GLsync)(uintptr_t)GLRecorder::get()->makeName();
+    }
+
+    GLenum CODEGEN_FUNCPTR recordClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+    {
+        GLRecorder::get()->record("ClientWaitSync", COMMAND_OTHER);
+        return forwarding() ? Loaded::ClientWaitSync(sync, flags, timeout) : (GLenum)gl::ALREADY_SIGNALED;
+    }
+}
+
+GLRecorder * GLRecorder::s_instance = NULL;
+
+/**
+    Creates a recorder, install() starts recording
+    @param mode - RECORD_FORWARD to pass every call on to the loaded driver, RECORD_NULL
+    to run without one
+*/
+GLRecorder::GLRecorder(Mode mode) :
+    m_mode(mode), m_bCapture(false), m_totalFrames(0), m_nextName(1)
+{
+    memset(&m_frame, 0, sizeof(m_frame));
+    memset(&m_lastFrame, 0, sizeof(m_lastFrame));
+    memset(&m_total, 0, sizeof(m_total));
+    s_instance = this;
+}
+
+GLRecorder::~GLRecorder()
+{
+    uninstall();
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+GLRecorder * GLRecorder::get()
+{
+    return s_instance;
+}
+
+#define RECORD_HOOK(function, type) hook<__LINE__>(gl::function, #function, type)
+#define RECORD_REPLACE(function) replace(gl::function, &RecorderInfo::record##function, RecorderInfo::Loaded::function)
+
+/**
+    Swaps the gl:: function pointers for recording functions. In RECORD_FORWARD mode
+    functions the driver did not load stay NULL, so extension checks still see them
+    missing, and lazily loaded functions are looked up first so the recorder forwards
+    to the driver rather than to a trampoline.
+*/
+void GLRecorder::install()
+{
+    if (isInstalled())
+    {
+        return;
+    }
+    s_instance = this;
+
+    if (m_mode == RECORD_FORWARD)
+    {
+        gl::sys::ResolveAllFunctions();
+    }
+
+    RECORD_REPLACE(DrawArrays);
+    RECORD_REPLACE(DrawElements);
+    RECORD_REPLACE(DrawArraysInstanced);
+    RECORD_REPLACE(DrawElementsInstanced);
+    RECORD_REPLACE(Clear);
+    RECORD_REPLACE(UseProgram);
+    RECORD_REPLACE(BindVertexArray);
+    RECORD_REPLACE(BindBuffer);
+    RECORD_REPLACE(BindBufferBase);
+    RECORD_REPLACE(BindBufferRange);
+    RECORD_REPLACE(BindTexture);
+    RECORD_REPLACE(BindFramebuffer);
+    RECORD_REPLACE(BufferData);
+    RECORD_REPLACE(BufferSubData);
+    RECORD_REPLACE(BufferStorage);
+    RECORD_REPLACE(MapBufferRange);
+    RECORD_REPLACE(UnmapBuffer);
+    RECORD_REPLACE(TexSubImage2D);
+    RECORD_REPLACE(Uniform1i);
+    RECORD_REPLACE(Uniform1ui);
+    RECORD_REPLACE(Uniform1f);
+    RECORD_REPLACE(Uniform2f);
+    RECORD_REPLACE(Uniform3f);
+    RECORD_REPLACE(Uniform4f);
+    RECORD_REPLACE(UniformMatrix3fv);
+    RECORD_REPLACE(UniformMatrix4fv);
+    RECORD_REPLACE(GenBuffers);
+    RECORD_REPLACE(GenVertexArrays);
+    RECORD_REPLACE(GenTextures);
+    RECORD_REPLACE(GenFramebuffers);
+    RECORD_REPLACE(GenRenderbuffers);
+    RECORD_REPLACE(GenQueries);
+    RECORD_REPLACE(CreateProgram);
+    RECORD_REPLACE(CreateShader);
+    RECORD_REPLACE(DeleteBuffers);
+    RECORD_REPLACE(GetString);
+    RECORD_REPLACE(GetIntegerv);
+    RECORD_REPLACE(GetInteger64v);
+    RECORD_REPLACE(GetQueryiv);
+    RECORD_REPLACE(GetProgramInterfaceiv);
+    RECORD_REPLACE(GetShaderiv);
+    RECORD_REPLACE(GetProgramiv);
+    RECORD_REPLACE(GetShaderInfoLog);
+    RECORD_REPLACE(GetProgramInfoLog);
+    RECORD_REPLACE(GetAttachedShaders);
+    RECORD_REPLACE(GetProgramResourceIndex);
+    RECORD_REPLACE(GetUniformLocation);
+    RECORD_REPLACE(GetQueryObjectui64v);
+    RECORD_REPLACE(CheckFramebufferStatus);
+    RECORD_REPLACE(FenceSync);
+    RECORD_REPLACE(ClientWaitSync);
+
+    RECORD_HOOK(ActiveTexture, COMMAND_BIND);
+    RECORD_HOOK(BindRenderbuffer, COMMAND_BIND);
+
+    RECORD_HOOK(Enable, COMMAND_STATE);
+    RECORD_HOOK(Disable, COMMAND_STATE);
+    RECORD_HOOK(BlendFunc, COMMAND_STATE);
+    RECORD_HOOK(DepthFunc, COMMAND_STATE);
+    RECORD_HOOK(DepthMask, COMMAND_STATE);
+    RECORD_HOOK(CullFace, COMMAND_STATE);
+    RECORD_HOOK(ColorMask, COMMAND_STATE);
+    RECORD_HOOK(Viewport, COMMAND_STATE);
+    RECORD_HOOK(Scissor, COMMAND_STATE);
+    RECORD_HOOK(ClearColor, COMMAND_STATE);
+    RECORD_HOOK(PolygonOffset, COMMAND_STATE);
+    RECORD_HOOK(PixelStorei, COMMAND_STATE);
+    RECORD_HOOK(TexParameteri, COMMAND_STATE);
+    RECORD_HOOK(VertexAttribPointer, COMMAND_STATE);
+    RECORD_HOOK(VertexAttribIPointer, COMMAND_STATE);
+    RECORD_HOOK(EnableVertexAttribArray, COMMAND_STATE);
+    RECORD_HOOK(DisableVertexAttribArray, COMMAND_STATE);
+    RECORD_HOOK(VertexAttribDivisor, COMMAND_STATE);
+    RECORD_HOOK(UniformBlockBinding, COMMAND_STATE);
+    RECORD_HOOK(ShaderStorageBlockBinding, COMMAND_STATE);
+    RECORD_HOOK(BindAttribLocation, COMMAND_STATE);
+    RECORD_HOOK(BindFragDataLocation, COMMAND_STATE);
+    RECORD_HOOK(ProgramParameteri, COMMAND_STATE);
+
+    RECORD_HOOK(TexImage2D, COMMAND_UPLOAD);
+    RECORD_HOOK(TexStorage2D, COMMAND_UPLOAD);
+    RECORD_HOOK(FlushMappedBufferRange, COMMAND_UPLOAD);
+    RECORD_HOOK(CopyBufferSubData, COMMAND_UPLOAD);
+    RECORD_HOOK(GenerateMipmap, COMMAND_OTHER);
+
+    RECORD_HOOK(FramebufferRenderbuffer, COMMAND_OTHER);
+    RECORD_HOOK(FramebufferTexture2D, COMMAND_OTHER);
+    RECORD_HOOK(RenderbufferStorage, COMMAND_OTHER);
+    RECORD_HOOK(ShaderSource, COMMAND_OTHER);
+    RECORD_HOOK(CompileShader, COMMAND_OTHER);
+    RECORD_HOOK(AttachShader, COMMAND_OTHER);
+    RECORD_HOOK(DetachShader, COMMAND_OTHER);
+    RECORD_HOOK(LinkProgram, COMMAND_OTHER);
+    RECORD_HOOK(ValidateProgram, COMMAND_OTHER);
+    RECORD_HOOK(ProgramBinary, COMMAND_OTHER);
+    RECORD_HOOK(GetProgramBinary, COMMAND_QUERY);
+    RECORD_HOOK(MaxShaderCompilerThreadsKHR, COMMAND_OTHER);
+    RECORD_HOOK(MaxShaderCompilerThreadsARB, COMMAND_OTHER);
+    RECORD_HOOK(QueryCounter, COMMAND_OTHER);
+    RECORD_HOOK(Flush, COMMAND_OTHER);
+    RECORD_HOOK(Finish, COMMAND_OTHER);
+
+    RECORD_HOOK(GetError, COMMAND_QUERY);
+    RECORD_HOOK(GetProgramResourceiv, COMMAND_QUERY);
+    RECORD_HOOK(GetProgramResourceName, COMMAND_QUERY);
+
+    RECORD_HOOK(DeleteVertexArrays, COMMAND_DELETE);
+    RECORD_HOOK(DeleteTextures, COMMAND_DELETE);
+    RECORD_HOOK(DeleteFramebuffers, COMMAND_DELETE);
+    RECORD_HOOK(DeleteRenderbuffers, COMMAND_DELETE);
+    RECORD_HOOK(DeleteQueries, COMMAND_DELETE);
+    RECORD_HOOK(DeleteShader, COMMAND_DELETE);
+    RECORD_HOOK(DeleteProgram, COMMAND_DELETE);
+    RECORD_HOOK(DeleteSync, COMMAND_DELETE);
+}
+
+#undef RECORD_HOOK
+#undef RECORD_REPLACE
+
+/**
+    Puts the loaded function pointers back
+*/
+void GLRecorder::uninstall()
+{
+    for (size_t i = m_restore.size(); i > 0; i--)
+    {
+        m_restore[i - 1]();
+    }
+    m_restore.clear();
+}
+
+bool GLRecorder::isInstalled() const
+{
+    return !m_restore.empty();
+}
+
+GLRecorder::Mode GLRecorder::getMode() const
+{
+    return m_mode;
+}
+
+/**
+    Keeps every recorded call in the command list, off by default
+*/
+void GLRecorder::setCapture(bool bCapture)
+{
+    m_bCapture = bCapture;
+}
+
+/**
+    Gets the calls captured since the list was last cleared, in the order they were made
+*/
+const std::vector<GLCommand> & GLRecorder::getCommands() const
+{
+    return m_commands;
+}
+
+void GLRecorder::clearCommands()
+{
+    m_commands.clear();
+}
+
+/**
+    Closes the frame's statistics and adds them to the totals
+*/
+void GLRecorder::endFrame()
+{
+    m_lastFrame = m_frame;
+    m_total.calls += m_frame.calls;
+    m_total.draws += m_frame.draws;
+    m_total.vertices += m_frame.vertices;
+    m_total.clears += m_frame.clears;
+    m_total.binds += m_frame.binds;
+    m_total.stateChanges += m_frame.stateChanges;
+    m_total.uniformUploads += m_frame.uniformUploads;
+    m_total.bufferUploads += m_frame.bufferUploads;
+    m_total.bytesUploaded += m_frame.bytesUploaded;
+    m_total.objectsCreated += m_frame.objectsCreated;
+    m_total.objectsDeleted += m_frame.objectsDeleted;
+    ++m_totalFrames;
+    memset(&m_frame, 0, sizeof(m_frame));
+}
+
+/**
+    Gets the calls recorded since the last endFrame
+*/
+const GLRecorderStats & GLRecorder::getFrameStats() const
+{
+    return m_frame;
+}
+
+/**
+    Gets the calls of the frame closed by the last endFrame
+*/
+const GLRecorderStats & GLRecorder::getLastFrameStats() const
+{
+    return m_lastFrame;
+}
+
+/**
+    Gets the calls per frame, averaged over the frames since resetTotals, rounded down
+*/
+GLRecorderStats GLRecorder::getAverageStats() const
+{
+    GLRecorderStats average = m_total;
+    if (m_totalFrames > 0)
+    {
+        average.calls /= m_totalFrames;
+        average.draws /= m_totalFrames;
+        average.vertices /= m_totalFrames;
+        average.clears /= m_totalFrames;
+        average.binds /= m_totalFrames;
+        average.stateChanges /= m_totalFrames;
+        average.uniformUploads /= m_totalFrames;
+        average.bufferUploads /= m_totalFrames;
+        average.bytesUploaded /= m_totalFrames;
+        average.objectsCreated /= m_totalFrames;
+        average.objectsDeleted /= m_totalFrames;
+    }
+    return average;
+}
+
+/**
+    Starts averaging again, e.g. once loading is done
+*/
+void GLRecorder::resetTotals()
+{
+    memset(&m_total, 0, sizeof(m_total));
+    m_totalFrames = 0;
+}
+
+/**
+    Counts a call and captures it when capture is on, done by the recording functions
+    @param name - function name without the gl prefix
+    @param type - which statistic the call counts towards
+    @param target - see GLCommand
+    @param object - see GLCommand
+    @param value - vertices drawn, bytes uploaded or objects created or deleted
+*/
+void GLRecorder::record(const char * name, GLCommandType type, GLenum target, GLuint object, int64_t value)
+{
+    ++m_frame.calls;
+    switch (type)
+    {
+        case COMMAND_DRAW:
+            ++m_frame.draws;
+            m_frame.vertices += (size_t)value;
+            break;
+        case COMMAND_CLEAR: ++m_frame.clears; break;
+        case COMMAND_BIND: ++m_frame.binds; break;
+        case COMMAND_STATE: ++m_frame.stateChanges; break;
+        case COMMAND_UNIFORM:
+            ++m_frame.uniformUploads;
+            m_frame.bytesUploaded += (size_t)value;
+            break;
+        case COMMAND_UPLOAD:
+            ++m_frame.bufferUploads;
+            m_frame.bytesUploaded += (size_t)value;
+            break;
+        case COMMAND_CREATE: m_frame.objectsCreated += value > 0 ? (size_t)value : 1; break;
+        case COMMAND_DELETE: m_frame.objectsDeleted += value > 0 ? (size_t)value : 1; break;
+        default: break;
+    }
+
+    if (m_bCapture)
+    {
+        GLCommand command = { name, type, target, object, value };
+        m_commands.push_back(command);
+    }
+}
+
+/**
+    Hands out a name no other null driver object has
+*/
+GLuint GLRecorder::makeName()
+{
+    return m_nextName++;
+}
+
+/**
+    Null driver: gets memory standing in for part of the buffer bound to a target. The
+    memory stays put until the buffer is given a new store or deleted.
+*/
+void * GLRecorder::mapBuffer(GLenum target, GLintptr offset, GLsizeiptr length)
+{
+    std::vector<char> & store = m_bufferMemory[m_boundBuffers[target]];
+    if (store.size() < (size_t)(offset + length))
+    {
+        store.resize((size_t)(offset + length));
+    }
+    return store.empty() ? NULL : &store[(size_t)offset];
+}
+
+/**
+    Null driver: gives the buffer bound to a target a new store
+*/
+void GLRecorder::resizeBuffer(GLenum target, GLsizeiptr size)
+{
+    if (m_mode == RECORD_NULL)
+    {
+        std::vector<char>(size > 0 ? (size_t)size : 0).swap(m_bufferMemory[m_boundBuffers[target]]);
+    }
+}
+
+/**
+    Null driver: remembers which buffer a target refers to
+*/
+void GLRecorder::bindBuffer(GLenum target, GLuint buffer)
+{
+    if (m_mode == RECORD_NULL)
+    {
+        m_boundBuffers[target] = buffer;
+    }
+}
+
+/**
+    Null driver: frees a buffer's store
+*/
+void GLRecorder::deleteBuffer(GLuint buffer)
+{
+    if (m_mode == RECORD_NULL)
+    {
+        m_bufferMemory.erase(buffer);
+    }
+}
+
+/**
+    Puts a generic recording function in place of a loaded one
+    @param slot - gl:: function pointer
+    @param name - function name, for the command list
+    @param type - which statistic its calls count towards
+*/
+template <int Id, typename Function>
+void GLRecorder::hook(Function & slot, const char * name, GLCommandType type)
+{
+    typedef RecorderInfo::GenericHook<Id, Function> Hook;
+    if (m_mode == RECORD_FORWARD && !slot)
+    {
+        return;
+    }
+
+    Hook::original = slot;
+    Hook::name = name;
+    Hook::type = type;
+    Function loaded = slot;
+    m_restore.push_back([&slot, loaded]() { slot = loaded; });
+    slot = &Hook::call;
+}
+
+/**
+    Puts a specific recording function in place of a loaded one
+    @param slot - gl:: function pointer
+    @param replacement - recording function
+    @param original - receives the loaded function
+*/
+template <typename Function>
+void GLRecorder::replace(Function & slot, Function replacement, Function & original)
+{
+    if (m_mode == RECORD_FORWARD && !slot)
+    {
+        return;
+    }
+
+    original = slot;
+    Function loaded = slot;
+    m_restore.push_back([&slot, loaded]() { slot = loaded; });
+    slot = replacement;
+}
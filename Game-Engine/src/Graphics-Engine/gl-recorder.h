@@ -0,0 +1,137 @@
+/**
+    @headerfile gl-recorder.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _GL_RECORDER_H
+#define _GL_RECORDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <vector>
+#include <gl_core_4_3.hpp>
+
+//! What a recorded GL call does, decides which statistic it counts towards.
+enum GLCommandType
+{
+    COMMAND_DRAW,
+    COMMAND_CLEAR,
+    COMMAND_BIND,
+    COMMAND_STATE,
+    COMMAND_UNIFORM,
+    COMMAND_UPLOAD,
+    COMMAND_CREATE,
+    COMMAND_DELETE,
+    COMMAND_QUERY,
+    COMMAND_OTHER
+};
+
+//! One call that reached the GL function pointers.
+struct GLCommand
+{
+    const char * name; //! Function name without the gl prefix, e.g. "DrawElements"
+    GLCommandType type;
+    GLenum target; //! Draw mode, bind or upload target, 0 when the call has none
+    GLuint object; //! Bound object or uniform location, 0 when the call has none
+    int64_t value; //! Vertices drawn or bytes uploaded, 0 for other calls
+};
+
+//! Calls counted over one frame, or summed over several.
+struct GLRecorderStats
+{
+    size_t calls;
+    size_t draws;
+    size_t vertices; //! Vertices or indices submitted by the draws
+    size_t clears;
+    size_t binds;
+    size_t stateChanges;
+    size_t uniformUploads;
+    size_t bufferUploads;
+    size_t bytesUploaded; //! Buffer data plus uniform values
+    size_t objectsCreated;
+    size_t objectsDeleted;
+};
+
+/**
+    Records every call the engine makes through the gl:: function pointers by swapping
+    the pointers for recording functions, so nothing above the loader changes. Calls are
+    counted per frame and, when capture is on, kept as a command list that tests can
+    compare against.
+
+    In RECORD_FORWARD mode every call is passed on to the driver afterwards. In
+    RECORD_NULL mode there is no driver at all: objects get made up names, queries report
+    success and buffers are mapped to memory the recorder owns, so the engine runs on
+    machines without a graphics stack.
+
+    The most recently created recorder is the installed one. Install it on the GL thread
+    only, and uninstall it before the loaded pointers are needed again.
+*/
+class GLRecorder
+{
+    public:
+        enum Mode
+        {
+            RECORD_FORWARD,
+            RECORD_NULL
+        };
+
+        explicit GLRecorder(Mode mode);
+        ~GLRecorder();
+
+        static GLRecorder * get();
+
+        void install();
+        void uninstall();
+        bool isInstalled() const;
+        Mode getMode() const;
+
+        void setCapture(bool bCapture);
+        const std::vector<GLCommand> & getCommands() const;
+        void clearCommands();
+
+        void endFrame();
+        const GLRecorderStats & getFrameStats() const;
+        const GLRecorderStats & getLastFrameStats() const;
+        GLRecorderStats getAverageStats() const;
+        void resetTotals();
+
+        void record(const char * name, GLCommandType type, GLenum target = 0, GLuint object = 0, int64_t value = 0);
+
+        // Used by the null driver
+        GLuint makeName();
+        void * mapBuffer(GLenum target, GLintptr offset, GLsizeiptr length);
+        void resizeBuffer(GLenum target, GLsizeiptr size);
+        void bindBuffer(GLenum target, GLuint buffer);
+        void deleteBuffer(GLuint buffer);
+
+    private:
+        static GLRecorder * s_instance;
+
+        Mode m_mode;
+        bool m_bCapture;
+        std::vector<std::function<void()>> m_restore; //! Puts the loaded pointers back
+        std::vector<GLCommand> m_commands;
+
+        GLRecorderStats m_frame;
+        GLRecorderStats m_lastFrame;
+        GLRecorderStats m_total;
+        size_t m_totalFrames;
+
+        GLuint m_nextName;
+        std::map<GLenum, GLuint> m_boundBuffers; //! Null driver: buffer bound to each target
+        std::map<GLuint, std::vector<char>> m_bufferMemory; //! Null driver: store of each buffer
+
+        GLRecorder(const GLRecorder &);
+        GLRecorder & operator=(const GLRecorder &);
+
+        template <int Id, typename Function>
+        void hook(Function & slot, const char * name, GLCommandType type);
+        template <typename Function>
+        void replace(Function & slot, Function replacement, Function & original);
+};
+
+#endif // !_GL_RECORDER_H
@@ -0,0 +1,483 @@
+/**
+    @file gl-state-cache.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\gl-state-cache.h>
+#include <cassert>
+#include <cstring>
+
+namespace GLStateInfo
+{
+    const GLuint UNKNOWN = 0xFFFFFFFF; //! Never a valid name or enum, forces the next call
+
+    const GLenum bufferTargets[MAX_CACHED_BUFFER_TARGETS] =
+    {
+        gl::ARRAY_BUFFER, gl::ELEMENT_ARRAY_BUFFER, gl::UNIFORM_BUFFER, gl::SHADER_STORAGE_BUFFER,
+        gl::COPY_READ_BUFFER, gl::COPY_WRITE_BUFFER, gl::PIXEL_PACK_BUFFER, gl::PIXEL_UNPACK_BUFFER,
+        gl::DRAW_INDIRECT_BUFFER, gl::DISPATCH_INDIRECT_BUFFER, gl::ATOMIC_COUNTER_BUFFER,
+        gl::TRANSFORM_FEEDBACK_BUFFER, gl::TEXTURE_BUFFER
+    };
+    const int ELEMENT_ARRAY_SLOT = 1; //! Part of the vertex array's state, not the context's
+
+    const GLenum textureTargets[MAX_CACHED_TEXTURE_TARGETS] =
+    {
+        gl::TEXTURE_2D, gl::TEXTURE_3D, gl::TEXTURE_CUBE_MAP, gl::TEXTURE_2D_ARRAY, gl::TEXTURE_2D_MULTISAMPLE
+    };
+
+    const GLenum capabilities[MAX_CACHED_CAPABILITIES] =
+    {
+        gl::DEPTH_TEST, gl::BLEND, gl::CULL_FACE, gl::SCISSOR_TEST, gl::STENCIL_TEST, gl::POLYGON_OFFSET_FILL,
+        gl::MULTISAMPLE, gl::FRAMEBUFFER_SRGB, gl::PRIMITIVE_RESTART, gl::PROGRAM_POINT_SIZE, gl::DEPTH_CLAMP
+    };
+
+    /**
+        Gets the slot of an enum in one of the tables above, -1 when it is not tracked
+    */
+    inline int findSlot(const GLenum * table, int count, GLenum value)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (table[i] == value)
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+}
+
+GLStateCache * GLStateCache::s_instance = NULL;
+
+/**
+    Creates the cache with every state unknown. It has to outlive every object that
+    binds or deletes GL objects, they reach it through get().
+*/
+GLStateCache::GLStateCache()
+{
+    memset(&m_current, 0, sizeof(m_current));
+    memset(&m_lastFrame, 0, sizeof(m_lastFrame));
+    invalidate();
+    s_instance = this;
+}
+
+GLStateCache::~GLStateCache()
+{
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+/**
+    Gets the cache of the engine's GL context
+*/
+GLStateCache * GLStateCache::get()
+{
+    assert(s_instance && "GL objects are used without a GLStateCache");
+    return s_instance;
+}
+
+/**
+    Forgets every cached value, the next call of each kind reaches the driver
+*/
+void GLStateCache::invalidate()
+{
+    m_program = GLStateInfo::UNKNOWN;
+    m_vertexArray = GLStateInfo::UNKNOWN;
+    for (int i = 0; i < MAX_CACHED_BUFFER_TARGETS; i++)
+    {
+        m_buffers[i] = GLStateInfo::UNKNOWN;
+    }
+    for (int i = 0; i < MAX_CACHED_INDEXED_BINDINGS; i++)
+    {
+        m_uniformBindings[i].buffer = GLStateInfo::UNKNOWN;
+        m_storageBindings[i].buffer = GLStateInfo::UNKNOWN;
+    }
+    for (int unit = 0; unit < MAX_CACHED_TEXTURE_UNITS; unit++)
+    {
+        for (int target = 0; target < MAX_CACHED_TEXTURE_TARGETS; target++)
+        {
+            m_textures[unit][target] = GLStateInfo::UNKNOWN;
+        }
+    }
+    m_activeTexture = GLStateInfo::UNKNOWN;
+    m_drawFramebuffer = GLStateInfo::UNKNOWN;
+    m_readFramebuffer = GLStateInfo::UNKNOWN;
+    memset(m_capabilities, -1, sizeof(m_capabilities));
+    m_blendSource = GLStateInfo::UNKNOWN;
+    m_blendDestination = GLStateInfo::UNKNOWN;
+    m_depthFunction = GLStateInfo::UNKNOWN;
+    m_depthMask = -1;
+    m_cullFace = GLStateInfo::UNKNOWN;
+    m_viewport[0] = m_viewport[1] = m_viewport[2] = m_viewport[3] = -1;
+    m_clearColor[0] = m_clearColor[1] = m_clearColor[2] = m_clearColor[3] = -1.f;
+}
+
+/**
+    Closes the frame's call counts, see getFrameStats
+*/
+void GLStateCache::endFrame()
+{
+    m_lastFrame = m_current;
+    memset(&m_current, 0, sizeof(m_current));
+}
+
+void GLStateCache::useProgram(GLuint program)
+{
+    if (changed(m_program != program))
+    {
+        m_program = program;
+        gl::UseProgram(program);
+    }
+}
+
+/**
+    Binds a vertex array. The element array binding belongs to the vertex array, so it
+    becomes unknown whenever the vertex array changes.
+*/
+void GLStateCache::bindVertexArray(GLuint vertexArray)
+{
+    if (changed(m_vertexArray != vertexArray))
+    {
+        m_vertexArray = vertexArray;
+        m_buffers[GLStateInfo::ELEMENT_ARRAY_SLOT] = GLStateInfo::UNKNOWN;
+        gl::BindVertexArray(vertexArray);
+    }
+}
+
+void GLStateCache::bindBuffer(GLenum target, GLuint buffer)
+{
+    int slot = GLStateInfo::findSlot(GLStateInfo::bufferTargets, MAX_CACHED_BUFFER_TARGETS, target);
+    if (slot < 0)
+    {
+        changed(true);
+        gl::BindBuffer(target, buffer);
+        return;
+    }
+
+    if (changed(m_buffers[slot] != buffer))
+    {
+        m_buffers[slot] = buffer;
+        gl::BindBuffer(target, buffer);
+    }
+}
+
+/**
+    Binds a whole buffer to an indexed binding point, which also sets the target's
+    generic binding
+*/
+void GLStateCache::bindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    IndexedBinding * binding = findIndexedBinding(target, index);
+    if (binding && !changed(binding->buffer != buffer || binding->size != -1))
+    {
+        return;
+    }
+    if (!binding)
+    {
+        changed(true);
+    }
+    else
+    {
+        binding->buffer = buffer;
+        binding->offset = 0;
+        binding->size = -1;
+    }
+
+    int slot = GLStateInfo::findSlot(GLStateInfo::bufferTargets, MAX_CACHED_BUFFER_TARGETS, target);
+    if (slot >= 0)
+    {
+        m_buffers[slot] = buffer;
+    }
+    gl::BindBufferBase(target, index, buffer);
+}
+
+/**
+    Binds part of a buffer to an indexed binding point, which also sets the target's
+    generic binding
+*/
+void GLStateCache::bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    IndexedBinding * binding = findIndexedBinding(target, index);
+    if (binding && !changed(binding->buffer != buffer || binding->offset != offset || binding->size != size))
+    {
+        return;
+    }
+    if (!binding)
+    {
+        changed(true);
+    }
+    else
+    {
+        binding->buffer = buffer;
+        binding->offset = offset;
+        binding->size = size;
+    }
+
+    int slot = GLStateInfo::findSlot(GLStateInfo::bufferTargets, MAX_CACHED_BUFFER_TARGETS, target);
+    if (slot >= 0)
+    {
+        m_buffers[slot] = buffer;
+    }
+    gl::BindBufferRange(target, index, buffer, offset, size);
+}
+
+/**
+    Binds a texture to a unit, switching the active unit only when the binding changes
+    @param unit - texture unit, starting at 0
+    @param target - e.g. gl::TEXTURE_2D
+    @param texture - texture name
+*/
+void GLStateCache::bindTexture(GLuint unit, GLenum target, GLuint texture)
+{
+    int slot = GLStateInfo::findSlot(GLStateInfo::textureTargets, MAX_CACHED_TEXTURE_TARGETS, target);
+    bool bTracked = slot >= 0 && unit < (GLuint)MAX_CACHED_TEXTURE_UNITS;
+    if (!changed(!bTracked || m_textures[unit][slot] != texture))
+    {
+        return;
+    }
+
+    if (m_activeTexture != unit)
+    {
+        m_activeTexture = unit;
+        gl::ActiveTexture(gl::TEXTURE0 + unit);
+        changed(true);
+    }
+    if (bTracked)
+    {
+        m_textures[unit][slot] = texture;
+    }
+    gl::BindTexture(target, texture);
+}
+
+/**
+    Binds a framebuffer, gl::FRAMEBUFFER sets the draw and read bindings together
+*/
+void GLStateCache::bindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    bool bDraw = target == gl::FRAMEBUFFER || target == gl::DRAW_FRAMEBUFFER;
+    bool bRead = target == gl::FRAMEBUFFER || target == gl::READ_FRAMEBUFFER;
+    if (changed((bDraw && m_drawFramebuffer != framebuffer) || (bRead && m_readFramebuffer != framebuffer)))
+    {
+        m_drawFramebuffer = bDraw ? framebuffer : m_drawFramebuffer;
+        m_readFramebuffer = bRead ? framebuffer : m_readFramebuffer;
+        gl::BindFramebuffer(target, framebuffer);
+    }
+}
+
+/**
+    glEnable / glDisable
+*/
+void GLStateCache::setEnabled(GLenum capability, bool bEnabled)
+{
+    int slot = GLStateInfo::findSlot(GLStateInfo::capabilities, MAX_CACHED_CAPABILITIES, capability);
+    int8_t value = bEnabled ? 1 : 0;
+    if (!changed(slot < 0 || m_capabilities[slot] != value))
+    {
+        return;
+    }
+
+    if (slot >= 0)
+    {
+        m_capabilities[slot] = value;
+    }
+    if (bEnabled)
+    {
+        gl::Enable(capability);
+    }
+    else
+    {
+        gl::Disable(capability);
+    }
+}
+
+void GLStateCache::blendFunc(GLenum source, GLenum destination)
+{
+    if (changed(m_blendSource != source || m_blendDestination != destination))
+    {
+        m_blendSource = source;
+        m_blendDestination = destination;
+        gl::BlendFunc(source, destination);
+    }
+}
+
+void GLStateCache::depthFunc(GLenum function)
+{
+    if (changed(m_depthFunction != function))
+    {
+        m_depthFunction = function;
+        gl::DepthFunc(function);
+    }
+}
+
+void GLStateCache::depthMask(bool bWrite)
+{
+    int8_t value = bWrite ? 1 : 0;
+    if (changed(m_depthMask != value))
+    {
+        m_depthMask = value;
+        gl::DepthMask(bWrite ? gl::TRUE_ : gl::FALSE_);
+    }
+}
+
+void GLStateCache::cullFace(GLenum face)
+{
+    if (changed(m_cullFace != face))
+    {
+        m_cullFace = face;
+        gl::CullFace(face);
+    }
+}
+
+void GLStateCache::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    if (changed(m_viewport[0] != x || m_viewport[1] != y || m_viewport[2] != width || m_viewport[3] != height))
+    {
+        m_viewport[0] = x;
+        m_viewport[1] = y;
+        m_viewport[2] = width;
+        m_viewport[3] = height;
+        gl::Viewport(x, y, width, height);
+    }
+}
+
+void GLStateCache::clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    if (changed(m_clearColor[0] != red || m_clearColor[1] != green || m_clearColor[2] != blue || m_clearColor[3] != alpha))
+    {
+        m_clearColor[0] = red;
+        m_clearColor[1] = green;
+        m_clearColor[2] = blue;
+        m_clearColor[3] = alpha;
+        gl::ClearColor(red, green, blue, alpha);
+    }
+}
+
+/**
+    Call when deleting a program. A deleted program stays in use until another is
+    installed, so the binding is only forgotten.
+*/
+void GLStateCache::releaseProgram(GLuint program)
+{
+    if (m_program == program)
+    {
+        m_program = GLStateInfo::UNKNOWN;
+    }
+}
+
+/**
+    Call when deleting a vertex array, GL falls back to vertex array 0 if it was bound
+*/
+void GLStateCache::releaseVertexArray(GLuint vertexArray)
+{
+    if (m_vertexArray == vertexArray)
+    {
+        m_vertexArray = 0;
+        m_buffers[GLStateInfo::ELEMENT_ARRAY_SLOT] = GLStateInfo::UNKNOWN;
+    }
+}
+
+/**
+    Call when deleting a buffer, GL unbinds it from every binding point of the context
+*/
+void GLStateCache::releaseBuffer(GLuint buffer)
+{
+    for (int i = 0; i < MAX_CACHED_BUFFER_TARGETS; i++)
+    {
+        if (m_buffers[i] == buffer)
+        {
+            m_buffers[i] = 0;
+        }
+    }
+    for (int i = 0; i < MAX_CACHED_INDEXED_BINDINGS; i++)
+    {
+        if (m_uniformBindings[i].buffer == buffer)
+        {
+            m_uniformBindings[i].buffer = 0;
+        }
+        if (m_storageBindings[i].buffer == buffer)
+        {
+            m_storageBindings[i].buffer = 0;
+        }
+    }
+}
+
+/**
+    Call when deleting a framebuffer, GL falls back to the default one where it was bound
+*/
+void GLStateCache::releaseFramebuffer(GLuint framebuffer)
+{
+    if (m_drawFramebuffer == framebuffer)
+    {
+        m_drawFramebuffer = 0;
+    }
+    if (m_readFramebuffer == framebuffer)
+    {
+        m_readFramebuffer = 0;
+    }
+}
+
+/**
+    Call when deleting a texture, GL unbinds it from every unit
+*/
+void GLStateCache::releaseTexture(GLuint texture)
+{
+    for (int unit = 0; unit < MAX_CACHED_TEXTURE_UNITS; unit++)
+    {
+        for (int target = 0; target < MAX_CACHED_TEXTURE_TARGETS; target++)
+        {
+            if (m_textures[unit][target] == texture)
+            {
+                m_textures[unit][target] = 0;
+            }
+        }
+    }
+}
+
+/**
+    Gets how many calls reached the driver and how many were dropped during the last
+    complete frame
+*/
+const GLCallStats & GLStateCache::getFrameStats() const
+{
+    return m_lastFrame;
+}
+
+/**
+    Counts a call as issued or filtered
+    @param bChanged - true if the call has to reach the driver
+    @return bChanged
+*/
+bool GLStateCache::changed(bool bChanged)
+{
+    if (bChanged)
+    {
+        ++m_current.issued;
+    }
+    else
+    {
+        ++m_current.filtered;
+    }
+    return bChanged;
+}
+
+/**
+    Gets the cached uniform or storage block binding, NULL for untracked ones
+*/
+GLStateCache::IndexedBinding * GLStateCache::findIndexedBinding(GLenum target, GLuint index)
+{
+    if (index >= (GLuint)MAX_CACHED_INDEXED_BINDINGS)
+    {
+        return NULL;
+    }
+    if (target == gl::UNIFORM_BUFFER)
+    {
+        return &m_uniformBindings[index];
+    }
+    if (target == gl::SHADER_STORAGE_BUFFER)
+    {
+        return &m_storageBindings[index];
+    }
+    return NULL;
+}
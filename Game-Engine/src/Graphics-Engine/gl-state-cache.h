@@ -0,0 +1,108 @@
+/**
+    @headerfile gl-state-cache.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _GL_STATE_CACHE_H
+#define _GL_STATE_CACHE_H
+
+#include <cstdint>
+#include <gl_core_4_3.hpp>
+
+const int MAX_CACHED_BUFFER_TARGETS = 13; //! Generic buffer binding points tracked
+const int MAX_CACHED_INDEXED_BINDINGS = 16; //! Uniform and storage block binding points tracked
+const int MAX_CACHED_TEXTURE_UNITS = 32;
+const int MAX_CACHED_TEXTURE_TARGETS = 5;
+const int MAX_CACHED_CAPABILITIES = 11;
+
+//! GL calls made through the cache during one frame.
+struct GLCallStats
+{
+    size_t issued; //! Reached the driver
+    size_t filtered; //! Dropped because the state was already set
+};
+
+/**
+    Shadow copy of the GL context state the engine changes. Every engine bind and state
+    change goes through here and only reaches the driver when it differs from what is
+    already set. State is unknown after invalidate(), so the first call of each kind is
+    always issued; call it after anything outside the cache touched the context.
+
+    Objects deleted while bound must be reported through the release calls, GL unbinds
+    them and may hand the same name out again.
+*/
+class GLStateCache
+{
+    public:
+        GLStateCache();
+        ~GLStateCache();
+
+        static GLStateCache * get();
+
+        void invalidate();
+        void endFrame();
+
+        void useProgram(GLuint program);
+        void bindVertexArray(GLuint vertexArray);
+        void bindBuffer(GLenum target, GLuint buffer);
+        void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+        void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+        void bindTexture(GLuint unit, GLenum target, GLuint texture);
+        void bindFramebuffer(GLenum target, GLuint framebuffer);
+
+        void setEnabled(GLenum capability, bool bEnabled);
+        void blendFunc(GLenum source, GLenum destination);
+        void depthFunc(GLenum function);
+        void depthMask(bool bWrite);
+        void cullFace(GLenum face);
+        void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+        void clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+
+        void releaseProgram(GLuint program);
+        void releaseVertexArray(GLuint vertexArray);
+        void releaseBuffer(GLuint buffer);
+        void releaseTexture(GLuint texture);
+        void releaseFramebuffer(GLuint framebuffer);
+
+        const GLCallStats & getFrameStats() const;
+
+    private:
+        struct IndexedBinding
+        {
+            GLuint buffer;
+            GLintptr offset;
+            GLsizeiptr size; //! -1 for a whole buffer bound with bindBufferBase
+        };
+
+        static GLStateCache * s_instance;
+
+        GLuint m_program;
+        GLuint m_vertexArray;
+        GLuint m_buffers[MAX_CACHED_BUFFER_TARGETS];
+        IndexedBinding m_uniformBindings[MAX_CACHED_INDEXED_BINDINGS];
+        IndexedBinding m_storageBindings[MAX_CACHED_INDEXED_BINDINGS];
+        GLuint m_textures[MAX_CACHED_TEXTURE_UNITS][MAX_CACHED_TEXTURE_TARGETS];
+        GLuint m_activeTexture;
+        GLuint m_drawFramebuffer;
+        GLuint m_readFramebuffer;
+        int8_t m_capabilities[MAX_CACHED_CAPABILITIES]; //! -1 unknown, 0 disabled, 1 enabled
+        GLenum m_blendSource, m_blendDestination;
+        GLenum m_depthFunction;
+        int8_t m_depthMask;
+        GLenum m_cullFace;
+        GLint m_viewport[4];
+        GLfloat m_clearColor[4];
+
+        GLCallStats m_current;
+        GLCallStats m_lastFrame;
+
+        GLStateCache(const GLStateCache &);
+        GLStateCache & operator=(const GLStateCache &);
+
+        bool changed(bool bChanged);
+        IndexedBinding * findIndexedBinding(GLenum target, GLuint index);
+};
+
+#endif // !_GL_STATE_CACHE_H
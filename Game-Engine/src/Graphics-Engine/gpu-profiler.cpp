@@ -0,0 +1,353 @@
+/**
+    @file gpu-profiler.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\gpu-profiler.h>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+GpuProfiler * GpuProfiler::s_instance = NULL;
+
+/**
+    Creates the profiler GPU_PROFILE_SCOPE reports to. Queries are created by the
+    first beginFrame, once a context exists.
+*/
+GpuProfiler::GpuProfiler() :
+    m_frameNumber(0), m_latency(0), m_dropped(0), m_created(false), m_supported(false),
+    m_inFrame(false), m_trackOwner(NULL), m_track(0)
+{
+    for (int i = 0; i < GPU_PROFILER_FRAMES; i++)
+    {
+        memset(m_frames[i].queries, 0, sizeof(m_frames[i].queries));
+        m_frames[i].used = 0;
+        m_frames[i].number = 0;
+        m_frames[i].clockOffset = 0;
+        m_frames[i].pending = false;
+    }
+    s_instance = this;
+}
+
+GpuProfiler::~GpuProfiler()
+{
+    if (m_created && m_supported)
+    {
+        for (int i = 0; i < GPU_PROFILER_FRAMES; i++)
+        {
+            gl::DeleteQueries(GPU_SCOPES_PER_FRAME * 2, m_frames[i].queries);
+        }
+    }
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+GpuProfiler * GpuProfiler::get()
+{
+    return s_instance;
+}
+
+/**
+    Reads back every earlier frame the GPU has finished, then starts timing a new one
+    under a "frame" scope
+*/
+void GpuProfiler::beginFrame()
+{
+    if (!m_created)
+    {
+        create();
+    }
+    if (!m_supported)
+    {
+        return;
+    }
+
+    resolve(false);
+
+    ++m_frameNumber;
+    Frame & frame = m_frames[m_frameNumber % GPU_PROFILER_FRAMES];
+    if (frame.pending)
+    {
+        // Still running after a full ring of frames, waiting for it would stall
+        frame.pending = false;
+        ++m_dropped;
+    }
+    frame.scopes.clear();
+    frame.used = 0;
+    frame.number = m_frameNumber;
+
+    GLint64 gpuNow = 0;
+    gl::GetInteger64v(gl::TIMESTAMP, &gpuNow);
+    frame.clockOffset = (int64_t)Profiler::now() - (int64_t)gpuNow;
+
+    m_stack.clear();
+    m_inFrame = true;
+    begin("frame");
+}
+
+/**
+    Closes every open scope, the frame is read back by a later beginFrame
+*/
+void GpuProfiler::endFrame()
+{
+    if (!m_inFrame)
+    {
+        return;
+    }
+
+    while (!m_stack.empty())
+    {
+        end();
+    }
+    m_inFrame = false;
+
+    Frame & frame = m_frames[m_frameNumber % GPU_PROFILER_FRAMES];
+    frame.pending = frame.used > 0;
+}
+
+/**
+    Writes a timestamp where a scope begins, normally done by GpuProfileScope
+    @param name - string literal, kept until the frame is read back
+*/
+void GpuProfiler::begin(const char * name)
+{
+    if (!m_inFrame)
+    {
+        return;
+    }
+
+    // Every timed scope still open is owed an end query as well
+    int owed = 0;
+    for (size_t i = 0; i < m_stack.size(); i++)
+    {
+        owed += m_stack[i] >= 0 ? 1 : 0;
+    }
+
+    Frame & frame = m_frames[m_frameNumber % GPU_PROFILER_FRAMES];
+    if (frame.used + owed + 2 > GPU_SCOPES_PER_FRAME * 2)
+    {
+        m_stack.push_back(-1);
+        return;
+    }
+
+    Scope scope = { name, (uint32_t)m_stack.size(), frame.used++, -1 };
+    gl::QueryCounter(frame.queries[scope.begin], gl::TIMESTAMP);
+    m_stack.push_back((int)frame.scopes.size());
+    frame.scopes.push_back(scope);
+}
+
+/**
+    Writes a timestamp where the innermost open scope ends
+*/
+void GpuProfiler::end()
+{
+    if (!m_inFrame || m_stack.empty())
+    {
+        return;
+    }
+
+    int index = m_stack.back();
+    m_stack.pop_back();
+    if (index < 0)
+    {
+        return;
+    }
+
+    Frame & frame = m_frames[m_frameNumber % GPU_PROFILER_FRAMES];
+    Scope & scope = frame.scopes[index];
+    scope.end = frame.used++;
+    gl::QueryCounter(frame.queries[scope.end], gl::TIMESTAMP);
+}
+
+/**
+    Reads back every frame still pending, waiting for the GPU to finish them. Call
+    between frames, before taking averages that must include the latest frames.
+*/
+void GpuProfiler::drain()
+{
+    if (m_supported && !m_inFrame)
+    {
+        resolve(true);
+    }
+}
+
+/**
+    Gets the scopes of the latest frame read back, in the order they began
+*/
+const std::vector<GpuTiming> & GpuProfiler::getTimings() const
+{
+    return m_timings;
+}
+
+/**
+    Gets how many frames before the current one the latest results were issued
+*/
+int GpuProfiler::getLatency() const
+{
+    return m_latency;
+}
+
+/**
+    Gets the average time of the outer scopes since the last call, then starts averaging again
+    @param averages - receives the frame scope and the scopes directly inside it
+    @param dropped - receives how many frames were dropped in that time
+*/
+void GpuProfiler::takeAverages(std::vector<GpuTiming> & averages, int & dropped)
+{
+    averages.clear();
+    for (size_t i = 0; i < m_averages.size(); i++)
+    {
+        const Average & average = m_averages[i];
+        if (average.depth > 1 || average.count == 0)
+        {
+            continue;
+        }
+        GpuTiming timing = { average.name, average.depth, average.milliseconds / average.count };
+        averages.push_back(timing);
+    }
+    dropped = m_dropped;
+
+    m_averages.clear();
+    m_dropped = 0;
+}
+
+/**
+    Writes the averages takeAverages returns, e.g. "frame 1.204 ms Scene::render 0.981 ms"
+    @param text - receives the summary, always terminated
+    @param size - size of text in bytes
+*/
+void GpuProfiler::formatAverages(char * text, size_t size)
+{
+    std::vector<GpuTiming> averages;
+    int dropped = 0;
+    takeAverages(averages, dropped);
+    if (size == 0)
+    {
+        return;
+    }
+    text[0] = '\0';
+
+    size_t length = 0;
+    for (size_t i = 0; i < averages.size() && length < size; i++)
+    {
+        int written = snprintf(text + length, size - length, "%s%s %.3f ms", length > 0 ? " " : "",
+            averages[i].name, averages[i].milliseconds);
+        if (written < 0)
+        {
+            break;
+        }
+        length += (size_t)written;
+    }
+    if (dropped > 0 && length < size)
+    {
+        snprintf(text + length, size - length, " (%d dropped)", dropped);
+    }
+}
+
+/**
+    Creates the queries of every frame, unless the driver has no timestamp counter
+*/
+void GpuProfiler::create()
+{
+    m_created = true;
+
+    GLint bits = 0;
+    gl::GetQueryiv(gl::TIMESTAMP, gl::QUERY_COUNTER_BITS, &bits);
+    m_supported = bits > 0;
+    if (!m_supported)
+    {
+        std::cerr << "GPU profiler: timestamp queries are not supported" << std::endl;
+        return;
+    }
+
+    for (int i = 0; i < GPU_PROFILER_FRAMES; i++)
+    {
+        gl::GenQueries(GPU_SCOPES_PER_FRAME * 2, m_frames[i].queries);
+    }
+}
+
+/**
+    Reads back pending frames oldest first
+    @param bWait - wait for every frame, otherwise stop at the first the GPU has not finished
+*/
+void GpuProfiler::resolve(bool bWait)
+{
+    uint64_t oldest = m_frameNumber >= GPU_PROFILER_FRAMES ? m_frameNumber + 1 - GPU_PROFILER_FRAMES : 1;
+    for (uint64_t number = oldest; number <= m_frameNumber; number++)
+    {
+        Frame & frame = m_frames[number % GPU_PROFILER_FRAMES];
+        if (!frame.pending || frame.number != number)
+        {
+            continue;
+        }
+
+        // Queries complete in order, so the last one written stands for the whole frame
+        GLuint64 available = 0;
+        if (!bWait)
+        {
+            gl::GetQueryObjectui64v(frame.queries[frame.used - 1], gl::QUERY_RESULT_AVAILABLE, &available);
+        }
+        if (!bWait && !available)
+        {
+            break;
+        }
+        read(frame);
+    }
+}
+
+/**
+    Turns a finished frame's timestamps into timings and CPU profiler events
+*/
+void GpuProfiler::read(Frame & frame)
+{
+    Profiler * profiler = Profiler::get();
+    if (profiler && m_trackOwner != profiler)
+    {
+        m_track = profiler->createTrack("GPU");
+        m_trackOwner = profiler;
+    }
+
+    m_timings.clear();
+    for (size_t i = 0; i < frame.scopes.size(); i++)
+    {
+        const Scope & scope = frame.scopes[i];
+        GLuint64 begin = 0;
+        GLuint64 end = 0;
+        gl::GetQueryObjectui64v(frame.queries[scope.begin], gl::QUERY_RESULT, &begin);
+        gl::GetQueryObjectui64v(frame.queries[scope.end], gl::QUERY_RESULT, &end);
+        if (end < begin)
+        {
+            end = begin;
+        }
+
+        GpuTiming timing = { scope.name, scope.depth, (end - begin) / 1e6 };
+        m_timings.push_back(timing);
+
+        if (profiler)
+        {
+            int64_t start = (int64_t)begin + frame.clockOffset;
+            start = start > 0 ? start : 0;
+            profiler->recordTrack(m_track, scope.name, (uint64_t)start, (uint64_t)start + (end - begin), scope.depth);
+        }
+
+        // Names are literals, the same scope is normally the same pointer
+        size_t a = 0;
+        while (a < m_averages.size() &&
+            (m_averages[a].depth != scope.depth || strcmp(m_averages[a].name, scope.name) != 0))
+        {
+            a++;
+        }
+        if (a == m_averages.size())
+        {
+            Average average = { scope.name, scope.depth, 0.0, 0 };
+            m_averages.push_back(average);
+        }
+        m_averages[a].milliseconds += timing.milliseconds;
+        m_averages[a].count++;
+    }
+
+    m_latency = (int)(m_frameNumber + 1 - frame.number);
+    frame.pending = false;
+}
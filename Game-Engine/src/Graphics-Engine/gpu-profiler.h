@@ -0,0 +1,143 @@
+/**
+    @headerfile gpu-profiler.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _GPU_PROFILER_H
+#define _GPU_PROFILER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <gl_core_4_3.hpp>
+#include <Engine-Core\profiler.h>
+
+#if ENGINE_PROFILING
+//! Times the GL commands issued in the rest of the enclosing block, GL thread only.
+#define GPU_PROFILE_SCOPE(name) GpuProfileScope PROFILE_CONCAT(gpuProfileScope, __LINE__)(name)
+#else
+#define GPU_PROFILE_SCOPE(name) ((void)0)
+#endif
+
+const int GPU_PROFILER_FRAMES = 3; //! Frames of queries in flight before a slot is reused
+const int GPU_SCOPES_PER_FRAME = 64; //! Further scopes in a frame are not timed
+
+//! GPU time of one scope in the latest frame read back.
+struct GpuTiming
+{
+    const char * name;
+    uint32_t depth;
+    double milliseconds;
+};
+
+/**
+    Times GL commands with timestamp queries. Every scope writes a timestamp where it
+    begins and ends, so unlike TIME_ELAPSED queries scopes can nest. Each frame has its
+    own set of queries and the results are only read once the driver reports them
+    available, normally two or three frames later, so the CPU never waits on the GPU.
+    If the GPU falls further behind than the ring is deep, that frame is dropped.
+
+    Results are moved onto the CPU profiler's clock and recorded on a "GPU" track, next
+    to the threads that issued the work.
+*/
+class GpuProfiler
+{
+    public:
+        GpuProfiler();
+        ~GpuProfiler();
+
+        static GpuProfiler * get();
+
+        void beginFrame();
+        void endFrame();
+        void begin(const char * name);
+        void end();
+        void drain();
+
+        const std::vector<GpuTiming> & getTimings() const;
+        int getLatency() const;
+        void takeAverages(std::vector<GpuTiming> & averages, int & dropped);
+        void formatAverages(char * text, size_t size);
+
+    private:
+        struct Scope
+        {
+            const char * name;
+            uint32_t depth;
+            int begin; //! Query written where the scope begins
+            int end; //! Query written where it ends, -1 while open
+        };
+
+        struct Frame
+        {
+            GLuint queries[GPU_SCOPES_PER_FRAME * 2];
+            std::vector<Scope> scopes;
+            int used; //! Queries written, the last one is the latest to complete
+            uint64_t number;
+            int64_t clockOffset; //! Profiler::now() minus the GPU timestamp at the start of the frame
+            bool pending; //! Written but not read back
+        };
+
+        struct Average
+        {
+            const char * name;
+            uint32_t depth;
+            double milliseconds;
+            int count;
+        };
+
+        static GpuProfiler * s_instance;
+
+        Frame m_frames[GPU_PROFILER_FRAMES];
+        std::vector<int> m_stack; //! Open scopes of the current frame, -1 for untimed ones
+        std::vector<GpuTiming> m_timings;
+        std::vector<Average> m_averages;
+        uint64_t m_frameNumber;
+        int m_latency;
+        int m_dropped;
+        bool m_created;
+        bool m_supported;
+        bool m_inFrame;
+        Profiler * m_trackOwner; //! Profiler the track was created in
+        uint32_t m_track;
+
+        GpuProfiler(const GpuProfiler &);
+        GpuProfiler & operator=(const GpuProfiler &);
+
+        void create();
+        void resolve(bool bWait);
+        void read(Frame & frame);
+};
+
+/**
+    Times the GL commands issued between its construction and destruction, see GPU_PROFILE_SCOPE
+*/
+class GpuProfileScope
+{
+    public:
+        explicit GpuProfileScope(const char * name) : m_profiler(GpuProfiler::get())
+        {
+            if (m_profiler)
+            {
+                m_profiler->begin(name);
+            }
+        }
+
+        ~GpuProfileScope()
+        {
+            if (m_profiler)
+            {
+                m_profiler->end();
+            }
+        }
+
+    private:
+        GpuProfiler * m_profiler;
+
+        GpuProfileScope(const GpuProfileScope &);
+        GpuProfileScope & operator=(const GpuProfileScope &);
+};
+
+#endif // !_GPU_PROFILER_H
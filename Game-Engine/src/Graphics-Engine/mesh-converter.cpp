@@ -0,0 +1,271 @@
+/**
+    @file mesh-converter.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\mesh-converter.h>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <glm\glm.hpp>
+#include <glm\gtc\type_ptr.hpp>
+
+namespace ConverterInfo
+{
+    //! Position, texture coordinate and normal of a face corner, -1 where the corner has none.
+    struct Corner
+    {
+        int position;
+        int texCoord;
+        int normal;
+
+        bool operator<(const Corner & other) const
+        {
+            if (position != other.position)
+            {
+                return position < other.position;
+            }
+            if (texCoord != other.texCoord)
+            {
+                return texCoord < other.texCoord;
+            }
+            return normal < other.normal;
+        }
+    };
+
+    /**
+        Turns an OBJ index, counted from 1 or backwards from the end when negative, into
+        an array index
+        @return -1 when missing or out of range
+    */
+    inline int resolve(long index, size_t count)
+    {
+        long resolved = index > 0 ? index - 1 : (long)count + index;
+        return index != 0 && resolved >= 0 && resolved < (long)count ? (int)resolved : -1;
+    }
+
+    /**
+        Parses a face corner, "p", "p/t", "p//n" or "p/t/n"
+        @return false if the position is missing or out of range
+    */
+    bool parseCorner(const char * token, size_t positions, size_t texCoords, size_t normals, Corner & corner)
+    {
+        char * end = NULL;
+        corner.position = resolve(strtol(token, &end, 10), positions);
+        corner.texCoord = -1;
+        corner.normal = -1;
+        if (*end == '/')
+        {
+            token = end + 1;
+            if (*token != '/')
+            {
+                corner.texCoord = resolve(strtol(token, &end, 10), texCoords);
+                token = end;
+            }
+            if (*token == '/')
+            {
+                corner.normal = resolve(strtol(token + 1, &end, 10), normals);
+            }
+        }
+        return corner.position >= 0;
+    }
+
+    /**
+        Reads up to count numbers separated by spaces
+        @return how many were read
+    */
+    int parseFloats(const char * text, float * values, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            char * end = NULL;
+            values[i] = strtof(text, &end);
+            if (end == text)
+            {
+                return i;
+            }
+            text = end;
+        }
+        return count;
+    }
+}
+
+/**
+    @param fileName - OBJ file to read
+    @param vertices - replaced by the distinct face corners
+    @param indices - replaced by three per triangle
+    @return false if the file cannot be read, a face refers to a missing vertex or there are no faces
+*/
+bool importObjMesh(const std::string & fileName, std::vector<MeshFileVertex> & vertices, std::vector<uint32_t> & indices)
+{
+    std::ifstream file(fileName);
+    if (!file)
+    {
+        std::cerr << "Cannot open " << fileName << std::endl;
+        return false;
+    }
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec2> texCoords;
+    std::vector<glm::vec3> normals;
+    std::map<ConverterInfo::Corner, uint32_t> cornerVertices;
+    std::vector<bool> smoothNormal; //! Vertices whose normal is summed from their faces
+    std::vector<uint32_t> face;
+
+    vertices.clear();
+    indices.clear();
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        const char * text = line.c_str();
+        float value[3] = { 0.f, 0.f, 0.f };
+
+        if (strncmp(text, "v ", 2) == 0 && ConverterInfo::parseFloats(text + 2, value, 3) == 3)
+        {
+            positions.push_back(glm::make_vec3(value));
+        }
+        else if (strncmp(text, "vt ", 3) == 0 && ConverterInfo::parseFloats(text + 3, value, 2) >= 1)
+        {
+            texCoords.push_back(glm::make_vec2(value));
+        }
+        else if (strncmp(text, "vn ", 3) == 0 && ConverterInfo::parseFloats(text + 3, value, 3) == 3)
+        {
+            normals.push_back(glm::make_vec3(value));
+        }
+        else if (strncmp(text, "f ", 2) == 0)
+        {
+            face.clear();
+            std::istringstream corners(line.substr(2));
+            std::string token;
+            while (corners >> token)
+            {
+                ConverterInfo::Corner corner;
+                if (!ConverterInfo::parseCorner(token.c_str(), positions.size(), texCoords.size(), normals.size(), corner))
+                {
+                    std::cerr << fileName << ":" << lineNumber << ": bad face corner " << token << std::endl;
+                    return false;
+                }
+
+                std::map<ConverterInfo::Corner, uint32_t>::iterator found = cornerVertices.find(corner);
+                if (found == cornerVertices.end())
+                {
+                    MeshFileVertex vertex;
+                    memset(&vertex, 0, sizeof(vertex));
+                    memcpy(vertex.position, &positions[corner.position], sizeof(vertex.position));
+                    if (corner.texCoord >= 0)
+                    {
+                        memcpy(vertex.texCoord, &texCoords[corner.texCoord], sizeof(vertex.texCoord));
+                    }
+                    if (corner.normal >= 0)
+                    {
+                        memcpy(vertex.normal, &normals[corner.normal], sizeof(vertex.normal));
+                    }
+                    found = cornerVertices.insert(std::make_pair(corner, (uint32_t)vertices.size())).first;
+                    vertices.push_back(vertex);
+                    smoothNormal.push_back(corner.normal < 0);
+                }
+                face.push_back(found->second);
+            }
+
+            // Fan from the first corner, faces are expected to be convex
+            for (size_t i = 2; i < face.size(); i++)
+            {
+                uint32_t triangle[3] = { face[0], face[i - 1], face[i] };
+                indices.insert(indices.end(), triangle, triangle + 3);
+
+                glm::vec3 a = glm::make_vec3(vertices[triangle[0]].position);
+                glm::vec3 faceNormal = glm::cross(glm::make_vec3(vertices[triangle[1]].position) - a,
+                    glm::make_vec3(vertices[triangle[2]].position) - a);
+                for (int j = 0; j < 3; j++)
+                {
+                    if (smoothNormal[triangle[j]])
+                    {
+                        // Unnormalised, so larger faces weigh more
+                        for (int k = 0; k < 3; k++)
+                        {
+                            vertices[triangle[j]].normal[k] += faceNormal[k];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < vertices.size(); i++)
+    {
+        glm::vec3 normal = glm::make_vec3(vertices[i].normal);
+        if (smoothNormal[i] && glm::length(normal) > 0.f)
+        {
+            normal = glm::normalize(normal);
+            memcpy(vertices[i].normal, &normal, sizeof(vertices[i].normal));
+        }
+    }
+
+    if (indices.empty())
+    {
+        std::cerr << fileName << " has no faces" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+    Converts a model into the engine's mesh format, run offline so loading a level only
+    maps the result
+    @param sourceFile - model to read, .obj
+    @param meshFile - mesh file to write
+    @return false if the model cannot be read or the mesh file written
+*/
+bool convertMesh(const std::string & sourceFile, const std::string & meshFile)
+{
+    std::string extension = sourceFile.size() > 4 ? sourceFile.substr(sourceFile.size() - 4) : std::string();
+    for (size_t i = 0; i < extension.size(); i++)
+    {
+        extension[i] = (char)tolower(extension[i]);
+    }
+    if (extension != ".obj")
+    {
+        std::cerr << "Unsupported model format: " << sourceFile << std::endl;
+        return false;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<MeshFileVertex> vertices;
+    std::vector<uint32_t> indices;
+    if (!importObjMesh(sourceFile, vertices, indices))
+    {
+        return false;
+    }
+    double importMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (!writeMeshFile(meshFile, vertices, indices))
+    {
+        std::cerr << "Cannot write " << meshFile << std::endl;
+        return false;
+    }
+
+    // Mapping the result is what a level load pays from now on
+    start = std::chrono::steady_clock::now();
+    MeshFile mesh;
+    bool bOpened = mesh.open(meshFile);
+    double openMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    if (!bOpened)
+    {
+        std::cerr << "Cannot read back " << meshFile << std::endl;
+        return false;
+    }
+
+    printf("%s: %u vertices, %u triangles, %u meshlets, parsed in %.3f ms, mapped back in %.3f ms\n",
+        meshFile.c_str(), mesh.getHeader().vertexCount, mesh.getHeader().indexCount / 3,
+        mesh.getHeader().meshletCount, importMilliseconds, openMilliseconds);
+    return true;
+}
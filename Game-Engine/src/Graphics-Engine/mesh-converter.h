@@ -0,0 +1,25 @@
+/**
+    @headerfile mesh-converter.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _MESH_CONVERTER_H
+#define _MESH_CONVERTER_H
+
+#include <string>
+#include <vector>
+#include <Graphics-Engine\mesh-file.h>
+
+/**
+    Reads a Wavefront OBJ file into the vertices and indices of the engine's mesh format.
+    Polygons are split into triangle fans and corners sharing position, texture
+    coordinate and normal become one vertex. Faces without normals get smooth ones from
+    the faces around them. Materials, groups and lines are ignored.
+*/
+bool importObjMesh(const std::string & fileName, std::vector<MeshFileVertex> & vertices, std::vector<uint32_t> & indices);
+
+bool convertMesh(const std::string & sourceFile, const std::string & meshFile);
+
+#endif // !_MESH_CONVERTER_H
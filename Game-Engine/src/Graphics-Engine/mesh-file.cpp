@@ -0,0 +1,394 @@
+/**
+    @file mesh-file.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\mesh-file.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <glm\glm.hpp>
+#include <Graphics-Engine\gl-state-cache.h>
+
+namespace MeshFileInfo
+{
+    inline uint64_t align(uint64_t offset)
+    {
+        return (offset + MESH_FILE_ALIGNMENT - 1) / MESH_FILE_ALIGNMENT * MESH_FILE_ALIGNMENT;
+    }
+
+    inline uint32_t getIndexSize(uint32_t indexType)
+    {
+        return indexType == gl::UNSIGNED_SHORT ? 2 : 4;
+    }
+
+    inline glm::vec3 getPosition(const MeshFileVertex & vertex)
+    {
+        return glm::vec3(vertex.position[0], vertex.position[1], vertex.position[2]);
+    }
+
+    /**
+        Gets the box around some of the vertices and the sphere around the box's centre
+        enclosing them
+        @param vertices - every vertex of the mesh
+        @param indices - vertices to enclose, may repeat
+        @param first - first index used
+        @param count - indices used
+    */
+    MeshFileBounds computeBounds(const std::vector<MeshFileVertex> & vertices, const std::vector<uint32_t> & indices,
+        size_t first, size_t count)
+    {
+        glm::vec3 min(vertices[indices[first]].position[0], vertices[indices[first]].position[1],
+            vertices[indices[first]].position[2]);
+        glm::vec3 max = min;
+        for (size_t i = first; i < first + count; i++)
+        {
+            glm::vec3 position = getPosition(vertices[indices[i]]);
+            min = glm::min(min, position);
+            max = glm::max(max, position);
+        }
+
+        glm::vec3 center = (min + max) * 0.5f;
+        float fRadius = 0.f;
+        for (size_t i = first; i < first + count; i++)
+        {
+            fRadius = glm::max(fRadius, glm::length(getPosition(vertices[indices[i]]) - center));
+        }
+
+        MeshFileBounds bounds = { { min.x, min.y, min.z }, { max.x, max.y, max.z }, { center.x, center.y, center.z }, fRadius };
+        return bounds;
+    }
+
+    /**
+        Cuts the triangle list into meshlets in the order the triangles come, starting a
+        new one whenever the triangle or distinct vertex limit would be passed
+    */
+    std::vector<MeshFileMeshlet> buildMeshlets(const std::vector<MeshFileVertex> & vertices, const std::vector<uint32_t> & indices)
+    {
+        std::vector<MeshFileMeshlet> meshlets;
+        std::vector<uint32_t> meshletVertices;
+        meshletVertices.reserve(MESHLET_MAX_VERTICES);
+
+        size_t first = 0;
+        for (size_t i = 0; i <= indices.size(); i += 3)
+        {
+            bool bLast = i == indices.size();
+            size_t newVertices = 0;
+            for (size_t j = i; !bLast && j < i + 3; j++)
+            {
+                if (std::find(meshletVertices.begin(), meshletVertices.end(), indices[j]) == meshletVertices.end() &&
+                    std::find(indices.begin() + i, indices.begin() + j, indices[j]) == indices.begin() + j)
+                {
+                    ++newVertices;
+                }
+            }
+
+            bool bFull = (i - first) / 3 == MESHLET_MAX_TRIANGLES || meshletVertices.size() + newVertices > MESHLET_MAX_VERTICES;
+            if ((bLast || bFull) && i > first)
+            {
+                MeshFileBounds bounds = computeBounds(vertices, indices, first, i - first);
+                MeshFileMeshlet meshlet = { (uint32_t)first, (uint32_t)(i - first),
+                    { bounds.center[0], bounds.center[1], bounds.center[2] }, bounds.radius };
+                meshlets.push_back(meshlet);
+                meshletVertices.clear();
+                first = i;
+            }
+
+            for (size_t j = i; !bLast && j < i + 3; j++)
+            {
+                if (std::find(meshletVertices.begin(), meshletVertices.end(), indices[j]) == meshletVertices.end())
+                {
+                    meshletVertices.push_back(indices[j]);
+                }
+            }
+        }
+        return meshlets;
+    }
+
+    /**
+        Creates a buffer holding data that never changes
+        @param target - binding point to create it through
+        @param data - contents, read by GL before this returns, NULL to leave it undefined
+        @param size - bytes
+    */
+    inline GLuint createStaticBuffer(GLenum target, const void * data, GLsizeiptr size)
+    {
+        GLuint buffer = 0;
+        gl::GenBuffers(1, &buffer);
+        GLStateCache::get()->bindBuffer(target, buffer);
+
+        // Immutable storage tells the driver the data is placed once and never respecified
+        if (gl::sys::IsExtensionSupported("GL_ARB_buffer_storage") && gl::BufferStorage)
+        {
+            gl::BufferStorage(target, size, data, 0);
+        }
+        else
+        {
+            gl::BufferData(target, size, data, gl::STATIC_DRAW);
+        }
+        return buffer;
+    }
+
+    void writePadding(std::ofstream & file, uint64_t offset)
+    {
+        static const char zeros[MESH_FILE_ALIGNMENT] = {};
+        file.write(zeros, (std::streamsize)(align(offset) - offset));
+    }
+}
+
+MeshFile::MeshFile() :
+    m_pData(NULL), m_size(0), m_pHeader(NULL)
+{
+}
+
+/**
+    Maps a mesh file and checks its header, replacing any file open before
+    @param fileName - file written by writeMeshFile
+    @return false if the file is missing, of another version or its sections do not fit
+*/
+bool MeshFile::open(const std::string & fileName)
+{
+    close();
+    if (!m_file.open(fileName))
+    {
+        return false;
+    }
+    if (!openMemory(m_file.getData(), m_file.getSize()))
+    {
+        m_file.close();
+        return false;
+    }
+    return true;
+}
+
+/**
+    Reads a mesh file already in memory
+    @param data - the whole file, 8 byte aligned, kept by the caller until the mesh file
+    is closed
+    @param size - bytes
+    @return false if the data is not a mesh file of this version or its sections do not fit
+*/
+bool MeshFile::openMemory(const void * data, size_t size)
+{
+    m_pHeader = NULL;
+    if (!data || size < sizeof(MeshFileHeader))
+    {
+        return false;
+    }
+
+    m_pData = (const unsigned char *)data;
+    m_size = size;
+    m_pHeader = (const MeshFileHeader *)m_pData;
+    if (!validate())
+    {
+        m_pHeader = NULL;
+        m_pData = NULL;
+        m_size = 0;
+        return false;
+    }
+    return true;
+}
+
+void MeshFile::close()
+{
+    m_pHeader = NULL;
+    m_pData = NULL;
+    m_size = 0;
+    m_file.close();
+}
+
+bool MeshFile::isOpen() const
+{
+    return m_pHeader != NULL;
+}
+
+const MeshFileHeader & MeshFile::getHeader() const
+{
+    return *m_pHeader;
+}
+
+const MeshFileVertex * MeshFile::getVertices() const
+{
+    return (const MeshFileVertex *)getSection(m_pHeader->vertices);
+}
+
+/**
+    @return indices of the type given by the header's indexType
+*/
+const void * MeshFile::getIndices() const
+{
+    return getSection(m_pHeader->indices);
+}
+
+const MeshFileMeshlet * MeshFile::getMeshlets() const
+{
+    return (const MeshFileMeshlet *)getSection(m_pHeader->meshlets);
+}
+
+const MeshFileBounds & MeshFile::getBounds() const
+{
+    return *(const MeshFileBounds *)getSection(m_pHeader->bounds);
+}
+
+/**
+    Creates the mesh's vertex array and buffers, the sections are copied by GL straight
+    out of the mapping. The file may be closed afterwards.
+    @return GL objects of the mesh, hand them to RenderResources::createMesh
+*/
+Mesh MeshFile::upload() const
+{
+    return createMesh(true);
+}
+
+/**
+    Creates the mesh's vertex array and buffers without filling them. The buffers are
+    immutable, write the vertex and index sections into them with glCopyBufferSubData.
+    @return GL objects of the mesh
+*/
+Mesh MeshFile::allocate() const
+{
+    return createMesh(false);
+}
+
+const unsigned char * MeshFile::getSection(const MeshFileSection & section) const
+{
+    return m_pData + section.offset;
+}
+
+Mesh MeshFile::createMesh(bool bWithData) const
+{
+    GLStateCache * state = GLStateCache::get();
+
+    Mesh mesh;
+    memset(&mesh, 0, sizeof(mesh));
+    gl::GenVertexArrays(1, &mesh.vertexArray);
+    state->bindVertexArray(mesh.vertexArray);
+
+    mesh.vertexBuffer = MeshFileInfo::createStaticBuffer(gl::ARRAY_BUFFER, bWithData ? getVertices() : NULL,
+        (GLsizeiptr)m_pHeader->vertices.size);
+    GLsizei stride = (GLsizei)m_pHeader->vertexStride;
+    gl::VertexAttribPointer(0, 3, gl::FLOAT, gl::FALSE_, stride, (const void *)offsetof(MeshFileVertex, position));
+    gl::VertexAttribPointer(1, 3, gl::FLOAT, gl::FALSE_, stride, (const void *)offsetof(MeshFileVertex, normal));
+    gl::VertexAttribPointer(2, 2, gl::FLOAT, gl::FALSE_, stride, (const void *)offsetof(MeshFileVertex, texCoord));
+    gl::EnableVertexAttribArray(0);
+    gl::EnableVertexAttribArray(1);
+    gl::EnableVertexAttribArray(2);
+
+    mesh.mode = gl::TRIANGLES;
+    if (m_pHeader->indexCount > 0)
+    {
+        // The element array binding is part of the vertex array
+        mesh.indexBuffer = MeshFileInfo::createStaticBuffer(gl::ELEMENT_ARRAY_BUFFER, bWithData ? getIndices() : NULL,
+            (GLsizeiptr)m_pHeader->indices.size);
+        mesh.indexType = m_pHeader->indexType;
+        mesh.count = (GLsizei)m_pHeader->indexCount;
+    }
+    else
+    {
+        mesh.count = (GLsizei)m_pHeader->vertexCount;
+    }
+
+    state->bindVertexArray(0);
+    return mesh;
+}
+
+/**
+    Checks the header against the file, the sections themselves are used as they are.
+    Index values are only checked by writeMeshFile, files come from it.
+*/
+bool MeshFile::validate() const
+{
+    const MeshFileHeader & header = *m_pHeader;
+    if (header.magic != MESH_FILE_MAGIC || header.version != MESH_FILE_VERSION ||
+        header.vertexStride != sizeof(MeshFileVertex) ||
+        (header.indexType != gl::UNSIGNED_SHORT && header.indexType != gl::UNSIGNED_INT))
+    {
+        return false;
+    }
+
+    const MeshFileSection * sections[] = { &header.vertices, &header.indices, &header.meshlets, &header.bounds };
+    const uint64_t expected[] =
+    {
+        (uint64_t)header.vertexCount * header.vertexStride,
+        (uint64_t)header.indexCount * MeshFileInfo::getIndexSize(header.indexType),
+        (uint64_t)header.meshletCount * sizeof(MeshFileMeshlet),
+        sizeof(MeshFileBounds)
+    };
+    for (int i = 0; i < 4; i++)
+    {
+        const MeshFileSection & section = *sections[i];
+        if (section.size != expected[i] || section.offset % MESH_FILE_ALIGNMENT != 0 ||
+            section.offset < sizeof(MeshFileHeader) || section.offset > m_size || section.size > m_size - section.offset)
+        {
+            return false;
+        }
+    }
+    return header.vertexCount > 0;
+}
+
+/**
+    Writes a triangle mesh in the engine's format, with its meshlets and bounds. Indices
+    are stored as 16 bit values when every vertex can be reached with them.
+    @param fileName - file to write
+    @param vertices - vertices of the mesh
+    @param indices - three per triangle
+    @return false if the mesh is empty, an index is out of range or the file cannot be written
+*/
+bool writeMeshFile(const std::string & fileName, const std::vector<MeshFileVertex> & vertices,
+    const std::vector<uint32_t> & indices)
+{
+    if (vertices.empty() || indices.empty() || indices.size() % 3 != 0 ||
+        *std::max_element(indices.begin(), indices.end()) >= vertices.size())
+    {
+        return false;
+    }
+
+    std::vector<MeshFileMeshlet> meshlets = MeshFileInfo::buildMeshlets(vertices, indices);
+    MeshFileBounds bounds = MeshFileInfo::computeBounds(vertices, indices, 0, indices.size());
+
+    MeshFileHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = MESH_FILE_MAGIC;
+    header.version = MESH_FILE_VERSION;
+    header.vertexCount = (uint32_t)vertices.size();
+    header.vertexStride = sizeof(MeshFileVertex);
+    header.indexCount = (uint32_t)indices.size();
+    header.indexType = vertices.size() <= 0x10000 ? gl::UNSIGNED_SHORT : gl::UNSIGNED_INT;
+    header.meshletCount = (uint32_t)meshlets.size();
+
+    header.vertices.offset = MeshFileInfo::align(sizeof(header));
+    header.vertices.size = vertices.size() * sizeof(MeshFileVertex);
+    header.indices.offset = MeshFileInfo::align(header.vertices.offset + header.vertices.size);
+    header.indices.size = indices.size() * MeshFileInfo::getIndexSize(header.indexType);
+    header.meshlets.offset = MeshFileInfo::align(header.indices.offset + header.indices.size);
+    header.meshlets.size = meshlets.size() * sizeof(MeshFileMeshlet);
+    header.bounds.offset = MeshFileInfo::align(header.meshlets.offset + header.meshlets.size);
+    header.bounds.size = sizeof(MeshFileBounds);
+
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        return false;
+    }
+
+    file.write((const char *)&header, sizeof(header));
+    MeshFileInfo::writePadding(file, sizeof(header));
+    file.write((const char *)vertices.data(), (std::streamsize)header.vertices.size);
+    MeshFileInfo::writePadding(file, header.vertices.offset + header.vertices.size);
+    if (header.indexType == gl::UNSIGNED_SHORT)
+    {
+        std::vector<uint16_t> shortIndices(indices.begin(), indices.end());
+        file.write((const char *)shortIndices.data(), (std::streamsize)header.indices.size);
+    }
+    else
+    {
+        file.write((const char *)indices.data(), (std::streamsize)header.indices.size);
+    }
+    MeshFileInfo::writePadding(file, header.indices.offset + header.indices.size);
+    file.write((const char *)meshlets.data(), (std::streamsize)header.meshlets.size);
+    MeshFileInfo::writePadding(file, header.meshlets.offset + header.meshlets.size);
+    file.write((const char *)&bounds, sizeof(bounds));
+
+    return (bool)file;
+}
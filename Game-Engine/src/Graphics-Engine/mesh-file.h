@@ -0,0 +1,122 @@
+/**
+    @headerfile mesh-file.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _MESH_FILE_H
+#define _MESH_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <gl_core_4_3.hpp>
+#include <Engine-Core\mapped-file.h>
+#include <Graphics-Engine\render-resources.h>
+
+const uint32_t MESH_FILE_MAGIC = 0x48534D44; //! "DMSH"
+const uint32_t MESH_FILE_VERSION = 1; //! Raise on any layout change, older files are then rejected
+const uint32_t MESH_FILE_ALIGNMENT = 64; //! Every section starts on a cache line
+const uint32_t MESHLET_MAX_VERTICES = 64;
+const uint32_t MESHLET_MAX_TRIANGLES = 124;
+
+//! Vertex as stored and as uploaded, attributes 0, 1 and 2 of the mesh's vertex array.
+struct MeshFileVertex
+{
+    float position[3];
+    float normal[3];
+    float texCoord[2];
+};
+
+//! Consecutive triangles of the index section close together in space, with their bounds.
+struct MeshFileMeshlet
+{
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    float center[3];
+    float radius;
+};
+
+//! Local space bounds of the whole mesh.
+struct MeshFileBounds
+{
+    float min[3];
+    float max[3];
+    float center[3]; //! Bounding sphere
+    float radius;
+};
+
+//! Byte range of a section, from the start of the file.
+struct MeshFileSection
+{
+    uint64_t offset;
+    uint64_t size;
+};
+
+/**
+    Start of every mesh file. The sections follow in the order listed, each aligned to
+    MESH_FILE_ALIGNMENT, so they can be used in place once the file is mapped. Values
+    are little endian.
+*/
+struct MeshFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t vertexCount;
+    uint32_t vertexStride; //! sizeof(MeshFileVertex) when written
+    uint32_t indexCount;
+    uint32_t indexType; //! gl::UNSIGNED_SHORT or gl::UNSIGNED_INT
+    uint32_t meshletCount;
+    uint32_t reserved;
+    MeshFileSection vertices;
+    MeshFileSection indices;
+    MeshFileSection meshlets;
+    MeshFileSection bounds;
+};
+
+/**
+    A mapped mesh file. Nothing is read into memory of its own: the accessors point into
+    the mapping and upload() hands the sections to GL as they are, so loading costs what
+    reading the file from disk costs.
+
+    openMemory() reads a file already in memory instead, e.g. one AssetStreamer loaded,
+    which then fills the buffers of allocate() itself.
+*/
+class MeshFile
+{
+    public:
+        MeshFile();
+
+        bool open(const std::string & fileName);
+        bool openMemory(const void * data, size_t size);
+        void close();
+        bool isOpen() const;
+
+        const MeshFileHeader & getHeader() const;
+        const MeshFileVertex * getVertices() const;
+        const void * getIndices() const;
+        const MeshFileMeshlet * getMeshlets() const;
+        const MeshFileBounds & getBounds() const;
+
+        Mesh upload() const;
+        Mesh allocate() const;
+
+    private:
+        MappedFile m_file;
+        const unsigned char * m_pData; //! Start of the file, mapped or in the caller's memory
+        size_t m_size;
+        const MeshFileHeader * m_pHeader; //! NULL until a valid file is open
+
+        MeshFile(const MeshFile &);
+        MeshFile & operator=(const MeshFile &);
+
+        const unsigned char * getSection(const MeshFileSection & section) const;
+        bool validate() const;
+        Mesh createMesh(bool bWithData) const;
+};
+
+bool writeMeshFile(const std::string & fileName, const std::vector<MeshFileVertex> & vertices,
+    const std::vector<uint32_t> & indices);
+
+#endif // !_MESH_FILE_H
@@ -0,0 +1,243 @@
+/**
+    @file program-binary-cache.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\program-binary-cache.h>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+namespace ProgramCacheInfo
+{
+    const uint32_t MAGIC = 0x4250444E; //! "NDPB"
+    const uint32_t VERSION = 1;
+
+    //! Written in front of every binary.
+    struct FileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t key;
+        uint32_t format;
+        uint32_t length;
+    };
+
+    /**
+        64 bit FNV-1a, continued from a previous hash
+    */
+    inline uint64_t hash(const void * data, size_t size, uint64_t hash)
+    {
+        const unsigned char * bytes = (const unsigned char *)data;
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+        Reads a GL string, empty if the driver returns none
+    */
+    inline std::string glString(GLenum name)
+    {
+        const GLubyte * value = gl::GetString(name);
+        return value ? std::string((const char *)value) : std::string();
+    }
+
+    /**
+        Creates a directory if it does not exist yet
+    */
+    inline void makeDirectory(const std::string & path)
+    {
+#ifdef _WIN32
+        _mkdir(path.c_str());
+#else
+        mkdir(path.c_str(), 0755);
+#endif
+    }
+}
+
+ProgramBinaryCache * ProgramBinaryCache::s_instance = NULL;
+
+/**
+    Creates the cache, nothing is read from disk until a program is looked up
+    @param directory - where binaries are kept, created on the first store
+*/
+ProgramBinaryCache::ProgramBinaryCache(const std::string & directory) :
+    m_directory(directory), m_supported(false), m_checkedSupport(false),
+    m_hits(0), m_compiles(0), m_hitMilliseconds(0.0), m_compileMilliseconds(0.0)
+{
+    s_instance = this;
+}
+
+ProgramBinaryCache::~ProgramBinaryCache()
+{
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+ProgramBinaryCache * ProgramBinaryCache::get()
+{
+    return s_instance;
+}
+
+/**
+    Hashes a program's sources, their stages and the driver into the key it is cached by
+    @param sources - final source of every stage, after any preprocessing
+    @param types - stage of each source
+    @return cache key
+*/
+uint64_t ProgramBinaryCache::makeKey(const std::vector<std::string> & sources, const std::vector<GLenum> & types)
+{
+    if (m_driver.empty())
+    {
+        m_driver = ProgramCacheInfo::glString(gl::VENDOR) + "|" + ProgramCacheInfo::glString(gl::RENDERER) + "|" +
+            ProgramCacheInfo::glString(gl::VERSION);
+    }
+
+    uint64_t key = 14695981039346656037ull;
+    key = ProgramCacheInfo::hash(m_driver.data(), m_driver.size(), key);
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        GLenum type = i < types.size() ? types[i] : 0;
+        key = ProgramCacheInfo::hash(&type, sizeof(type), key);
+        key = ProgramCacheInfo::hash(sources[i].data(), sources[i].size(), key);
+    }
+    return key;
+}
+
+/**
+    Replaces a program with its cached binary. Whether the driver accepted it shows in
+    the program's LINK_STATUS, which is left for the caller to query when it suits.
+    @param program - program without attached shaders
+    @param key - see makeKey
+    @return true if a binary was found and handed to the driver
+*/
+bool ProgramBinaryCache::load(GLuint program, uint64_t key)
+{
+    if (!isSupported())
+    {
+        return false;
+    }
+
+    std::ifstream file(getPath(key).c_str(), std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    ProgramCacheInfo::FileHeader header;
+    std::vector<char> binary;
+    bool bRead = file.read((char *)&header, sizeof(header)) && header.magic == ProgramCacheInfo::MAGIC &&
+        header.version == ProgramCacheInfo::VERSION && header.key == key && header.length > 0;
+    if (bRead)
+    {
+        binary.resize(header.length);
+        bRead = (bool)file.read(&binary[0], header.length);
+    }
+    file.close();
+
+    if (!bRead)
+    {
+        return false;
+    }
+
+    gl::ProgramBinary(program, header.format, &binary[0], (GLsizei)header.length);
+    return true;
+}
+
+/**
+    Writes a linked program's binary to disk. The program should have been linked with
+    PROGRAM_BINARY_RETRIEVABLE_HINT set.
+    @param program - linked program
+    @param key - see makeKey
+*/
+void ProgramBinaryCache::store(GLuint program, uint64_t key)
+{
+    if (!isSupported())
+    {
+        return;
+    }
+
+    GLint length = 0;
+    gl::GetProgramiv(program, gl::PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+    {
+        return;
+    }
+
+    std::vector<char> binary((size_t)length);
+    GLenum format = 0;
+    gl::GetProgramBinary(program, length, &length, &format, &binary[0]);
+
+    ProgramCacheInfo::FileHeader header = { ProgramCacheInfo::MAGIC, ProgramCacheInfo::VERSION, key, format, (uint32_t)length };
+
+    ProgramCacheInfo::makeDirectory(m_directory);
+    std::ofstream file(getPath(key).c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        std::cerr << "Program cache: unable to write " << getPath(key) << std::endl;
+        return;
+    }
+    file.write((const char *)&header, sizeof(header));
+    file.write(&binary[0], length);
+}
+
+/**
+    Adds a program load to the startup report
+    @param bFromCache - true if the binary was used
+    @param fMilliseconds - time taken to get a linked program
+*/
+void ProgramBinaryCache::recordLoad(bool bFromCache, double fMilliseconds)
+{
+    if (bFromCache)
+    {
+        ++m_hits;
+        m_hitMilliseconds += fMilliseconds;
+    }
+    else
+    {
+        ++m_compiles;
+        m_compileMilliseconds += fMilliseconds;
+    }
+}
+
+/**
+    Prints how many programs came from the cache and how many were compiled
+*/
+void ProgramBinaryCache::printReport() const
+{
+    std::cout << "Shader programs: " << m_hits << " from cache (" << m_hitMilliseconds << " ms), "
+        << m_compiles << " compiled (" << m_compileMilliseconds << " ms)" << std::endl;
+}
+
+/**
+    Checks once whether the driver offers any binary format
+*/
+bool ProgramBinaryCache::isSupported()
+{
+    if (!m_checkedSupport)
+    {
+        GLint formats = 0;
+        gl::GetIntegerv(gl::NUM_PROGRAM_BINARY_FORMATS, &formats);
+        m_supported = formats > 0;
+        m_checkedSupport = true;
+    }
+    return m_supported;
+}
+
+std::string ProgramBinaryCache::getPath(uint64_t key) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+    return m_directory + name;
+}
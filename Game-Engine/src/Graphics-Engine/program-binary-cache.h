@@ -0,0 +1,60 @@
+/**
+    @headerfile program-binary-cache.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _PROGRAM_BINARY_CACHE_H
+#define _PROGRAM_BINARY_CACHE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <gl_core_4_3.hpp>
+
+/**
+    Keeps linked programs on disk as driver binaries so later launches skip compiling.
+    A program's key hashes every source it was built from together with the driver's
+    vendor, renderer and version, so editing a shader or updating the driver simply
+    misses the cache. The driver may still reject a binary, callers then compile as
+    usual and store the result again.
+
+    ShaderManager uses the cache returned by get() when there is one.
+*/
+class ProgramBinaryCache
+{
+    public:
+        explicit ProgramBinaryCache(const std::string & directory = "resources/ShaderCache/");
+        ~ProgramBinaryCache();
+
+        static ProgramBinaryCache * get();
+
+        uint64_t makeKey(const std::vector<std::string> & sources, const std::vector<GLenum> & types);
+        bool load(GLuint program, uint64_t key);
+        void store(GLuint program, uint64_t key);
+
+        void recordLoad(bool bFromCache, double fMilliseconds);
+        void printReport() const;
+
+    private:
+        static ProgramBinaryCache * s_instance;
+
+        std::string m_directory;
+        std::string m_driver; //! Vendor, renderer and version, read once a context exists
+        bool m_supported;
+        bool m_checkedSupport;
+
+        int m_hits;
+        int m_compiles;
+        double m_hitMilliseconds;
+        double m_compileMilliseconds;
+
+        ProgramBinaryCache(const ProgramBinaryCache &);
+        ProgramBinaryCache & operator=(const ProgramBinaryCache &);
+
+        bool isSupported();
+        std::string getPath(uint64_t key) const;
+};
+
+#endif // !_PROGRAM_BINARY_CACHE_H
@@ -0,0 +1,338 @@
+/**
+    @file render-queue.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\render-queue.h>
+#include <Engine-Core\job-system.h>
+#include <Graphics-Engine\gl-state-cache.h>
+#include <Graphics-Engine\gpu-profiler.h>
+#include <algorithm>
+#include <cstring>
+
+namespace RenderInfo
+{
+    const uint32_t NO_STATE = 0xFFFFFFFF; //! Never a valid name, forces the first bind
+
+    /**
+        Maps a depth in [0, 1] to an integer that sorts the same way
+    */
+    inline uint64_t quantiseDepth(float fDepth)
+    {
+        return (uint64_t)(glm::clamp(fDepth, 0.f, 1.f) * 4294967295.0);
+    }
+
+    /**
+        Names a pass in GPU timings
+    */
+    inline const char * getPassName(uint32_t pass)
+    {
+        switch (pass)
+        {
+            case PASS_OPAQUE: return "opaque pass";
+            case PASS_TRANSPARENT: return "transparent pass";
+            case PASS_OVERLAY: return "overlay pass";
+            default: return "other pass";
+        }
+    }
+}
+
+/**
+    Builds the key a packet is sorted by. Opaque and overlay packets group by shader, then
+    material, then draw front to back so early depth testing rejects more. Transparent
+    packets have to blend back to front, so there depth comes before shader and material.
+
+    Layout, most significant first:
+        opaque/overlay: pass (4) | shader (12) | material (16) | depth (32)
+        transparent:    pass (4) | inverted depth (32) | shader (12) | material (16)
+
+    @param pass - pass the packet belongs to
+    @param shader - shader id, only the low 12 bits are used
+    @param material - material id, only the low 16 bits are used
+    @param fDepth - view depth over the far plane, in [0, 1]
+    @return sort key
+*/
+uint64_t makeSortKey(RenderPass pass, uint32_t shader, uint32_t material, float fDepth)
+{
+    uint64_t key = (uint64_t)(pass & 0xF) << 60;
+    uint64_t depth = RenderInfo::quantiseDepth(fDepth);
+
+    if (pass == PASS_TRANSPARENT)
+    {
+        key |= (0xFFFFFFFFull - depth) << 28;
+        key |= (uint64_t)(shader & 0xFFF) << 16;
+        key |= (uint64_t)(material & 0xFFFF);
+    }
+    else
+    {
+        key |= (uint64_t)(shader & 0xFFF) << 48;
+        key |= (uint64_t)(material & 0xFFFF) << 32;
+        key |= depth;
+    }
+    return key;
+}
+
+/**
+    Creates a bucket for every job system thread, plus one shared by other threads
+*/
+RenderQueue::RenderQueue()
+{
+    JobSystem * jobs = JobSystem::get();
+    size_t threads = jobs ? jobs->getThreadCount() : 1;
+    m_buckets.resize(threads + 1);
+}
+
+/**
+    Records a packet into the calling thread's bucket
+    @param key - see makeSortKey
+    @param packet - the draw
+*/
+void RenderQueue::submit(uint64_t key, const DrawPacket & packet)
+{
+    JobSystem * jobs = JobSystem::get();
+    int thread = jobs ? jobs->getThreadIndex() : 0;
+    uint32_t bucketIndex = thread >= 0 && (size_t)thread < m_buckets.size() - 1 ?
+        (uint32_t)thread : (uint32_t)(m_buckets.size() - 1);
+    Bucket & bucket = m_buckets[bucketIndex];
+
+    std::unique_lock<std::mutex> lock(m_foreignMutex, std::defer_lock);
+    if (bucketIndex == m_buckets.size() - 1)
+    {
+        lock.lock();
+    }
+
+    SortEntry entry = { key, bucketIndex, (uint32_t)bucket.packets.size() };
+    bucket.entries.push_back(entry);
+    bucket.packets.push_back(packet);
+}
+
+/**
+    Gathers every bucket and sorts by key, least significant byte first. Bytes that are
+    the same in every key are skipped, which usually leaves only a few passes. Call once
+    recording has finished and before reading the packets back.
+*/
+void RenderQueue::sort()
+{
+    m_sorted.clear();
+    for (size_t b = 0; b < m_buckets.size(); b++)
+    {
+        m_sorted.insert(m_sorted.end(), m_buckets[b].entries.begin(), m_buckets[b].entries.end());
+    }
+
+    size_t count = m_sorted.size();
+    if (count < 2)
+    {
+        return;
+    }
+    m_scratch.resize(count);
+
+    // One histogram per byte, all taken in a single read of the keys
+    uint32_t histograms[8][256];
+    memset(histograms, 0, sizeof(histograms));
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t key = m_sorted[i].key;
+        for (int byte = 0; byte < 8; byte++)
+        {
+            ++histograms[byte][(key >> (byte * 8)) & 0xFF];
+        }
+    }
+
+    SortEntry * source = &m_sorted[0];
+    SortEntry * destination = &m_scratch[0];
+    for (int byte = 0; byte < 8; byte++)
+    {
+        uint32_t * histogram = histograms[byte];
+        if (histogram[(source[0].key >> (byte * 8)) & 0xFF] == count)
+        {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (int digit = 0; digit < 256; digit++)
+        {
+            uint32_t digitCount = histogram[digit];
+            histogram[digit] = offset;
+            offset += digitCount;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            destination[histogram[(source[i].key >> (byte * 8)) & 0xFF]++] = source[i];
+        }
+        std::swap(source, destination);
+    }
+
+    if (source != &m_sorted[0])
+    {
+        m_sorted.swap(m_scratch);
+    }
+}
+
+/**
+    Empties every bucket. The memory of earlier frames is left to the frame arena, the
+    new arrays are taken from this frame's arena at the sizes the last frame needed.
+*/
+void RenderQueue::clear()
+{
+    for (size_t b = 0; b < m_buckets.size(); b++)
+    {
+        Bucket & bucket = m_buckets[b];
+        size_t count = bucket.packets.size();
+        bucket.entries = FrameVector<SortEntry>();
+        bucket.packets = FrameVector<DrawPacket>();
+        bucket.entries.reserve(count);
+        bucket.packets.reserve(count);
+    }
+
+    size_t count = m_sorted.size();
+    m_sorted = FrameVector<SortEntry>();
+    m_scratch = FrameVector<SortEntry>();
+    m_sorted.reserve(count);
+    m_scratch.reserve(count);
+}
+
+/**
+    Gets the number of sorted packets, 0 until sort is called
+*/
+size_t RenderQueue::size() const
+{
+    return m_sorted.size();
+}
+
+/**
+    Gets a packet in sorted order
+    @param index - position after sorting
+*/
+const DrawPacket & RenderQueue::getPacket(size_t index) const
+{
+    const SortEntry & entry = m_sorted[index];
+    return m_buckets[entry.bucket].packets[entry.index];
+}
+
+uint64_t RenderQueue::getKey(size_t index) const
+{
+    return m_sorted[index].key;
+}
+
+RenderBackend::RenderBackend() : m_objectBuffer(NULL)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+/**
+    Sets what is called when the material changes between packets, e.g. to upload the
+    material block
+*/
+void RenderBackend::setMaterialCallback(const std::function<void(uint32_t)> & callback)
+{
+    m_materialCallback = callback;
+}
+
+/**
+    Sets the ring the packets' object blocks live in
+*/
+void RenderBackend::setObjectBuffer(UniformRingBuffer * buffer)
+{
+    m_objectBuffer = buffer;
+}
+
+/**
+    Issues every packet of a sorted queue in order
+    @param queue - sorted render queue
+*/
+void RenderBackend::submit(const RenderQueue & queue)
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+    GLStateCache * state = GLStateCache::get();
+
+    // What is bound before the first packet is unknown, so everything is set once
+    GLuint program = RenderInfo::NO_STATE;
+    GLuint vertexArray = RenderInfo::NO_STATE;
+    GLuint texture = RenderInfo::NO_STATE;
+    uint32_t material = RenderInfo::NO_STATE;
+
+    // Every pass is timed on the GPU as its own scope
+    GpuProfiler * gpuProfiler = GpuProfiler::get();
+    uint32_t pass = RenderInfo::NO_STATE;
+
+    for (size_t i = 0; i < queue.size(); i++)
+    {
+        const DrawPacket & packet = queue.getPacket(i);
+
+        uint32_t packetPass = (uint32_t)(queue.getKey(i) >> 60);
+        if (packetPass != pass && gpuProfiler)
+        {
+            if (pass != RenderInfo::NO_STATE)
+            {
+                gpuProfiler->end();
+            }
+            gpuProfiler->begin(RenderInfo::getPassName(packetPass));
+        }
+        pass = packetPass;
+
+        if (packet.program != program)
+        {
+            program = packet.program;
+            state->useProgram(program);
+            ++m_stats.programChanges;
+        }
+        if (packet.vertexArray != vertexArray)
+        {
+            vertexArray = packet.vertexArray;
+            state->bindVertexArray(vertexArray);
+            ++m_stats.vertexArrayChanges;
+        }
+        if (packet.texture != texture)
+        {
+            texture = packet.texture;
+            state->bindTexture(0, gl::TEXTURE_2D, texture);
+            ++m_stats.textureChanges;
+        }
+        if (packet.material != material)
+        {
+            material = packet.material;
+            if (m_materialCallback)
+            {
+                m_materialCallback(material);
+            }
+            ++m_stats.materialChanges;
+        }
+        if (m_objectBuffer)
+        {
+            // No block means the ring was full, the binding left over belongs to another object
+            if (packet.objectBlock < 0)
+            {
+                m_stats.droppedDraws += packet.count > 0 ? 1 : 0;
+                continue;
+            }
+            m_objectBuffer->bind(packet.objectBlock);
+            ++m_stats.objectBinds;
+        }
+
+        if (packet.count == 0)
+        {
+            continue;
+        }
+        if (packet.indexType != 0)
+        {
+            size_t indexSize = packet.indexType == gl::UNSIGNED_INT ? 4 : packet.indexType == gl::UNSIGNED_SHORT ? 2 : 1;
+            gl::DrawElements(packet.mode, packet.count, packet.indexType, (const void *)(packet.first * indexSize));
+        }
+        else
+        {
+            gl::DrawArrays(packet.mode, packet.first, packet.count);
+        }
+        ++m_stats.draws;
+    }
+
+    if (pass != RenderInfo::NO_STATE && gpuProfiler)
+    {
+        gpuProfiler->end();
+    }
+}
+
+const RenderStats & RenderBackend::getStats() const
+{
+    return m_stats;
+}
@@ -0,0 +1,125 @@
+/**
+    @headerfile render-queue.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _RENDER_QUEUE_H
+#define _RENDER_QUEUE_H
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include <gl_core_4_3.hpp>
+#include <Engine-Core\frame-allocator.h>
+#include <Graphics-Engine\uniform-buffer.h>
+
+//! Passes in submission order, the top bits of every sort key.
+enum RenderPass
+{
+    PASS_OPAQUE = 0,
+    PASS_TRANSPARENT = 1,
+    PASS_OVERLAY = 2
+};
+
+//! Everything the backend needs for one draw.
+struct DrawPacket
+{
+    GLuint program;
+    GLuint vertexArray;
+    GLuint texture; //! Bound to unit 0, 0 for none
+    uint32_t material; //! Handed to the backend's material callback when it changes
+    GLintptr objectBlock; //! Offset in the object ring, -1 for none, which a backend with an object ring does not draw
+    GLenum mode;
+    GLenum indexType; //! 0 draws arrays
+    GLint first; //! First vertex, or first index for indexed draws
+    GLsizei count; //! 0 applies the state but issues no draw
+};
+
+uint64_t makeSortKey(RenderPass pass, uint32_t shader, uint32_t material, float fDepth);
+
+/**
+    Draw packets collected during a frame. Every job system thread records into its own
+    bucket without locking; threads the scheduler does not own share one locked bucket.
+    sort() radix sorts all buckets together by key, after which the packets can be read
+    back in order. Packets and keys live in the frame arena: clear, fill and submit the
+    queue within a frame.
+*/
+class RenderQueue
+{
+    public:
+        RenderQueue();
+
+        void submit(uint64_t key, const DrawPacket & packet);
+        void sort();
+        void clear();
+
+        size_t size() const;
+        const DrawPacket & getPacket(size_t index) const;
+        uint64_t getKey(size_t index) const;
+
+    private:
+        struct SortEntry
+        {
+            uint64_t key;
+            uint32_t bucket;
+            uint32_t index;
+        };
+
+        struct Bucket
+        {
+            FrameVector<SortEntry> entries;
+            FrameVector<DrawPacket> packets;
+            char padding[64]; //! Keeps neighbouring threads' buckets off the same cache line
+        };
+
+        std::vector<Bucket> m_buckets; //! One per job system thread, the last for foreign threads
+        std::mutex m_foreignMutex;
+        FrameVector<SortEntry> m_sorted;
+        FrameVector<SortEntry> m_scratch;
+
+        RenderQueue(const RenderQueue &);
+        RenderQueue & operator=(const RenderQueue &);
+};
+
+//! State changes the backend made while submitting the last queue.
+struct RenderStats
+{
+    size_t draws;
+    size_t programChanges;
+    size_t vertexArrayChanges;
+    size_t textureChanges;
+    size_t materialChanges;
+    size_t objectBinds;
+    size_t droppedDraws; //! Packets left undrawn because the object ring was full
+};
+
+/**
+    Walks a sorted queue on the GL thread and issues each packet, only changing the
+    program, vertex array, texture and material where they differ from the previous
+    packet. Sorting by key places packets sharing state next to each other. Binds go
+    through the GLStateCache, so state left from before the queue is not set again.
+*/
+class RenderBackend
+{
+    public:
+        RenderBackend();
+
+        void setMaterialCallback(const std::function<void(uint32_t)> & callback);
+        void setObjectBuffer(UniformRingBuffer * buffer);
+        void submit(const RenderQueue & queue);
+
+        const RenderStats & getStats() const;
+
+    private:
+        std::function<void(uint32_t)> m_materialCallback;
+        UniformRingBuffer * m_objectBuffer;
+        RenderStats m_stats;
+
+        RenderBackend(const RenderBackend &);
+        RenderBackend & operator=(const RenderBackend &);
+};
+
+#endif // !_RENDER_QUEUE_H
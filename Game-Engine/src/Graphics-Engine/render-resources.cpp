@@ -0,0 +1,160 @@
+/**
+    @file render-resources.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\render-resources.h>
+#include <Graphics-Engine\gl-state-cache.h>
+#include <cassert>
+
+RenderResources * RenderResources::s_instance = NULL;
+
+/**
+    Creates the pools handles are resolved in, create them before the scene
+    @param limits - slots per pool, fixed for the lifetime of the pools
+*/
+RenderResources::RenderResources(const RenderResourceLimits & limits) :
+    m_shaders(limits.shaders), m_buffers(limits.buffers), m_meshes(limits.meshes), m_textures(limits.textures)
+{
+    s_instance = this;
+}
+
+/**
+    Deletes the GL objects of meshes and textures still alive, shaders and buffers
+    delete their own
+*/
+RenderResources::~RenderResources()
+{
+    m_meshes.forEach([this](MeshHandle, Mesh & mesh)
+    {
+        deleteMesh(mesh);
+    });
+    m_textures.forEach([this](TextureHandle, Texture & texture)
+    {
+        deleteTexture(texture);
+    });
+
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+RenderResources * RenderResources::get()
+{
+    assert(s_instance && "resources are used without RenderResources");
+    return s_instance;
+}
+
+RenderResourceLimits RenderResources::getDefaultLimits()
+{
+    RenderResourceLimits limits = { 256, 256, 4096, 4096 };
+    return limits;
+}
+
+/**
+    @return handle to an empty program, invalid if the pool is full
+*/
+ShaderHandle RenderResources::createShader()
+{
+    return m_shaders.create();
+}
+
+ShaderManager * RenderResources::getShader(ShaderHandle handle)
+{
+    return m_shaders.get(handle);
+}
+
+void RenderResources::destroyShader(ShaderHandle handle)
+{
+    m_shaders.destroy(handle);
+}
+
+/**
+    @return handle to a buffer still to be created, invalid if the pool is full
+*/
+BufferHandle RenderResources::createBuffer()
+{
+    return m_buffers.create();
+}
+
+UniformBuffer * RenderResources::getBuffer(BufferHandle handle)
+{
+    return m_buffers.get(handle);
+}
+
+void RenderResources::destroyBuffer(BufferHandle handle)
+{
+    m_buffers.destroy(handle);
+}
+
+/**
+    Takes ownership of a mesh's GL objects
+    @return handle to the mesh, invalid if the pool is full
+*/
+MeshHandle RenderResources::createMesh(const Mesh & mesh)
+{
+    return m_meshes.create(mesh);
+}
+
+const Mesh * RenderResources::getMesh(MeshHandle handle) const
+{
+    return m_meshes.get(handle);
+}
+
+void RenderResources::destroyMesh(MeshHandle handle)
+{
+    const Mesh * mesh = m_meshes.get(handle);
+    if (mesh)
+    {
+        deleteMesh(*mesh);
+        m_meshes.destroy(handle);
+    }
+}
+
+/**
+    Takes ownership of a texture object
+    @return handle to the texture, invalid if the pool is full
+*/
+TextureHandle RenderResources::createTexture(const Texture & texture)
+{
+    return m_textures.create(texture);
+}
+
+const Texture * RenderResources::getTexture(TextureHandle handle) const
+{
+    return m_textures.get(handle);
+}
+
+void RenderResources::destroyTexture(TextureHandle handle)
+{
+    const Texture * texture = m_textures.get(handle);
+    if (texture)
+    {
+        deleteTexture(*texture);
+        m_textures.destroy(handle);
+    }
+}
+
+/**
+    Deletes the GL objects of a mesh, for meshes never handed to createMesh
+*/
+void RenderResources::deleteMesh(const Mesh & mesh)
+{
+    GLStateCache * state = GLStateCache::get();
+    state->releaseVertexArray(mesh.vertexArray);
+    state->releaseBuffer(mesh.vertexBuffer);
+    state->releaseBuffer(mesh.indexBuffer);
+    gl::DeleteVertexArrays(1, &mesh.vertexArray);
+    gl::DeleteBuffers(1, &mesh.vertexBuffer);
+    if (mesh.indexBuffer != 0)
+    {
+        gl::DeleteBuffers(1, &mesh.indexBuffer);
+    }
+}
+
+void RenderResources::deleteTexture(const Texture & texture)
+{
+    GLStateCache::get()->releaseTexture(texture.name);
+    gl::DeleteTextures(1, &texture.name);
+}
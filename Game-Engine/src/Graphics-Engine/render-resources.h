@@ -0,0 +1,96 @@
+/**
+    @headerfile render-resources.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _RENDER_RESOURCES_H
+#define _RENDER_RESOURCES_H
+
+#include <cstdint>
+#include <gl_core_4_3.hpp>
+#include <Engine-Core\object-pool.h>
+#include <Graphics-Engine\shader-manager.h>
+#include <Graphics-Engine\uniform-buffer.h>
+
+//! GL objects of a mesh ready to draw, the pool deletes them with the mesh.
+struct Mesh
+{
+    GLuint vertexArray;
+    GLuint vertexBuffer;
+    GLuint indexBuffer; //! 0 for meshes drawn without indices
+    GLenum mode;
+    GLenum indexType; //! 0 for meshes drawn without indices
+    GLsizei count; //! Indices, or vertices without indices
+};
+
+//! GL texture object, the pool deletes it with the texture.
+struct Texture
+{
+    GLuint name;
+    GLenum target;
+};
+
+typedef PoolHandle<ShaderManager> ShaderHandle;
+typedef PoolHandle<UniformBuffer> BufferHandle;
+typedef PoolHandle<Mesh> MeshHandle;
+typedef PoolHandle<Texture> TextureHandle;
+
+//! Slots per pool, see RenderResources.
+struct RenderResourceLimits
+{
+    uint32_t shaders;
+    uint32_t buffers;
+    uint32_t meshes;
+    uint32_t textures;
+};
+
+/**
+    Owns the engine's GL resources in fixed size pools and refers to them by handle, so
+    a destroyed resource can be detected instead of dangling. Resources are destroyed
+    with the pools at the latest, while the context is still current.
+    Entities follow the same scheme in EntityWorld.
+*/
+class RenderResources
+{
+    public:
+        explicit RenderResources(const RenderResourceLimits & limits = getDefaultLimits());
+        ~RenderResources();
+
+        static RenderResources * get();
+        static RenderResourceLimits getDefaultLimits();
+
+        ShaderHandle createShader();
+        ShaderManager * getShader(ShaderHandle handle);
+        void destroyShader(ShaderHandle handle);
+
+        BufferHandle createBuffer();
+        UniformBuffer * getBuffer(BufferHandle handle);
+        void destroyBuffer(BufferHandle handle);
+
+        MeshHandle createMesh(const Mesh & mesh);
+        const Mesh * getMesh(MeshHandle handle) const;
+        void destroyMesh(MeshHandle handle);
+
+        TextureHandle createTexture(const Texture & texture);
+        const Texture * getTexture(TextureHandle handle) const;
+        void destroyTexture(TextureHandle handle);
+
+        void deleteMesh(const Mesh & mesh);
+
+    private:
+        static RenderResources * s_instance;
+
+        ObjectPool<ShaderManager> m_shaders;
+        ObjectPool<UniformBuffer> m_buffers;
+        ObjectPool<Mesh> m_meshes;
+        ObjectPool<Texture> m_textures;
+
+        RenderResources(const RenderResources &);
+        RenderResources & operator=(const RenderResources &);
+
+        void deleteTexture(const Texture & texture);
+};
+
+#endif // !_RENDER_RESOURCES_H
@@ -0,0 +1,128 @@
+/**
+    @file render-test.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\render-test.h>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <Engine-Core\frame-allocator.h>
+#include <Graphics-Engine\camera.h>
+#include <Graphics-Engine\engine-scene.h>
+#include <Graphics-Engine\gl-recorder.h>
+#include <Graphics-Engine\gl-state-cache.h>
+#include <Graphics-Engine\render-resources.h>
+#include <Graphics-Engine\uniform-buffer.h>
+
+namespace RenderTestInfo
+{
+    int s_failures = 0;
+
+    void check(bool bPassed, const char * what)
+    {
+        if (!bPassed)
+        {
+            std::cerr << "FAILED: " << what << std::endl;
+            ++s_failures;
+        }
+    }
+
+    //! Captured commands with this name
+    std::vector<GLCommand> find(const std::vector<GLCommand> & commands, const char * name)
+    {
+        std::vector<GLCommand> found;
+        for (size_t i = 0; i < commands.size(); i++)
+        {
+            if (strcmp(commands[i].name, name) == 0)
+            {
+                found.push_back(commands[i]);
+            }
+        }
+        return found;
+    }
+
+    //! Position of the first command with this name, commands.size() if there is none
+    size_t indexOf(const std::vector<GLCommand> & commands, const char * name)
+    {
+        size_t i = 0;
+        while (i < commands.size() && strcmp(commands[i].name, name) != 0)
+        {
+            i++;
+        }
+        return i;
+    }
+
+    //! Captures the commands of one rendered frame
+    std::vector<GLCommand> renderFrame(GLRecorder & recorder, EngineScene & scene, Camera & camera)
+    {
+        recorder.clearCommands();
+        scene.render(camera, 0.f);
+        std::vector<GLCommand> commands = recorder.getCommands();
+        GLStateCache::get()->endFrame();
+        FrameAllocator::get()->nextFrame();
+        recorder.endFrame();
+        return commands;
+    }
+}
+
+bool testSceneRendering()
+{
+    RenderTestInfo::s_failures = 0;
+
+    // Objects are released in reverse order, the recorder outlives every GL object
+    GLRecorder recorder(GLRecorder::RECORD_NULL);
+    recorder.install();
+    FrameAllocator frameMemory;
+    GLStateCache state;
+    RenderResources resources;
+    {
+        Camera camera(glm::vec3(0.f, 0.f, 5.f), glm::radians(60.f), 1.f, 0.1f, 100.f);
+        EngineScene scene;
+        scene.initScene(camera);
+        recorder.setCapture(true);
+
+        // First frame: the scene holds a single cube in front of the camera
+        std::vector<GLCommand> commands = RenderTestInfo::renderFrame(recorder, scene, camera);
+        std::vector<GLCommand> clears = RenderTestInfo::find(commands, "Clear");
+        std::vector<GLCommand> draws = RenderTestInfo::find(commands, "DrawElements");
+        RenderTestInfo::check(clears.size() == 1 && clears[0].target == (GLenum)(gl::COLOR_BUFFER_BIT | gl::DEPTH_BUFFER_BIT),
+            "one clear of colour and depth");
+        RenderTestInfo::check(draws.size() == 1, "one indexed draw for the cube");
+        RenderTestInfo::check(!draws.empty() && draws[0].target == (GLenum)gl::TRIANGLES && draws[0].value == 36,
+            "the cube is drawn as 12 triangles");
+        RenderTestInfo::check(RenderTestInfo::indexOf(commands, "Clear") < RenderTestInfo::indexOf(commands, "DrawElements"),
+            "clear comes before the draw");
+        RenderTestInfo::check(frameMemory.getStats().used > 0, "the render queue takes its memory from the frame arena");
+
+        std::vector<GLCommand> ranges = RenderTestInfo::find(commands, "BindBufferRange");
+        bool bObjectBlockBound = false;
+        for (size_t i = 0; i < ranges.size(); i++)
+        {
+            bObjectBlockBound = bObjectBlockBound || ranges[i].target == (GLenum)gl::UNIFORM_BUFFER;
+        }
+        RenderTestInfo::check(bObjectBlockBound &&
+            RenderTestInfo::indexOf(commands, "BindBufferRange") < RenderTestInfo::indexOf(commands, "DrawElements"),
+            "the object block is bound before the draw");
+
+        // Second frame: program and vertex array are still bound, the state cache drops the binds
+        commands = RenderTestInfo::renderFrame(recorder, scene, camera);
+        RenderTestInfo::check(RenderTestInfo::find(commands, "DrawElements").size() == 1, "the cube is drawn again");
+        RenderTestInfo::check(RenderTestInfo::find(commands, "UseProgram").empty(), "the program is not bound again");
+        RenderTestInfo::check(RenderTestInfo::find(commands, "BindVertexArray").empty(), "the vertex array is not bound again");
+
+        // Looking away: the cube is culled, the frame is still cleared
+        Camera away(glm::vec3(0.f, 0.f, -5.f), glm::radians(60.f), 1.f, 0.1f, 100.f);
+        commands = RenderTestInfo::renderFrame(recorder, scene, away);
+        RenderTestInfo::check(RenderTestInfo::find(commands, "DrawElements").empty(), "a culled cube issues no draw");
+        RenderTestInfo::check(RenderTestInfo::find(commands, "Clear").size() == 1, "a frame without draws is still cleared");
+    }
+    recorder.uninstall();
+
+    if (RenderTestInfo::s_failures == 0)
+    {
+        std::cout << "Scene rendering: all checks passed" << std::endl;
+    }
+    return RenderTestInfo::s_failures == 0;
+}
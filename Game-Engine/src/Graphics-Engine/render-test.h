@@ -0,0 +1,20 @@
+/**
+    @headerfile render-test.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _RENDER_TEST_H
+#define _RENDER_TEST_H
+
+/**
+    Renders the engine scene with the null GL driver and checks the commands the
+    recorder captured: what is drawn, what the state cache filters on a second frame,
+    and that culled objects issue no draw. Needs no window or graphics stack, run it
+    from the directory holding resources/.
+    @return false if any check failed, the failures are printed
+*/
+bool testSceneRendering();
+
+#endif // !_RENDER_TEST_H
@@ -0,0 +1,61 @@
+/**
+    @headerfile scene-components.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _SCENE_COMPONENTS_H
+#define _SCENE_COMPONENTS_H
+
+#include <cstdint>
+#include <glm\glm.hpp>
+#include <glm\gtc\quaternion.hpp>
+#include <Graphics-Engine\render-resources.h>
+#include <Graphics-Engine\transform-hierarchy.h>
+
+//! Local placement of an entity after the latest simulation step.
+struct Transform
+{
+    glm::vec3 position;
+    glm::quat rotation;
+    glm::vec3 scale;
+};
+
+//! Placement after the step before, rendering blends towards Transform from here.
+struct PreviousTransform
+{
+    glm::vec3 position;
+    glm::quat rotation;
+    glm::vec3 scale;
+};
+
+//! Constant rotation applied while the scene is animating.
+struct Spin
+{
+    glm::vec3 axis;
+    float fSpeed; //! Radians per second
+};
+
+//! Links an entity to its node in the scene's TransformHierarchy.
+struct TransformNode
+{
+    TransformHandle handle;
+    uint32_t moving; //! Non-zero while the local matrix still has to follow Transform
+};
+
+//! Bounding sphere in an object's local space, the scene keeps it in its spatial index.
+struct Bounds
+{
+    glm::vec3 center;
+    float fRadius;
+};
+
+//! Marks an entity as drawn with the given mesh and material.
+struct Renderable
+{
+    MeshHandle mesh;
+    uint32_t material;
+};
+
+#endif // !_SCENE_COMPONENTS_H
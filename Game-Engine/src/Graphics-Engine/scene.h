@@ -16,6 +16,9 @@ class Scene
         //!Defualt constructor which sets the member varible to true.
         Scene() : m_bAnimate(true) {};
 
+        //!Scenes are owned through this base class, so derived scenes must be destroyed through it.
+        virtual ~Scene() {};
+
         /**
         Loads textures and initialises shaders.
 
@@ -23,12 +26,20 @@ class Scene
         */
         virtual void initScene(Camera camera) = 0;
 
+        /**
+        Advances the simulation by one fixed step.
+
+        @param fTimeStep <float> - length of the step in seconds, constant between calls.
+        */
+        virtual void updateScene(float fTimeStep) = 0;
+
         /**
         Draws the scene
 
         @param camera <Camera> - Draws the camera veiw into the scene
+        @param fAlpha <float> - how far between the last two simulation steps this frame lies [0, 1).
         */
-        virtual void render(Camera camera) = 0;
+        virtual void render(Camera camera, float fAlpha) = 0;
 
         /**
         Called when the screen is resized
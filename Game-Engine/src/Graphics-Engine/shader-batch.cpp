@@ -0,0 +1,123 @@
+/**
+    @file shader-batch.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\shader-batch.h>
+
+ShaderBatch::ShaderBatch() : m_submitted(false)
+{
+
+}
+
+/**
+    Adds a program to be built by the next submit
+    @param program - program to build, must outlive the batch
+    @param fileNames - one file per stage, see ShaderManager::loadProgram
+*/
+void ShaderBatch::add(ShaderManager & program, const std::vector<std::string> & fileNames)
+{
+    Entry entry = { &program, fileNames };
+    m_entries.push_back(entry);
+}
+
+/**
+    Hands every program to the driver without waiting for any of them. If one of them
+    cannot be submitted the programs already handed over are cancelled and the batch
+    is emptied, so none of them is left half built.
+*/
+void ShaderBatch::submit()
+throw(ShaderProgramException)
+{
+    if (gl::exts::var_KHR_parallel_shader_compile)
+    {
+        gl::MaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
+    else if (gl::exts::var_ARB_parallel_shader_compile)
+    {
+        gl::MaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    }
+
+    size_t submitted = 0;
+    try
+    {
+        for (; submitted < m_entries.size(); submitted++)
+        {
+            m_entries[submitted].program->submitProgram(m_entries[submitted].fileNames);
+        }
+    }
+    catch (ShaderProgramException &)
+    {
+        // The program that threw was not handed over, it may be busy with a build of its own
+        for (size_t i = 0; i < submitted; i++)
+        {
+            m_entries[i].program->cancelProgram();
+        }
+        m_entries.clear();
+        m_submitted = false;
+        throw;
+    }
+    m_submitted = true;
+}
+
+/**
+    Checks without blocking how far the driver got
+    @return number of programs finish() will not stall on
+*/
+size_t ShaderBatch::poll()
+{
+    if (!m_submitted)
+    {
+        return 0;
+    }
+
+    size_t ready = 0;
+    for (size_t i = 0; i < m_entries.size(); i++)
+    {
+        if (m_entries[i].program->isReady())
+        {
+            ++ready;
+        }
+    }
+    return ready;
+}
+
+/**
+    Waits for every program and checks them. All programs are finished even if some
+    fail, the errors of every failed program are then thrown together.
+*/
+void ShaderBatch::finish()
+throw(ShaderProgramException)
+{
+    if (!m_submitted)
+    {
+        submit();
+    }
+
+    std::string errors;
+    for (size_t i = 0; i < m_entries.size(); i++)
+    {
+        try
+        {
+            m_entries[i].program->finishProgram();
+        }
+        catch (ShaderProgramException & e)
+        {
+            errors += e.what();
+            errors += "\n";
+        }
+    }
+
+    m_entries.clear();
+    m_submitted = false;
+
+    if (!errors.empty())
+    {
+        throw ShaderProgramException(errors);
+    }
+}
+
+size_t ShaderBatch::size() const
+{
+    return m_entries.size();
+}
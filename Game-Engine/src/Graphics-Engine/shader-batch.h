@@ -0,0 +1,48 @@
+/**
+    @headerfile shader-batch.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _SHADER_BATCH_H
+#define _SHADER_BATCH_H
+
+#include <string>
+#include <vector>
+#include <Graphics-Engine\shader-manager.h>
+
+/**
+    Builds several programs together. submit() hands every program to the driver before
+    any status is queried, so drivers that compile on their own threads work on all of
+    them at once instead of stalling on each in turn. With KHR/ARB_parallel_shader_compile
+    the driver is also asked to use as many threads as it likes and poll() reports which
+    programs are done; without it finish() simply waits.
+*/
+class ShaderBatch
+{
+    public:
+        ShaderBatch();
+
+        void add(ShaderManager & program, const std::vector<std::string> & fileNames);
+        void submit() throw (ShaderProgramException);
+        size_t poll();
+        void finish() throw (ShaderProgramException);
+
+        size_t size() const;
+
+    private:
+        struct Entry
+        {
+            ShaderManager * program;
+            std::vector<std::string> fileNames;
+        };
+
+        std::vector<Entry> m_entries;
+        bool m_submitted;
+
+        ShaderBatch(const ShaderBatch &);
+        ShaderBatch & operator=(const ShaderBatch &);
+};
+
+#endif // !_SHADER_BATCH_H
@@ -5,8 +5,14 @@
 */
 
 #include <Graphics-Engine\shader-manager.h>
+#include <Engine-Core\profiler.h>
+#include <Graphics-Engine\gl-state-cache.h>
+#include <Graphics-Engine\program-binary-cache.h>
+#include <Graphics-Engine\shader-preprocessor.h>
+#include <chrono>
 #include <fstream>
 #include <sstream>
+#include <cstring>
 #include <sys/stat.h>
 
 namespace ShaderInfo
@@ -29,9 +35,35 @@ namespace ShaderInfo
         { ".frag", ShaderType::FRAGMENT },
         { ".cs", ShaderType::COMPUTE }
     };
+
+    // FNV-1a, only used when building the uniform table and for name lookups
+    unsigned hashName(const char * name)
+    {
+        unsigned hash = 2166136261u;
+        while (*name)
+        {
+            hash ^= (unsigned char)*name++;
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    // Replaces the binding recorded for a block, so binding it again does not add a second entry
+    void recordBinding(std::vector<std::pair<std::string, GLuint>> & bindings, const char * blockName, GLuint binding)
+    {
+        for (size_t i = 0; i < bindings.size(); i++)
+        {
+            if (bindings[i].first == blockName)
+            {
+                bindings[i].second = binding;
+                return;
+            }
+        }
+        bindings.push_back(std::make_pair(std::string(blockName), binding));
+    }
 }
 
-ShaderManager::ShaderManager() : handle(0), linked(false)
+ShaderManager::ShaderManager() : handle(0), linked(false), reflected(false), uniformGeneration(0)
 {
 
 }
@@ -43,53 +75,54 @@ ShaderManager::~ShaderManager()
         return;
     }
 
-    // Query the number of attached shaders
-    GLint numShaders = 0;
-    gl::GetProgramiv(handle, gl::ATTACHED_SHADERS, &numShaders);
-
-    // Get the shader names
-    GLuint * shaderNames = new GLuint[numShaders];
-    gl::GetAttachedShaders(handle, numShaders, NULL, shaderNames);
-
-    // Delete the shaders
-    for (int i = 0; i < numShaders; i++)
+    // Detach and delete the shaders a few at a time, each pass gets the next ones
+    GLuint shaderNames[8];
+    GLsizei numShaders = 0;
+    do
     {
-        gl::DeleteShader(shaderNames[i]);
-    }
+        gl::GetAttachedShaders(handle, 8, &numShaders, shaderNames);
+        for (int i = 0; i < numShaders; i++)
+        {
+            gl::DetachShader(handle, shaderNames[i]);
+            gl::DeleteShader(shaderNames[i]);
+        }
+    } while (numShaders > 0);
 
     // Delete the program
+    GLStateCache::get()->releaseProgram(handle);
     gl::DeleteProgram(handle);
-    delete[] shaderNames;
 }
 
 void ShaderManager::compileShader(const char * fileName)
 throw(ShaderProgramException)
+{
+    // Pass the discovered shader type along
+    compileShader(fileName, getShaderType(fileName));
+}
+
+/**
+    Determines a shader's stage from its file extension
+    @param fileName - shader file, see ShaderInfo::extensions
+    @return shader type
+*/
+ShaderType ShaderManager::getShaderType(const char * fileName)
+throw(ShaderProgramException)
 {
     int numExts = sizeof(ShaderInfo::extensions) / sizeof(ShaderInfo::shader_file_extension);
 
     // Check the file name's extension to determine the shader type
     std::string extension = getExtension(fileName);
-    ShaderType type = VERTEX;
-    bool matchFound = false;
     for (int i = 0; i < numExts; i++)
     {
         if (extension == ShaderInfo::extensions[i].extentions)
         {
-            matchFound = true;
-            type = ShaderInfo::extensions[i].type;
-            break;
+            return ShaderInfo::extensions[i].type;
         }
     }
 
     // If we didn't find a match, throw an exception
-    if (!matchFound)
-    {
-        std::string messgage = "Unrecognized extension: " + extension;
-        throw ShaderProgramException(messgage);
-    }
-
-    // Pass the discovered shader type along
-    compileShader(fileName, type);
+    std::string messgage = "Unrecognized extension: " + extension;
+    throw ShaderProgramException(messgage);
 }
 
 std::string ShaderManager::getExtension(const char * name)
@@ -107,12 +140,78 @@ std::string ShaderManager::getExtension(const char * name)
 void ShaderManager::compileShader(const char * fileName, ShaderType type)
 throw(ShaderProgramException)
 {
-    if (!fileExists(fileName))
+    if (handle <= 0)
     {
-        std::string message = std::string("Shader: ") + fileName + " not found.";
-        throw ShaderProgramException(message);
+        handle = gl::CreateProgram();
+        if (handle == 0)
+        {
+            throw ShaderProgramException("Unable to create shader program.");
+        }
+    }
+
+    compileShader(readSource(fileName), type, fileName);
+}
+
+/**
+    Reads a shader file through the preprocessor, with includes pasted in and the
+    program's defines added
+    @param fileName - shader file
+    @return source for the driver
+*/
+std::string ShaderManager::readSource(const char * fileName)
+throw(ShaderProgramException)
+{
+    ShaderPreprocessor preprocessor;
+    return preprocessor.process(fileName, defines, sourceFiles);
+}
+
+/**
+    Builds the program from a set of shader files in one go. With a ProgramBinaryCache
+    present the linked binary is looked up by the files' contents first, and only on a
+    miss, or if the driver rejects the binary, are the shaders compiled and linked; the
+    result is then stored for the next launch. Either way the program ends up linked.
+    @param fileNames - one file per stage, the stage follows from the extension
+*/
+void ShaderManager::loadProgram(const std::vector<std::string> & fileNames)
+throw(ShaderProgramException)
+{
+    submitProgram(fileNames);
+    finishProgram();
+}
+
+/**
+    First half of loadProgram: hands the binary, or every stage's source and the link,
+    to the driver without asking for any result. Drivers compile in the background in
+    the meantime, so submit every program that is needed before finishing any of them.
+    Only missing files throw here, compile and link errors surface in finishProgram.
+    @param fileNames - one file per stage, the stage follows from the extension
+*/
+void ShaderManager::submitProgram(const std::vector<std::string> & fileNames)
+throw(ShaderProgramException)
+{
+    PROFILE_SCOPE("ShaderManager::submitProgram");
+
+    if (pending.active)
+    {
+        throw ShaderProgramException("Program is already being built.");
+    }
+
+    pending.start = std::chrono::high_resolution_clock::now();
+    pending.fileNames = fileNames;
+    programFiles = fileNames;
+    sourceFiles.clear();
+    pending.sources.clear();
+    pending.types.clear();
+    pending.shaders.clear();
+    for (size_t i = 0; i < fileNames.size(); i++)
+    {
+        pending.types.push_back(getShaderType(fileNames[i].c_str()));
+        pending.sources.push_back(readSource(fileNames[i].c_str()));
     }
 
+    ProgramBinaryCache * cache = ProgramBinaryCache::get();
+    pending.key = cache ? cache->makeKey(pending.sources, pending.types) : 0;
+
     if (handle <= 0)
     {
         handle = gl::CreateProgram();
@@ -122,24 +221,374 @@ throw(ShaderProgramException)
         }
     }
 
-    std::ifstream inFile(fileName, std::ios::in);
-    if (!inFile)
+    pending.fromCache = cache && !linked && cache->load(handle, pending.key);
+    if (!pending.fromCache)
+    {
+        submitCompile();
+    }
+    pending.active = true;
+}
+
+/**
+    Checks without blocking whether the driver is done with a submitted program. Without
+    KHR/ARB_parallel_shader_compile there is no way to ask, so it always says yes and
+    finishProgram waits instead.
+    @return true if finishProgram will not stall
+*/
+bool ShaderManager::isReady()
+{
+    if (!pending.active)
+    {
+        return true;
+    }
+
+    if (gl::sys::IsExtensionSupported("GL_KHR_parallel_shader_compile") ||
+        gl::sys::IsExtensionSupported("GL_ARB_parallel_shader_compile"))
     {
-        std::string message = std::string("Unable to open: ") + fileName;
+        GLint complete = 0;
+        gl::GetProgramiv(handle, gl::COMPLETION_STATUS_KHR, &complete);
+        return complete != 0;
+    }
+    return true;
+}
+
+/**
+    Second half of loadProgram: waits for the submitted build and checks it. A binary the
+    driver rejected is rebuilt from source here.
+*/
+void ShaderManager::finishProgram()
+throw(ShaderProgramException)
+{
+    PROFILE_SCOPE("ShaderManager::finishProgram");
+
+    if (!pending.active)
+    {
+        return;
+    }
+    pending.active = false;
+
+    GLint status = 0;
+    gl::GetProgramiv(handle, gl::LINK_STATUS, &status);
+    if (FALSE == status && pending.fromCache)
+    {
+        // Driver rejected the binary, build from source instead
+        pending.fromCache = false;
+        submitCompile();
+        gl::GetProgramiv(handle, gl::LINK_STATUS, &status);
+    }
+
+    if (FALSE == status)
+    {
+        // Report the stages that failed, or the link itself when they all compiled
+        std::string message;
+        for (size_t i = 0; i < pending.shaders.size(); i++)
+        {
+            GLint compiled = 0;
+            gl::GetShaderiv(pending.shaders[i], gl::COMPILE_STATUS, &compiled);
+            if (FALSE == compiled)
+            {
+                message += pending.fileNames[i] + ": shader compliation failed\n" + getShaderLog(pending.shaders[i]);
+            }
+        }
+        if (message.empty())
+        {
+            message = std::string("Program link failed:\n") + getProgramLog();
+        }
+        if (sourceFiles.size() > pending.fileNames.size())
+        {
+            // Logs name files by their source string number
+            message += "Source strings:";
+            for (size_t i = 0; i < sourceFiles.size(); i++)
+            {
+                message += " " + std::to_string(i) + " " + sourceFiles[i];
+            }
+            message += "\n";
+        }
         throw ShaderProgramException(message);
     }
 
-    // Get file contents
-    std::stringstream code;
-    code << inFile.rdbuf();
-    inFile.close();
+    linked = true;
+    reflected = false;
+    reflectUniforms();
+
+    ProgramBinaryCache * cache = ProgramBinaryCache::get();
+    if (cache)
+    {
+        if (!pending.fromCache)
+        {
+            cache->store(handle, pending.key);
+        }
+        double fMilliseconds = std::chrono::duration<double, std::milli>(
+            std::chrono::high_resolution_clock::now() - pending.start).count();
+        cache->recordLoad(pending.fromCache, fMilliseconds);
+    }
+}
+
+/**
+    Abandons a build handed to the driver by submitProgram without checking it. The
+    program object was relinked in place, so whatever it had linked before is gone too:
+    it is left unlinked, with no uniforms, until it is built again.
+*/
+void ShaderManager::cancelProgram()
+{
+    if (!pending.active)
+    {
+        return;
+    }
+    pending.active = false;
+
+    linked = false;
+    uniformSlots.clear();
+    uniformBuckets.clear();
+    uniformNames.clear();
+    ++uniformGeneration;
+    reflected = false;
 
-    compileShader(code.str(), type, fileName);
+    for (size_t i = 0; i < pending.shaders.size(); i++)
+    {
+        gl::DetachShader(handle, pending.shaders[i]);
+        gl::DeleteShader(pending.shaders[i]);
+    }
+    pending.shaders.clear();
+}
+
+/**
+    Adds a #define to every stage built from now on, replacing an earlier value
+    @param name - macro name
+    @param value - macro value, empty to define the name alone
+*/
+void ShaderManager::setDefine(const std::string & name, const std::string & value)
+{
+    for (size_t i = 0; i < defines.size(); i++)
+    {
+        if (defines[i].first == name)
+        {
+            defines[i].second = value;
+            return;
+        }
+    }
+    defines.push_back(std::make_pair(name, value));
+}
+
+/**
+    Names the feature bits getVariant takes. Changing them drops the variants built so far.
+    @param names - bit i of a feature mask defines names[i] as 1
+*/
+void ShaderManager::setFeatures(const std::vector<std::string> & names)
+{
+    if (names != featureNames)
+    {
+        featureNames = names;
+        variants.clear();
+    }
+}
+
+/**
+    Gets the permutation of this program with some features enabled. Variants are built
+    from the files given to loadProgram, with this program's defines and the feature
+    names defined, the first time each mask is asked for and kept afterwards, so only the
+    permutations actually used are ever compiled. Block bindings made on this program
+    carry over.
+    @param features - mask of feature bits, see setFeatures; 0 is this program itself
+    @return linked variant, owned by this program
+*/
+ShaderManager & ShaderManager::getVariant(uint32_t features)
+throw(ShaderProgramException)
+{
+    if (features == 0)
+    {
+        return *this;
+    }
+
+    std::map<uint32_t, std::unique_ptr<ShaderManager>>::iterator found = variants.find(features);
+    if (found != variants.end())
+    {
+        return *found->second;
+    }
+
+    if (programFiles.empty())
+    {
+        throw ShaderProgramException("Variants need a program built with loadProgram.");
+    }
+    if (featureNames.size() < 32 && (features >> featureNames.size()) != 0)
+    {
+        throw ShaderProgramException("Variant uses feature bits that have no name.");
+    }
+
+    std::unique_ptr<ShaderManager> variant(new ShaderManager());
+    variant->defines = defines;
+    for (size_t i = 0; i < featureNames.size(); i++)
+    {
+        if (features & (1u << i))
+        {
+            variant->setDefine(featureNames[i], "1");
+        }
+    }
+    variant->loadProgram(programFiles);
+
+    for (size_t i = 0; i < blockBindings.size(); i++)
+    {
+        variant->bindUniformBlock(blockBindings[i].first.c_str(), blockBindings[i].second);
+    }
+    for (size_t i = 0; i < storageBindings.size(); i++)
+    {
+        variant->bindStorageBlock(storageBindings[i].first.c_str(), storageBindings[i].second);
+    }
+
+    ShaderManager & result = *variant;
+    variants[features] = std::move(variant);
+    return result;
+}
+
+/**
+    Gets every file the program was built from, includes too, for watching them. The
+    position in the list is the source string number compile logs refer to.
+*/
+const std::vector<std::string> & ShaderManager::getSourceFiles() const
+{
+    return sourceFiles;
+}
+
+/**
+    Starts rebuilding the program from its files, for picking up edits while running.
+    The replacement is built on the side and this program keeps working unchanged until
+    finishReload swaps it in.
+*/
+void ShaderManager::submitReload()
+throw(ShaderProgramException)
+{
+    if (programFiles.empty())
+    {
+        throw ShaderProgramException("Only programs built with loadProgram can be reloaded.");
+    }
+
+    reloading.reset(new ShaderManager());
+    reloading->defines = defines;
+    try
+    {
+        reloading->submitProgram(programFiles);
+    }
+    catch (ShaderProgramException &)
+    {
+        reloading.reset();
+        throw;
+    }
+}
+
+bool ShaderManager::isReloading() const
+{
+    return reloading != NULL;
+}
+
+/**
+    Checks without blocking whether finishReload would stall, see isReady
+*/
+bool ShaderManager::isReloadReady()
+{
+    return !reloading || reloading->isReady();
+}
+
+/**
+    Swaps the rebuilt program in if it linked; otherwise the replacement is dropped, the
+    current program stays and the build errors are thrown. Uniform handles and variants
+    from before a successful swap are stale, look them up again.
+*/
+void ShaderManager::finishReload()
+throw(ShaderProgramException)
+{
+    if (!reloading)
+    {
+        return;
+    }
+
+    std::unique_ptr<ShaderManager> next(std::move(reloading));
+    next->finishProgram();
+
+    for (size_t i = 0; i < blockBindings.size(); i++)
+    {
+        next->bindUniformBlock(blockBindings[i].first.c_str(), blockBindings[i].second);
+    }
+    for (size_t i = 0; i < storageBindings.size(); i++)
+    {
+        next->bindStorageBlock(storageBindings[i].first.c_str(), storageBindings[i].second);
+    }
+
+    // The old program goes with next
+    std::swap(handle, next->handle);
+    std::swap(linked, next->linked);
+    uniformSlots.swap(next->uniformSlots);
+    uniformBuckets.swap(next->uniformBuckets);
+    uniformNames.swap(next->uniformNames);
+    ++uniformGeneration;
+    sourceFiles.swap(next->sourceFiles);
+    variants.clear();
+    reflected = false;
+}
+
+/**
+    Compiles every pending stage, attaches it and links, without querying any status
+*/
+void ShaderManager::submitCompile()
+{
+    for (size_t i = 0; i < pending.sources.size(); i++)
+    {
+        GLuint shaderHandle = gl::CreateShader(pending.types[i]);
+        const char * c_code = pending.sources[i].c_str();
+        gl::ShaderSource(shaderHandle, 1, &c_code, NULL);
+        gl::CompileShader(shaderHandle);
+        gl::AttachShader(handle, shaderHandle);
+        pending.shaders.push_back(shaderHandle);
+    }
+
+    gl::ProgramParameteri(handle, gl::PROGRAM_BINARY_RETRIEVABLE_HINT, gl::TRUE_);
+    gl::LinkProgram(handle);
+}
+
+/**
+    Gets a shader's info log
+*/
+std::string ShaderManager::getShaderLog(GLuint shaderHandle)
+{
+    int length = 0;
+    gl::GetShaderiv(shaderHandle, gl::INFO_LOG_LENGTH, &length);
+    if (length <= 0)
+    {
+        return "";
+    }
+
+    // Read straight into the string the message is built from
+    std::string log(length, '\0');
+    int written = 0;
+    gl::GetShaderInfoLog(shaderHandle, length, &written, &log[0]);
+    log.resize(written);
+    return log;
+}
+
+/**
+    Gets the program's info log
+*/
+std::string ShaderManager::getProgramLog()
+{
+    int length = 0;
+    gl::GetProgramiv(handle, gl::INFO_LOG_LENGTH, &length);
+    if (length <= 0)
+    {
+        return "";
+    }
+
+    // Read straight into the string the message is built from
+    std::string log(length, '\0');
+    int written = 0;
+    gl::GetProgramInfoLog(handle, length, &written, &log[0]);
+    log.resize(written);
+    return log;
 }
 
 void ShaderManager::compileShader(const std::string & source, ShaderType type, const char * fileName)
 throw(ShaderProgramException)
 {
+    PROFILE_SCOPE("ShaderManager::compileShader");
+
     if (handle <= 0)
     {
         handle = gl::CreateProgram();
@@ -163,17 +612,6 @@ throw(ShaderProgramException)
     if (FALSE == result)
     {
         // Compile failed, get log
-        int length = 0;
-        std::string logString;
-        gl::GetShaderiv(shaderHandle, gl::INFO_LOG_LENGTH, &length);
-        if (length > 0)
-        {
-            char * c_log = new char[length];
-            int written = 0;
-            gl::GetShaderInfoLog(shaderHandle, length, &written, c_log);
-            logString = c_log;
-            delete[] c_log;
-        }
         std::string message;
         if (fileName)
         {
@@ -183,7 +621,7 @@ throw(ShaderProgramException)
         {
             message = "Shader compilation failed.\n";
         }
-        message += logString;
+        message += getShaderLog(shaderHandle);
 
         throw ShaderProgramException(message);
 
@@ -197,6 +635,8 @@ throw(ShaderProgramException)
 
 void ShaderManager::link() throw(ShaderProgramException)
 {
+    PROFILE_SCOPE("ShaderManager::link");
+
     if (linked)
     {
         return;
@@ -213,27 +653,13 @@ void ShaderManager::link() throw(ShaderProgramException)
     gl::GetProgramiv(handle, gl::LINK_STATUS, &status);
     if (FALSE == status)
     {
-        // Store log and return false
-        int length = 0;
-        std::string logString;
-
-        gl::GetProgramiv(handle, gl::INFO_LOG_LENGTH, &length);
-
-        if (length > 0)
-        {
-            char * c_log = new char[length];
-            int written = 0;
-            gl::GetProgramInfoLog(handle, length, &written, c_log);
-            logString = c_log;
-            delete[] c_log;
-        }
-
-        throw ShaderProgramException(std::string("Program link failed:\n") + logString);
+        throw ShaderProgramException(std::string("Program link failed:\n") + getProgramLog());
     }
     else
     {
-        uniformLocations.clear();
         linked = true;
+        reflected = false;
+        reflectUniforms();
     }
 }
 
@@ -241,7 +667,7 @@ void ShaderManager::use() throw(ShaderProgramException)
 {
     if (handle <= 0 || (!linked))
         throw ShaderProgramException("Shader has not been linked");
-    gl::UseProgram(handle);
+    GLStateCache::get()->useProgram(handle);
 }
 
 int ShaderManager::getHandle()
@@ -264,6 +690,30 @@ void ShaderManager::bindFragDataLocation(GLuint location, const char * name)
     gl::BindFragDataLocation(handle, location, name);
 }
 
+bool ShaderManager::bindUniformBlock(const char * blockName, GLuint binding)
+{
+    GLuint index = gl::GetProgramResourceIndex(handle, gl::UNIFORM_BLOCK, blockName);
+    if (index == gl::INVALID_INDEX)
+    {
+        return false;
+    }
+    gl::UniformBlockBinding(handle, index, binding);
+    ShaderInfo::recordBinding(blockBindings, blockName, binding);
+    return true;
+}
+
+bool ShaderManager::bindStorageBlock(const char * blockName, GLuint binding)
+{
+    GLuint index = gl::GetProgramResourceIndex(handle, gl::SHADER_STORAGE_BLOCK, blockName);
+    if (index == gl::INVALID_INDEX)
+    {
+        return false;
+    }
+    gl::ShaderStorageBlockBinding(handle, index, binding);
+    ShaderInfo::recordBinding(storageBindings, blockName, binding);
+    return true;
+}
+
 void ShaderManager::setUniform(const char *name, float x, float y, float z)
 {
     GLint loc = getUniformLocation(name);
@@ -323,83 +773,117 @@ void ShaderManager::setUniform(const char *name, bool val)
     gl::Uniform1i(loc, val);
 }
 
-void ShaderManager::printActiveUniforms() {
-    GLint numUniforms = 0;
-    gl::GetProgramInterfaceiv(handle, gl::UNIFORM, gl::ACTIVE_RESOURCES, &numUniforms);
+UniformHandle ShaderManager::uniform(const char *name) const
+{
+    return UniformHandle(findUniformSlot(name), uniformGeneration);
+}
 
-    GLenum properties[] = { gl::NAME_LENGTH, gl::TYPE, gl::LOCATION, gl::BLOCK_INDEX };
+void ShaderManager::setUniform(UniformHandle h, float x, float y, float z)
+{
+    if (h.isValid()) gl::Uniform3f(getUniformLocation(h), x, y, z);
+}
 
-    printf("Active uniforms:\n");
-    for (int i = 0; i < numUniforms; ++i)
-    {
-        GLint results[4];
-        gl::GetProgramResourceiv(handle, gl::UNIFORM, i, 4, properties, 4, NULL, results);
+void ShaderManager::setUniform(UniformHandle h, const glm::vec2 & v)
+{
+    if (h.isValid()) gl::Uniform2f(getUniformLocation(h), v.x, v.y);
+}
 
-        if (results[3] != -1) continue;  // Skip uniforms in blocks 
-        GLint nameBufSize = results[0] + 1;
-        char * name = new char[nameBufSize];
-        gl::GetProgramResourceName(handle, gl::UNIFORM, i, nameBufSize, NULL, name);
-        printf("%-5d %s (%s)\n", results[2], name, getTypeString(results[1]));
-        delete[] name;
-    }
+void ShaderManager::setUniform(UniformHandle h, const glm::vec3 & v)
+{
+    if (h.isValid()) gl::Uniform3f(getUniformLocation(h), v.x, v.y, v.z);
 }
 
-void ShaderManager::printActiveUniformBlocks() {
-    GLint numBlocks = 0;
+void ShaderManager::setUniform(UniformHandle h, const glm::vec4 & v)
+{
+    if (h.isValid()) gl::Uniform4f(getUniformLocation(h), v.x, v.y, v.z, v.w);
+}
 
-    gl::GetProgramInterfaceiv(handle, gl::UNIFORM_BLOCK, gl::ACTIVE_RESOURCES, &numBlocks);
-    GLenum blockProps[] = { gl::NUM_ACTIVE_VARIABLES, gl::NAME_LENGTH };
-    GLenum blockIndex[] = { gl::ACTIVE_VARIABLES };
-    GLenum props[] = { gl::NAME_LENGTH, gl::TYPE, gl::BLOCK_INDEX };
+void ShaderManager::setUniform(UniformHandle h, const glm::mat4 & m)
+{
+    if (h.isValid()) gl::UniformMatrix4fv(getUniformLocation(h), 1, FALSE, &m[0][0]);
+}
 
-    for (int block = 0; block < numBlocks; ++block)
-    {
-        GLint blockInfo[2];
-        gl::GetProgramResourceiv(handle, gl::UNIFORM_BLOCK, block, 2, blockProps, 2, NULL, blockInfo);
-        GLint numUnis = blockInfo[0];
+void ShaderManager::setUniform(UniformHandle h, const glm::mat3 & m)
+{
+    if (h.isValid()) gl::UniformMatrix3fv(getUniformLocation(h), 1, FALSE, &m[0][0]);
+}
+
+void ShaderManager::setUniform(UniformHandle h, float val)
+{
+    if (h.isValid()) gl::Uniform1f(getUniformLocation(h), val);
+}
+
+void ShaderManager::setUniform(UniformHandle h, int val)
+{
+    if (h.isValid()) gl::Uniform1i(getUniformLocation(h), val);
+}
 
-        char * blockName = new char[blockInfo[1] + 1];
-        gl::GetProgramResourceName(handle, gl::UNIFORM_BLOCK, block, blockInfo[1] + 1, NULL, blockName);
-        printf("Uniform block \"%s\":\n", blockName);
-        delete[] blockName;
+void ShaderManager::setUniform(UniformHandle h, bool val)
+{
+    if (h.isValid()) gl::Uniform1i(getUniformLocation(h), val);
+}
 
-        GLint * unifIndexes = new GLint[numUnis];
-        gl::GetProgramResourceiv(handle, gl::UNIFORM_BLOCK, block, 1, blockIndex, numUnis, NULL, unifIndexes);
+void ShaderManager::setUniform(UniformHandle h, GLuint val)
+{
+    if (h.isValid()) gl::Uniform1ui(getUniformLocation(h), val);
+}
 
-        for (int unif = 0; unif < numUnis; ++unif)
+/**
+    Gets every uniform, block, input and output of the linked program along with their
+    types and buffer layout. Read once after each link, then kept.
+*/
+const ShaderReflection & ShaderManager::getReflection()
+{
+    if (!reflected)
+    {
+        if (linked)
         {
-            GLint uniIndex = unifIndexes[unif];
-            GLint results[3];
-            gl::GetProgramResourceiv(handle, gl::UNIFORM, uniIndex, 3, props, 3, NULL, results);
-
-            GLint nameBufSize = results[0] + 1;
-            char * name = new char[nameBufSize];
-            gl::GetProgramResourceName(handle, gl::UNIFORM, uniIndex, nameBufSize, NULL, name);
-            printf("    %s (%s)\n", name, getTypeString(results[1]));
-            delete[] name;
+            reflection.reflect(handle);
         }
+        else
+        {
+            reflection.clear();
+        }
+        reflected = linked;
+    }
+    return reflection;
+}
 
-        delete[] unifIndexes;
+void ShaderManager::printActiveUniforms() {
+    ShaderResourceList<ShaderVariable> uniforms = getReflection().getUniforms();
+
+    printf("Active uniforms:\n");
+    for (int i = 0; i < uniforms.size(); ++i)
+    {
+        if (uniforms[i].blockIndex != -1) continue;  // Skip uniforms in blocks 
+        printf("%-5d %s (%s)\n", uniforms[i].location, uniforms[i].name, getTypeString(uniforms[i].type));
+    }
+}
+
+void ShaderManager::printActiveUniformBlocks() {
+    const ShaderReflection & info = getReflection();
+    ShaderResourceList<ShaderBlock> blocks = info.getUniformBlocks();
+    ShaderResourceList<ShaderVariable> uniforms = info.getUniforms();
+
+    for (int block = 0; block < blocks.size(); ++block)
+    {
+        printf("Uniform block \"%s\" (binding %d, %d bytes):\n", blocks[block].name, blocks[block].binding, blocks[block].dataSize);
+
+        for (int unif = 0; unif < blocks[block].numMembers; ++unif)
+        {
+            const ShaderVariable & uniform = uniforms[blocks[block].members[unif]];
+            printf("    %-5d %s (%s)\n", uniform.offset, uniform.name, getTypeString(uniform.type));
+        }
     }
 }
 
 void ShaderManager::printActiveAttribs()
 {
-    GLint numAttribs;
-    gl::GetProgramInterfaceiv(handle, gl::PROGRAM_INPUT, gl::ACTIVE_RESOURCES, &numAttribs);
-
-    GLenum properties[] = { gl::NAME_LENGTH, gl::TYPE, gl::LOCATION };
+    ShaderResourceList<ShaderVariable> inputs = getReflection().getInputs();
 
     printf("Active attributes:\n");
-    for (int i = 0; i < numAttribs; ++i) {
-        GLint results[3];
-        gl::GetProgramResourceiv(handle, gl::PROGRAM_INPUT, i, 3, properties, 3, NULL, results);
-
-        GLint nameBufSize = results[0] + 1;
-        char * name = new char[nameBufSize];
-        gl::GetProgramResourceName(handle, gl::PROGRAM_INPUT, i, nameBufSize, NULL, name);
-        printf("%-5d %s (%s)\n", results[2], name, getTypeString(results[1]));
-        delete[] name;
+    for (int i = 0; i < inputs.size(); ++i) {
+        printf("%-5d %s (%s)\n", inputs[i].location, inputs[i].name, getTypeString(inputs[i].type));
     }
 }
 
@@ -446,36 +930,113 @@ void ShaderManager::validate() throw(ShaderProgramException)
 
     if (FALSE == status)
     {
-        // Store log and return false
-        int length = 0;
-        std::string logString;
+        throw ShaderProgramException(std::string("Program failed to validate\n") + getProgramLog());
+    }
+}
+
+void ShaderManager::reflectUniforms()
+{
+    ++uniformGeneration;
+    uniformSlots.clear();
+    uniformNames.clear();
+
+    GLint numUniforms = 0;
+    gl::GetProgramInterfaceiv(handle, gl::UNIFORM, gl::ACTIVE_RESOURCES, &numUniforms);
 
-        gl::GetProgramiv(handle, gl::INFO_LOG_LENGTH, &length);
+    GLenum properties[] = { gl::NAME_LENGTH, gl::TYPE, gl::LOCATION, gl::BLOCK_INDEX, gl::ARRAY_SIZE };
 
-        if (length > 0)
+    for (int i = 0; i < numUniforms; ++i)
+    {
+        GLint results[5];
+        gl::GetProgramResourceiv(handle, gl::UNIFORM, i, 5, properties, 5, NULL, results);
+
+        if (results[3] != -1) continue;  // Block members are set through their buffer
+
+        UniformSlot slot;
+        slot.location = results[2];
+        slot.type = results[1];
+        slot.arraySize = results[4];
+        slot.nameOffset = uniformNames.size();
+
+        uniformNames.resize(slot.nameOffset + results[0] + 1);
+        char * name = &uniformNames[slot.nameOffset];
+        gl::GetProgramResourceName(handle, gl::UNIFORM, i, results[0] + 1, NULL, name);
+
+        // Arrays are reported as "name[0]", store them under their plain name. Members of
+        // struct arrays, e.g. "lights[0].position", keep their full name.
+        size_t length = strlen(name);
+        if (length > 3 && strcmp(name + length - 3, "[0]") == 0)
         {
-            char * c_log = new char[length];
-            int written = 0;
-            gl::GetProgramInfoLog(handle, length, &written, c_log);
-            logString = c_log;
-            delete[] c_log;
+            name[length - 3] = '\0';
         }
 
-        throw ShaderProgramException(std::string("Program failed to validate\n") + logString);
+        slot.hash = ShaderInfo::hashName(name);
+        uniformSlots.push_back(slot);
     }
+
+    // Keep the table at most half full so probe sequences stay short
+    size_t numBuckets = 8;
+    while (numBuckets < uniformSlots.size() * 2)
+    {
+        numBuckets <<= 1;
+    }
+    uniformBuckets.assign(numBuckets, -1);
+
+    for (size_t i = 0; i < uniformSlots.size(); i++)
+    {
+        size_t bucket = uniformSlots[i].hash & (numBuckets - 1);
+        while (uniformBuckets[bucket] != -1)
+        {
+            bucket = (bucket + 1) & (numBuckets - 1);
+        }
+        uniformBuckets[bucket] = (int)i;
+    }
+}
+
+int ShaderManager::findUniformSlot(const char * name) const
+{
+    if (uniformBuckets.empty())
+    {
+        return -1;
+    }
+
+    unsigned hash = ShaderInfo::hashName(name);
+    size_t mask = uniformBuckets.size() - 1;
+    for (size_t bucket = hash & mask; uniformBuckets[bucket] != -1; bucket = (bucket + 1) & mask)
+    {
+        const UniformSlot & slot = uniformSlots[uniformBuckets[bucket]];
+        if (slot.hash == hash && strcmp(&uniformNames[slot.nameOffset], name) == 0)
+        {
+            return uniformBuckets[bucket];
+        }
+    }
+    return -1;
 }
 
 int ShaderManager::getUniformLocation(const char * name)
 {
-    std::map<std::string, int>::iterator pos;
-    pos = uniformLocations.find(name);
+    int slot = findUniformSlot(name);
+    if (slot >= 0)
+    {
+        return uniformSlots[slot].location;
+    }
 
-    if (pos == uniformLocations.end())
+    // Individual array elements and struct members are not in the table
+    if (strchr(name, '[') || strchr(name, '.'))
     {
-        uniformLocations[name] = gl::GetUniformLocation(handle, name);
+        return gl::GetUniformLocation(handle, name);
     }
+    return -1;
+}
 
-    return uniformLocations[name];
+GLint ShaderManager::getUniformLocation(UniformHandle h) const
+{
+    // Handles of an earlier table, or of nothing, set no uniform
+    if (h.generation != uniformGeneration || h.slot < 0 || (size_t)h.slot >= uniformSlots.size())
+    {
+        return -1;
+    }
+    return uniformSlots[h.slot].location;
 }
 
 bool ShaderManager::fileExists(const std::string & fileName)
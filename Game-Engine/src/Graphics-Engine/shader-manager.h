@@ -13,8 +13,14 @@
 
 #include <gl_core_4_3.hpp>
 #include <glm\glm.hpp>
-#include <string>
+#include <Graphics-Engine\shader-reflection.h>
+#include <chrono>
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 #include <fstream>
 #include <sstream>
 #include <iostream>
@@ -38,6 +44,26 @@ enum ShaderType
     COMPUTE = gl::COMPUTE_SHADER
 };
 
+//! Name and value pairs injected as #define lines, an empty value defines the name alone.
+typedef std::vector<std::pair<std::string, std::string>> ShaderDefines;
+
+/**
+    Refers to an active uniform of a linked program by its slot in the reflected
+    uniform table. Look it up once with ShaderManager::uniform and keep it, setting
+    a uniform through a handle does no string work at all. A handle looked up before
+    the program was relinked or reloaded is stale and sets nothing, like location -1.
+*/
+struct UniformHandle
+{
+    UniformHandle() : slot(-1), generation(0) {}
+    UniformHandle(int index, uint32_t tableGeneration) : slot(index), generation(tableGeneration) {}
+
+    bool isValid() const { return slot >= 0; }
+
+    int slot; //! Index into the program's uniform table, -1 if the uniform is not active.
+    uint32_t generation; //! Table the slot indexes, see ShaderManager::uniformGeneration
+};
+
 class ShaderManager
 {
     public:
@@ -48,6 +74,21 @@ class ShaderManager
         void   compileShader(const char * fileName, ShaderType type) throw (ShaderProgramException);
         void   compileShader(const std::string & source, ShaderType type,
             const char *fileName = NULL) throw (ShaderProgramException);
+        void   loadProgram(const std::vector<std::string> & fileNames) throw (ShaderProgramException);
+        void   submitProgram(const std::vector<std::string> & fileNames) throw (ShaderProgramException);
+        bool   isReady();
+        void   finishProgram() throw (ShaderProgramException);
+        void   cancelProgram();
+
+        void   setDefine(const std::string & name, const std::string & value = "");
+        void   setFeatures(const std::vector<std::string> & names);
+        ShaderManager & getVariant(uint32_t features) throw (ShaderProgramException);
+        const std::vector<std::string> & getSourceFiles() const;
+
+        void   submitReload() throw (ShaderProgramException);
+        bool   isReloading() const;
+        bool   isReloadReady();
+        void   finishReload() throw (ShaderProgramException);
 
         void   link() throw (ShaderProgramException);
         void   validate() throw(ShaderProgramException);
@@ -58,6 +99,8 @@ class ShaderManager
 
         void   bindAttribLocation(GLuint location, const char * name);
         void   bindFragDataLocation(GLuint location, const char * name);
+        bool   bindUniformBlock(const char * blockName, GLuint binding);
+        bool   bindStorageBlock(const char * blockName, GLuint binding);
 
         void   setUniform(const char *name, float x, float y, float z);
         void   setUniform(const char *name, const glm::vec2 & v);
@@ -70,6 +113,20 @@ class ShaderManager
         void   setUniform(const char *name, bool val);
         void   setUniform(const char *name, GLuint val);
 
+        UniformHandle uniform(const char *name) const;
+        void   setUniform(UniformHandle h, float x, float y, float z);
+        void   setUniform(UniformHandle h, const glm::vec2 & v);
+        void   setUniform(UniformHandle h, const glm::vec3 & v);
+        void   setUniform(UniformHandle h, const glm::vec4 & v);
+        void   setUniform(UniformHandle h, const glm::mat4 & m);
+        void   setUniform(UniformHandle h, const glm::mat3 & m);
+        void   setUniform(UniformHandle h, float val);
+        void   setUniform(UniformHandle h, int val);
+        void   setUniform(UniformHandle h, bool val);
+        void   setUniform(UniformHandle h, GLuint val);
+
+        const ShaderReflection & getReflection();
+
         void   printActiveUniforms();
         void   printActiveUniformBlocks();
         void   printActiveAttribs();
@@ -77,13 +134,67 @@ class ShaderManager
         const char * getTypeString(GLenum type);
 
     private:
+        //! One active uniform outside of any block, filled in once after linking.
+        struct UniformSlot
+        {
+            GLint    location;
+            GLenum   type;
+            GLint    arraySize;
+            unsigned hash;
+            size_t   nameOffset; //! Start of the name in uniformNames
+        };
+
+        //! Build handed to the driver by submitProgram, checked by finishProgram.
+        struct PendingBuild
+        {
+            PendingBuild() : key(0), fromCache(false), active(false) {}
+
+            std::vector<std::string> fileNames;
+            std::vector<std::string> sources;
+            std::vector<GLenum>      types;
+            std::vector<GLuint>      shaders;
+            uint64_t key; //! ProgramBinaryCache key of the sources
+            bool     fromCache;
+            bool     active;
+            std::chrono::high_resolution_clock::time_point start;
+        };
+
         int  handle;
         bool linked;
-        std::map<std::string, int> uniformLocations;
-
+        PendingBuild pending;
+
+        // Preprocessing and permutations. Variants are built from programFiles with the
+        // names of their feature bits defined, the first time each one is asked for.
+        ShaderDefines defines;
+        std::vector<std::string> featureNames; //! Bit i of a feature mask defines featureNames[i]
+        std::vector<std::string> programFiles; //! Files passed to the last submitProgram
+        std::vector<std::string> sourceFiles; //! Every file read, includes too; GLSL source string numbers
+        std::vector<std::pair<std::string, GLuint>> blockBindings; //! Replayed on variants
+        std::vector<std::pair<std::string, GLuint>> storageBindings;
+        std::map<uint32_t, std::unique_ptr<ShaderManager>> variants;
+        std::unique_ptr<ShaderManager> reloading; //! Replacement being built by submitReload
+
+        ShaderReflection reflection; //! Filled by getReflection the first time after each link
+        bool reflected;
+
+        // Reflected uniforms: slots in program order plus an open-addressed hash
+        // table (power of two size, -1 marks an empty bucket) mapping names to slots.
+        std::vector<UniformSlot> uniformSlots;
+        std::vector<int>         uniformBuckets;
+        std::vector<char>        uniformNames;
+        uint32_t uniformGeneration; //! Changes whenever the table is rebuilt, stale handles find -1
+
+        void   reflectUniforms();
+        int    findUniformSlot(const char * name) const;
         GLint  getUniformLocation(const char * name);
+        GLint  getUniformLocation(UniformHandle h) const;
         bool fileExists(const std::string & fileName);
         std::string getExtension(const char * fileName);
+        ShaderType getShaderType(const char * fileName) throw (ShaderProgramException);
+        std::string readSource(const char * fileName) throw (ShaderProgramException);
+        void submitCompile();
+        std::string getShaderLog(GLuint shaderHandle);
+        std::string getProgramLog();
 
         // Make these private in order to make the object non-copyable
         ShaderManager(const ShaderManager & other) { }
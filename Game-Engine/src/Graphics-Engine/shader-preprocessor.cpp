@@ -0,0 +1,229 @@
+/**
+    @file shader-preprocessor.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\shader-preprocessor.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace PreprocessorInfo
+{
+    /**
+        Matches a directive at the start of a line, ignoring whitespace around the #
+        @param line - source line
+        @param directive - directive name without the #
+        @param rest - set to whatever follows the directive
+        @return true if the line is that directive
+    */
+    bool matchDirective(const std::string & line, const char * directive, std::string & rest)
+    {
+        size_t pos = line.find_first_not_of(" \t");
+        if (pos == std::string::npos || line[pos] != '#')
+        {
+            return false;
+        }
+
+        pos = line.find_first_not_of(" \t", pos + 1);
+        size_t length = strlen(directive);
+        if (pos == std::string::npos || line.compare(pos, length, directive) != 0)
+        {
+            return false;
+        }
+
+        pos += length;
+        if (pos < line.size() && line[pos] != ' ' && line[pos] != '\t')
+        {
+            return false;
+        }
+        rest = line.substr(pos);
+        return true;
+    }
+
+    /**
+        Directory part of a path including the trailing separator, empty if there is none
+    */
+    std::string getDirectory(const std::string & fileName)
+    {
+        size_t loc = fileName.find_last_of("/\\");
+        return loc == std::string::npos ? std::string() : fileName.substr(0, loc + 1);
+    }
+
+    /**
+        Drops "dir/../" and "./" from a path and uses forward slashes throughout, so one
+        file is always known by one name
+    */
+    std::string normalise(std::string path)
+    {
+        std::replace(path.begin(), path.end(), '\\', '/');
+
+        std::vector<std::string> parts;
+        std::string part;
+        std::stringstream stream(path);
+        while (std::getline(stream, part, '/'))
+        {
+            if (part == "." || part.empty())
+            {
+                continue;
+            }
+            if (part == ".." && !parts.empty() && parts.back() != "..")
+            {
+                parts.pop_back();
+                continue;
+            }
+            parts.push_back(part);
+        }
+
+        std::string result = !path.empty() && path[0] == '/' ? "/" : "";
+        for (size_t i = 0; i < parts.size(); i++)
+        {
+            result += (i > 0 ? "/" : "") + parts[i];
+        }
+        return result;
+    }
+}
+
+ShaderPreprocessor::ShaderPreprocessor()
+{
+
+}
+
+/**
+    Preprocesses one shader stage
+    @param fileName - stage's main file
+    @param defines - injected after #version, in order
+    @param files - files read so far for the program, new files are appended
+    @return source for the driver
+*/
+std::string ShaderPreprocessor::process(const std::string & fileName, const ShaderDefines & defines,
+    std::vector<std::string> & files)
+throw(ShaderProgramException)
+{
+    std::string prologue;
+    for (size_t i = 0; i < defines.size(); i++)
+    {
+        prologue += "#define " + defines[i].first;
+        if (!defines[i].second.empty())
+        {
+            prologue += " " + defines[i].second;
+        }
+        prologue += "\n";
+    }
+
+    m_stack.clear();
+    m_included.clear();
+
+    std::string output;
+    processFile(fileName, prologue, files, output);
+    return output;
+}
+
+/**
+    Pastes a file and everything it includes into the output
+    @param prologue - defines, only used for the main file
+*/
+void ShaderPreprocessor::processFile(const std::string & fileName, const std::string & prologue,
+    std::vector<std::string> & files, std::string & output)
+throw(ShaderProgramException)
+{
+    std::string name = PreprocessorInfo::normalise(fileName);
+    if (std::find(m_stack.begin(), m_stack.end(), name) != m_stack.end())
+    {
+        throw ShaderProgramException(std::string("Shader: ") + fileName + " includes itself.");
+    }
+
+    std::ifstream inFile(name.c_str(), std::ios::in);
+    if (!inFile)
+    {
+        std::string message = std::string("Shader: ") + fileName + " not found.";
+        if (!m_stack.empty())
+        {
+            message += " Included from " + m_stack.back() + ".";
+        }
+        throw ShaderProgramException(message);
+    }
+
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(inFile, line))
+    {
+        lines.push_back(line);
+    }
+    inFile.close();
+
+    size_t fileIndex = std::find(files.begin(), files.end(), name) - files.begin();
+    if (fileIndex == files.size())
+    {
+        files.push_back(name);
+    }
+    std::string source = " " + std::to_string(fileIndex) + "\n";
+    m_stack.push_back(name);
+    m_included.push_back(name);
+
+    // Defines go after #version in the main file, or first of all when it has none.
+    // Nothing may come before #version, so it is numbered after that line too.
+    bool bPrologueDone = m_stack.size() > 1;
+    if (!bPrologueDone)
+    {
+        std::string rest;
+        bool bHasVersion = false;
+        for (size_t i = 0; i < lines.size() && !bHasVersion; i++)
+        {
+            bHasVersion = PreprocessorInfo::matchDirective(lines[i], "version", rest);
+        }
+        if (!bHasVersion)
+        {
+            output += prologue;
+            bPrologueDone = true;
+        }
+    }
+    if (bPrologueDone)
+    {
+        output += "#line 1" + source;
+    }
+
+    std::string directory = PreprocessorInfo::getDirectory(name);
+    for (size_t i = 0; i < lines.size(); i++)
+    {
+        std::string rest;
+        std::string next = std::to_string(i + 2); // Line number of the following line
+
+        if (!bPrologueDone && PreprocessorInfo::matchDirective(lines[i], "version", rest))
+        {
+            output += lines[i] + "\n" + prologue + "#line " + next + source;
+            bPrologueDone = true;
+        }
+        else if (PreprocessorInfo::matchDirective(lines[i], "include", rest))
+        {
+            size_t open = rest.find_first_of("\"<");
+            size_t close = open == std::string::npos ? std::string::npos :
+                rest.find(rest[open] == '"' ? '"' : '>', open + 1);
+            if (close == std::string::npos)
+            {
+                throw ShaderProgramException(name + "(" + std::to_string(i + 1) + "): malformed #include");
+            }
+
+            std::string includeName = directory + rest.substr(open + 1, close - open - 1);
+            if (std::find(m_included.begin(), m_included.end(),
+                PreprocessorInfo::normalise(includeName)) == m_included.end())
+            {
+                processFile(includeName, std::string(), files, output);
+            }
+            output += "#line " + next + source;
+        }
+        else if (PreprocessorInfo::matchDirective(lines[i], "pragma", rest) &&
+            rest.find("once") != std::string::npos)
+        {
+            // Every file is pasted once anyway, keep the line count
+            output += "\n";
+        }
+        else
+        {
+            output += lines[i] + "\n";
+        }
+    }
+
+    m_stack.pop_back();
+}
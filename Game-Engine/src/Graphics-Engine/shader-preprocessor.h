@@ -0,0 +1,44 @@
+/**
+    @headerfile shader-preprocessor.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _SHADER_PREPROCESSOR_H
+#define _SHADER_PREPROCESSOR_H
+
+#include <string>
+#include <vector>
+#include <Graphics-Engine\shader-manager.h>
+
+/**
+    Turns a shader file into the single source handed to the driver. #include "file"
+    pastes another file in, resolved relative to the including file, and every file is
+    pasted at most once per source so shared headers need no guards. Defines are placed
+    right after #version, where GLSL allows them.
+
+    #line directives keep compile errors pointing at the right line. The source string
+    number they give is the file's index in the list passed to process, which is shared
+    between the stages of a program so one list explains every error.
+*/
+class ShaderPreprocessor
+{
+    public:
+        ShaderPreprocessor();
+
+        std::string process(const std::string & fileName, const ShaderDefines & defines,
+            std::vector<std::string> & files) throw (ShaderProgramException);
+
+    private:
+        std::vector<std::string> m_stack; //! Files being pasted, innermost last
+        std::vector<std::string> m_included; //! Files already pasted into the current source
+
+        void processFile(const std::string & fileName, const std::string & prologue,
+            std::vector<std::string> & files, std::string & output) throw (ShaderProgramException);
+
+        ShaderPreprocessor(const ShaderPreprocessor &);
+        ShaderPreprocessor & operator=(const ShaderPreprocessor &);
+};
+
+#endif // !_SHADER_PREPROCESSOR_H
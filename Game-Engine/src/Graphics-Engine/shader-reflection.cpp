@@ -0,0 +1,255 @@
+/**
+    @file shader-reflection.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\shader-reflection.h>
+#include <cstring>
+
+namespace ReflectionInfo
+{
+    //! Properties a ShaderVariable is filled from, in query order.
+    enum Field
+    {
+        FIELD_NAME_LENGTH,
+        FIELD_TYPE,
+        FIELD_LOCATION,
+        FIELD_ARRAY_SIZE,
+        FIELD_OFFSET,
+        FIELD_ARRAY_STRIDE,
+        FIELD_MATRIX_STRIDE,
+        FIELD_BLOCK_INDEX,
+        NUM_FIELDS
+    };
+
+    const GLenum FIELD_PROPERTIES[NUM_FIELDS] =
+    {
+        gl::NAME_LENGTH, gl::TYPE, gl::LOCATION, gl::ARRAY_SIZE,
+        gl::OFFSET, gl::ARRAY_STRIDE, gl::MATRIX_STRIDE, gl::BLOCK_INDEX
+    };
+
+    /**
+        Gets which fields an interface has, querying any other is an error
+        @return one bit per Field
+    */
+    unsigned getFields(GLenum resourceInterface)
+    {
+        const unsigned all = (1u << NUM_FIELDS) - 1;
+        switch (resourceInterface)
+        {
+        case gl::UNIFORM:
+            return all;
+        case gl::BUFFER_VARIABLE:
+            return all & ~(1u << FIELD_LOCATION);
+        default: // Program inputs and outputs
+            return (1u << FIELD_NAME_LENGTH) | (1u << FIELD_TYPE) | (1u << FIELD_LOCATION) | (1u << FIELD_ARRAY_SIZE);
+        }
+    }
+
+    /**
+        Rounds a byte count up to whole arena units
+    */
+    inline size_t toUnits(size_t bytes)
+    {
+        return (bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    }
+
+    template <typename T>
+    const T * find(const ShaderResourceList<T> & list, const char * name)
+    {
+        for (int i = 0; i < list.count; i++)
+        {
+            if (strcmp(list.items[i].name, name) == 0)
+            {
+                return &list.items[i];
+            }
+        }
+        return NULL;
+    }
+}
+
+ShaderReflection::ShaderReflection() : m_used(0)
+{
+    clear();
+}
+
+/**
+    Reads every active resource of a linked program, replacing what was reflected before
+    @param program - linked program
+*/
+void ShaderReflection::reflect(GLuint program)
+{
+    clear();
+
+    // Size the arena from the counts and longest names first, so it is allocated once
+    const GLenum variableInterfaces[] = { gl::UNIFORM, gl::BUFFER_VARIABLE, gl::PROGRAM_INPUT, gl::PROGRAM_OUTPUT };
+    const GLenum blockInterfaces[] = { gl::UNIFORM_BLOCK, gl::SHADER_STORAGE_BLOCK };
+
+    size_t units = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        GLint count = 0, maxName = 0;
+        gl::GetProgramInterfaceiv(program, variableInterfaces[i], gl::ACTIVE_RESOURCES, &count);
+        gl::GetProgramInterfaceiv(program, variableInterfaces[i], gl::MAX_NAME_LENGTH, &maxName);
+        units += count * (ReflectionInfo::toUnits(sizeof(ShaderVariable)) + ReflectionInfo::toUnits(maxName + 1));
+
+        // A variable is in at most one block, so the member lists cannot hold more than this
+        units += ReflectionInfo::toUnits(count * sizeof(uint32_t));
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        GLint count = 0, maxName = 0;
+        gl::GetProgramInterfaceiv(program, blockInterfaces[i], gl::ACTIVE_RESOURCES, &count);
+        gl::GetProgramInterfaceiv(program, blockInterfaces[i], gl::MAX_NAME_LENGTH, &maxName);
+        units += count * (ReflectionInfo::toUnits(sizeof(ShaderBlock)) + ReflectionInfo::toUnits(maxName + 1) + 1);
+    }
+
+    if (m_arena.size() < units)
+    {
+        m_arena.resize(units);
+    }
+
+    m_uniforms = reflectVariables(program, gl::UNIFORM);
+    m_bufferVariables = reflectVariables(program, gl::BUFFER_VARIABLE);
+    m_inputs = reflectVariables(program, gl::PROGRAM_INPUT);
+    m_outputs = reflectVariables(program, gl::PROGRAM_OUTPUT);
+    m_uniformBlocks = reflectBlocks(program, gl::UNIFORM_BLOCK);
+    m_storageBlocks = reflectBlocks(program, gl::SHADER_STORAGE_BLOCK);
+}
+
+/**
+    Forgets the reflected program, the arena is kept for the next one
+*/
+void ShaderReflection::clear()
+{
+    m_used = 0;
+    m_uniforms.items = NULL;
+    m_uniforms.count = 0;
+    m_bufferVariables = m_inputs = m_outputs = m_uniforms;
+    m_uniformBlocks.items = NULL;
+    m_uniformBlocks.count = 0;
+    m_storageBlocks = m_uniformBlocks;
+}
+
+const ShaderVariable * ShaderReflection::findUniform(const char * name) const
+{
+    return ReflectionInfo::find(m_uniforms, name);
+}
+
+const ShaderBlock * ShaderReflection::findUniformBlock(const char * name) const
+{
+    return ReflectionInfo::find(m_uniformBlocks, name);
+}
+
+const ShaderBlock * ShaderReflection::findStorageBlock(const char * name) const
+{
+    return ReflectionInfo::find(m_storageBlocks, name);
+}
+
+/**
+    Takes memory from the arena, which reflect() sized for everything it stores
+*/
+void * ShaderReflection::allocate(size_t size)
+{
+    void * memory = m_arena.data() + m_used;
+    m_used += ReflectionInfo::toUnits(size);
+    return memory;
+}
+
+/**
+    Reads a resource's name straight into the arena
+*/
+const char * ShaderReflection::copyName(GLuint program, GLenum resourceInterface, GLuint index, GLint length)
+{
+    char * name = (char *)allocate(length + 1);
+    gl::GetProgramResourceName(program, resourceInterface, index, length + 1, NULL, name);
+    name[length] = '\0';
+    return name;
+}
+
+ShaderResourceList<ShaderVariable> ShaderReflection::reflectVariables(GLuint program, GLenum resourceInterface)
+{
+    ShaderResourceList<ShaderVariable> list = { NULL, 0 };
+    gl::GetProgramInterfaceiv(program, resourceInterface, gl::ACTIVE_RESOURCES, &list.count);
+    if (list.count <= 0)
+    {
+        list.count = 0;
+        return list;
+    }
+
+    // Only ask for the properties this interface has, the rest keep their defaults
+    unsigned fields = ReflectionInfo::getFields(resourceInterface);
+    GLenum properties[ReflectionInfo::NUM_FIELDS];
+    int fieldOf[ReflectionInfo::NUM_FIELDS];
+    int numProperties = 0;
+    for (int field = 0; field < ReflectionInfo::NUM_FIELDS; field++)
+    {
+        if (fields & (1u << field))
+        {
+            fieldOf[numProperties] = field;
+            properties[numProperties++] = ReflectionInfo::FIELD_PROPERTIES[field];
+        }
+    }
+
+    ShaderVariable * variables = (ShaderVariable *)allocate(list.count * sizeof(ShaderVariable));
+    for (int i = 0; i < list.count; i++)
+    {
+        GLint results[ReflectionInfo::NUM_FIELDS];
+        gl::GetProgramResourceiv(program, resourceInterface, i, numProperties, properties, numProperties, NULL, results);
+
+        GLint values[ReflectionInfo::NUM_FIELDS] = { 0, 0, -1, 1, -1, -1, -1, -1 };
+        for (int p = 0; p < numProperties; p++)
+        {
+            values[fieldOf[p]] = results[p];
+        }
+
+        ShaderVariable & variable = variables[i];
+        variable.name = copyName(program, resourceInterface, i, values[ReflectionInfo::FIELD_NAME_LENGTH]);
+        variable.type = (GLenum)values[ReflectionInfo::FIELD_TYPE];
+        variable.location = values[ReflectionInfo::FIELD_LOCATION];
+        variable.arraySize = values[ReflectionInfo::FIELD_ARRAY_SIZE];
+        variable.offset = values[ReflectionInfo::FIELD_OFFSET];
+        variable.arrayStride = values[ReflectionInfo::FIELD_ARRAY_STRIDE];
+        variable.matrixStride = values[ReflectionInfo::FIELD_MATRIX_STRIDE];
+        variable.blockIndex = values[ReflectionInfo::FIELD_BLOCK_INDEX];
+    }
+    list.items = variables;
+    return list;
+}
+
+ShaderResourceList<ShaderBlock> ShaderReflection::reflectBlocks(GLuint program, GLenum resourceInterface)
+{
+    ShaderResourceList<ShaderBlock> list = { NULL, 0 };
+    gl::GetProgramInterfaceiv(program, resourceInterface, gl::ACTIVE_RESOURCES, &list.count);
+    if (list.count <= 0)
+    {
+        list.count = 0;
+        return list;
+    }
+
+    const GLenum properties[] = { gl::NAME_LENGTH, gl::BUFFER_BINDING, gl::BUFFER_DATA_SIZE, gl::NUM_ACTIVE_VARIABLES };
+    const GLenum memberProperty = gl::ACTIVE_VARIABLES;
+
+    ShaderBlock * blocks = (ShaderBlock *)allocate(list.count * sizeof(ShaderBlock));
+    for (int i = 0; i < list.count; i++)
+    {
+        GLint results[4];
+        gl::GetProgramResourceiv(program, resourceInterface, i, 4, properties, 4, NULL, results);
+
+        ShaderBlock & block = blocks[i];
+        block.name = copyName(program, resourceInterface, i, results[0]);
+        block.binding = results[1];
+        block.dataSize = results[2];
+        block.numMembers = results[3];
+
+        // Member indices are written as GLints, which have the same size
+        uint32_t * members = (uint32_t *)allocate(block.numMembers * sizeof(uint32_t));
+        if (block.numMembers > 0)
+        {
+            gl::GetProgramResourceiv(program, resourceInterface, i, 1, &memberProperty, block.numMembers, NULL, (GLint *)members);
+        }
+        block.members = members;
+    }
+    list.items = blocks;
+    return list;
+}
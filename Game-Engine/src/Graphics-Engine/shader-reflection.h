@@ -0,0 +1,96 @@
+/**
+    @headerfile shader-reflection.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _SHADER_REFLECTION_H
+#define _SHADER_REFLECTION_H
+
+#include <cstdint>
+#include <vector>
+#include <gl_core_4_3.hpp>
+
+//! One active uniform, buffer variable, vertex input or fragment output.
+struct ShaderVariable
+{
+    const char * name;
+    GLenum type;
+    GLint location; //! -1 for block members and buffer variables
+    GLint arraySize; //! 1 for non arrays
+    GLint offset; //! Byte offset in its block, -1 outside of blocks
+    GLint arrayStride; //! Bytes between array elements in a block, 0 for non arrays, -1 outside of blocks
+    GLint matrixStride; //! Bytes between matrix columns in a block, 0 for non matrices, -1 outside of blocks
+    GLint blockIndex; //! Index of its block, -1 if it has none
+};
+
+//! One active uniform or shader storage block.
+struct ShaderBlock
+{
+    const char * name;
+    GLint binding; //! Binding point the block reads from
+    GLint dataSize; //! Bytes the buffer behind it must hold
+    const uint32_t * members; //! Indices of its variables in the matching variable list
+    int numMembers;
+};
+
+//! View of one kind of reflected resource, valid while the reflection is unchanged.
+template <typename T>
+struct ShaderResourceList
+{
+    const T * items;
+    int count;
+
+    int size() const { return count; }
+    const T & operator[](int i) const { return items[i]; }
+    const T * begin() const { return items; }
+    const T * end() const { return items + count; }
+};
+
+/**
+    Everything a linked program exposes, for laying out uniform buffers and matching
+    materials to programs. The resources are read in one pass and kept in one arena
+    sized up front; names and member lists point into it, so nothing else is allocated
+    and reflecting again with the same or a smaller program allocates nothing at all.
+*/
+class ShaderReflection
+{
+    public:
+        ShaderReflection();
+
+        void reflect(GLuint program);
+        void clear();
+
+        ShaderResourceList<ShaderVariable> getUniforms() const { return m_uniforms; }
+        ShaderResourceList<ShaderVariable> getBufferVariables() const { return m_bufferVariables; }
+        ShaderResourceList<ShaderVariable> getInputs() const { return m_inputs; }
+        ShaderResourceList<ShaderVariable> getOutputs() const { return m_outputs; }
+        ShaderResourceList<ShaderBlock> getUniformBlocks() const { return m_uniformBlocks; }
+        ShaderResourceList<ShaderBlock> getStorageBlocks() const { return m_storageBlocks; }
+
+        const ShaderVariable * findUniform(const char * name) const;
+        const ShaderBlock * findUniformBlock(const char * name) const;
+        const ShaderBlock * findStorageBlock(const char * name) const;
+
+    private:
+        std::vector<uint64_t> m_arena; //! 8 byte units so every record is aligned
+        size_t m_used;
+
+        ShaderResourceList<ShaderVariable> m_uniforms;
+        ShaderResourceList<ShaderVariable> m_bufferVariables;
+        ShaderResourceList<ShaderVariable> m_inputs;
+        ShaderResourceList<ShaderVariable> m_outputs;
+        ShaderResourceList<ShaderBlock> m_uniformBlocks;
+        ShaderResourceList<ShaderBlock> m_storageBlocks;
+
+        ShaderReflection(const ShaderReflection &);
+        ShaderReflection & operator=(const ShaderReflection &);
+
+        void * allocate(size_t size);
+        const char * copyName(GLuint program, GLenum resourceInterface, GLuint index, GLint length);
+        ShaderResourceList<ShaderVariable> reflectVariables(GLuint program, GLenum resourceInterface);
+        ShaderResourceList<ShaderBlock> reflectBlocks(GLuint program, GLenum resourceInterface);
+};
+
+#endif // !_SHADER_REFLECTION_H
@@ -0,0 +1,290 @@
+/**
+    @file shader-watcher.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\shader-watcher.h>
+#include <algorithm>
+#include <iostream>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace WatcherInfo
+{
+    const int POLL_MILLISECONDS = 250; //! Modified time check interval without inotify
+
+    /**
+        Gets a file's modified time, -1 if it cannot be read
+    */
+    long long getModifiedTime(const std::string & fileName)
+    {
+        struct stat info;
+        if (stat(fileName.c_str(), &info) != 0)
+        {
+            return -1;
+        }
+        return (long long)info.st_mtime;
+    }
+
+    /**
+        Directory part of a path without the trailing slash, "." if there is none
+    */
+    std::string getDirectory(const std::string & fileName)
+    {
+        size_t loc = fileName.find_last_of('/');
+        return loc == std::string::npos ? std::string(".") : fileName.substr(0, loc);
+    }
+}
+
+ShaderWatcher * ShaderWatcher::s_instance = NULL;
+
+/**
+    Creates the watcher and its inotify instance, files are added with watch()
+*/
+ShaderWatcher::ShaderWatcher() : m_inotify(-1), m_lastPoll(Clock::now())
+{
+#ifdef __linux__
+    m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+    s_instance = this;
+}
+
+ShaderWatcher::~ShaderWatcher()
+{
+#ifdef __linux__
+    if (m_inotify >= 0)
+    {
+        for (std::map<int, std::string>::iterator dir = m_directories.begin(); dir != m_directories.end(); ++dir)
+        {
+            inotify_rm_watch(m_inotify, dir->first);
+        }
+        close(m_inotify);
+    }
+#endif
+    if (s_instance == this)
+    {
+        s_instance = NULL;
+    }
+}
+
+ShaderWatcher * ShaderWatcher::get()
+{
+    return s_instance;
+}
+
+/**
+    Starts reloading a program when its files change
+    @param program - program built with loadProgram, must stay alive until unwatched
+    @param onReload - called after each successful reload, may be empty
+*/
+void ShaderWatcher::watch(ShaderManager & program, const ReloadCallback & onReload)
+{
+    WatchedProgram watched = { &program, onReload, false, Clock::time_point(), Clock::time_point() };
+    m_programs.push_back(watched);
+    refreshFiles();
+}
+
+void ShaderWatcher::unwatch(ShaderManager & program)
+{
+    for (size_t i = 0; i < m_programs.size(); i++)
+    {
+        if (m_programs[i].program == &program)
+        {
+            m_programs.erase(m_programs.begin() + i);
+            refreshFiles();
+            return;
+        }
+    }
+}
+
+/**
+    Picks up changed files, swaps in programs the driver finished and submits changed
+    ones. Call on the GL thread between frames.
+*/
+void ShaderWatcher::update()
+{
+    std::vector<std::string> changed;
+    collectChanges(changed);
+
+    Clock::time_point now = Clock::now();
+    for (size_t i = 0; i < changed.size(); i++)
+    {
+        for (size_t j = 0; j < m_programs.size(); j++)
+        {
+            const std::vector<std::string> & files = m_programs[j].program->getSourceFiles();
+            if (std::find(files.begin(), files.end(), changed[i]) == files.end())
+            {
+                continue;
+            }
+            // A change during a reload starts the clock of the next one
+            if (!m_programs[j].bDirty)
+            {
+                m_programs[j].changed = now;
+            }
+            m_programs[j].bDirty = true;
+        }
+    }
+
+    bool bFilesChanged = false;
+    for (size_t i = 0; i < m_programs.size(); i++)
+    {
+        WatchedProgram & watched = m_programs[i];
+        ShaderManager & program = *watched.program;
+        std::string name = program.getSourceFiles().empty() ? std::string() : program.getSourceFiles()[0];
+
+        if (program.isReloading() && program.isReloadReady())
+        {
+            try
+            {
+                program.finishReload();
+                double fMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - watched.reloadChanged).count();
+                std::cout << "Shader reload: " << name << " swapped in " << fMilliseconds << " ms after the change" << std::endl;
+                if (watched.onReload)
+                {
+                    watched.onReload(program);
+                }
+                bFilesChanged = true;
+            }
+            catch (ShaderProgramException & e)
+            {
+                std::cerr << "Shader reload: " << name << " failed, keeping the previous program\n" << e.what() << std::endl;
+            }
+        }
+
+        if (watched.bDirty && !program.isReloading())
+        {
+            watched.bDirty = false;
+            watched.reloadChanged = watched.changed;
+            try
+            {
+                program.submitReload();
+            }
+            catch (ShaderProgramException & e)
+            {
+                std::cerr << "Shader reload: " << name << " failed, keeping the previous program\n" << e.what() << std::endl;
+            }
+        }
+    }
+
+    // A reload may have added or dropped includes
+    if (bFilesChanged)
+    {
+        refreshFiles();
+    }
+}
+
+/**
+    Rebuilds the set of watched files from the programs' current sources
+*/
+void ShaderWatcher::refreshFiles()
+{
+    std::map<std::string, long long> modified;
+    for (size_t i = 0; i < m_programs.size(); i++)
+    {
+        const std::vector<std::string> & files = m_programs[i].program->getSourceFiles();
+        for (size_t j = 0; j < files.size(); j++)
+        {
+            std::map<std::string, long long>::iterator known = m_modified.find(files[j]);
+            modified[files[j]] = known != m_modified.end() ? known->second : WatcherInfo::getModifiedTime(files[j]);
+        }
+    }
+    m_modified.swap(modified);
+
+#ifdef __linux__
+    if (m_inotify < 0)
+    {
+        return;
+    }
+
+    // Directories are watched rather than files, editors often save by replacing the file
+    std::vector<std::string> directories;
+    for (std::map<std::string, long long>::iterator it = m_modified.begin(); it != m_modified.end(); ++it)
+    {
+        std::string directory = WatcherInfo::getDirectory(it->first);
+        if (std::find(directories.begin(), directories.end(), directory) == directories.end())
+        {
+            directories.push_back(directory);
+        }
+    }
+
+    // Stop watching directories no program uses any more
+    for (std::map<int, std::string>::iterator dir = m_directories.begin(); dir != m_directories.end();)
+    {
+        std::vector<std::string>::iterator used = std::find(directories.begin(), directories.end(), dir->second);
+        if (used != directories.end())
+        {
+            directories.erase(used);
+            ++dir;
+        }
+        else
+        {
+            inotify_rm_watch(m_inotify, dir->first);
+            dir = m_directories.erase(dir);
+        }
+    }
+
+    // What is left is not watched yet
+    for (size_t i = 0; i < directories.size(); i++)
+    {
+        int descriptor = inotify_add_watch(m_inotify, directories[i].c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        if (descriptor >= 0)
+        {
+            m_directories[descriptor] = directories[i];
+        }
+    }
+#endif
+}
+
+/**
+    Gets the watched files that changed since the last call
+*/
+void ShaderWatcher::collectChanges(std::vector<std::string> & changed)
+{
+#ifdef __linux__
+    if (m_inotify >= 0)
+    {
+        alignas(struct inotify_event) char buffer[4096];
+        ssize_t length;
+        while ((length = read(m_inotify, buffer, sizeof(buffer))) > 0)
+        {
+            for (char * pos = buffer; pos < buffer + length; pos += sizeof(struct inotify_event) + ((struct inotify_event *)pos)->len)
+            {
+                const struct inotify_event * event = (const struct inotify_event *)pos;
+                std::map<int, std::string>::iterator dir = m_directories.find(event->wd);
+                if (dir == m_directories.end() || event->len == 0)
+                {
+                    continue;
+                }
+
+                std::string fileName = dir->second == "." ? std::string(event->name) : dir->second + "/" + event->name;
+                if (m_modified.count(fileName) && std::find(changed.begin(), changed.end(), fileName) == changed.end())
+                {
+                    changed.push_back(fileName);
+                }
+            }
+        }
+        return;
+    }
+#endif
+
+    Clock::time_point now = Clock::now();
+    if (std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastPoll).count() < WatcherInfo::POLL_MILLISECONDS)
+    {
+        return;
+    }
+    m_lastPoll = now;
+
+    for (std::map<std::string, long long>::iterator it = m_modified.begin(); it != m_modified.end(); ++it)
+    {
+        long long modified = WatcherInfo::getModifiedTime(it->first);
+        if (modified != it->second)
+        {
+            it->second = modified;
+            changed.push_back(it->first);
+        }
+    }
+}
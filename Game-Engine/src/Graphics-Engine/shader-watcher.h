@@ -0,0 +1,70 @@
+/**
+    @headerfile shader-watcher.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _SHADER_WATCHER_H
+#define _SHADER_WATCHER_H
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include <Graphics-Engine\shader-manager.h>
+
+/**
+    Reloads shader programs while the engine runs whenever one of their files, includes
+    too, is saved. Linux is told about changes by inotify; elsewhere the files' modified
+    times are polled a few times a second.
+
+    All GL work happens in update(), called once per frame at the frame boundary. A
+    changed program is resubmitted there and swapped in on a later update once the
+    driver is done, so with parallel shader compile the frame never waits for it. A
+    program that fails to build is left as it was and the errors are printed.
+*/
+class ShaderWatcher
+{
+    public:
+        //! Called after a program was swapped, uniform handles need looking up again.
+        typedef std::function<void(ShaderManager &)> ReloadCallback;
+
+        ShaderWatcher();
+        ~ShaderWatcher();
+
+        static ShaderWatcher * get();
+
+        void watch(ShaderManager & program, const ReloadCallback & onReload = ReloadCallback());
+        void unwatch(ShaderManager & program);
+        void update();
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        struct WatchedProgram
+        {
+            ShaderManager * program;
+            ReloadCallback onReload;
+            bool bDirty; //! Changed since the last submit
+            Clock::time_point changed; //! First change not yet submitted
+            Clock::time_point reloadChanged; //! First change the reload being built covers
+        };
+
+        static ShaderWatcher * s_instance;
+
+        std::vector<WatchedProgram> m_programs;
+        std::map<std::string, long long> m_modified; //! Watched files and their modified times
+        int m_inotify; //! inotify descriptor, -1 when polling
+        std::map<int, std::string> m_directories; //! inotify watch descriptor to directory
+        Clock::time_point m_lastPoll;
+
+        ShaderWatcher(const ShaderWatcher &);
+        ShaderWatcher & operator=(const ShaderWatcher &);
+
+        void refreshFiles();
+        void collectChanges(std::vector<std::string> & changed);
+};
+
+#endif // !_SHADER_WATCHER_H
@@ -0,0 +1,271 @@
+/**
+    @file stream-buffer.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\stream-buffer.h>
+#include <Graphics-Engine\gl-state-cache.h>
+
+StreamBuffer::StreamBuffer() :
+    m_handle(0), m_target(gl::ARRAY_BUFFER), m_size(0), m_frameSize(0), m_mapped(NULL), m_persistent(false),
+    m_head(0), m_rangeBegin(0), m_flushedUpTo(0), m_frameBytes(0), m_frameSpan(0), m_stalls(0)
+{
+
+}
+
+StreamBuffer::~StreamBuffer()
+{
+    destroy();
+}
+
+/**
+    Creates the storage and maps it for the lifetime of the buffer
+    @param target - buffer target used for binding, e.g. gl::UNIFORM_BUFFER
+    @param frameSize - bytes a single frame may use
+    @param framesInFlight - frames the GPU may lag behind, three by default
+*/
+void StreamBuffer::create(GLenum target, GLsizeiptr frameSize, int framesInFlight)
+{
+    destroy();
+
+    m_target = target;
+    m_size = frameSize * framesInFlight;
+    m_frameSize = frameSize;
+    m_persistent = gl::sys::IsExtensionSupported("GL_ARB_buffer_storage") && gl::BufferStorage;
+
+    gl::GenBuffers(1, &m_handle);
+    GLStateCache::get()->bindBuffer(m_target, m_handle);
+
+    if (m_persistent)
+    {
+        GLbitfield flags = gl::MAP_WRITE_BIT | gl::MAP_PERSISTENT_BIT | gl::MAP_COHERENT_BIT;
+        gl::BufferStorage(m_target, m_size, NULL, flags);
+        m_mapped = (char *)gl::MapBufferRange(m_target, 0, m_size, flags);
+        m_persistent = m_mapped != NULL;
+    }
+
+    if (!m_persistent)
+    {
+        gl::BufferData(m_target, m_size, NULL, gl::STREAM_DRAW);
+        m_shadow.assign((size_t)m_size, 0);
+        m_mapped = &m_shadow[0];
+    }
+}
+
+/**
+    Waits for the GPU to finish with the buffer and deletes it
+*/
+void StreamBuffer::destroy()
+{
+    if (m_handle == 0)
+    {
+        return;
+    }
+
+    // Retires every range, each shared fence is waited on and deleted once
+    waitForRange(0, m_size);
+    m_fences.clear();
+    m_pendingRanges.clear();
+
+    GLStateCache * state = GLStateCache::get();
+    if (m_persistent)
+    {
+        state->bindBuffer(m_target, m_handle);
+        gl::UnmapBuffer(m_target);
+    }
+    state->releaseBuffer(m_handle);
+    gl::DeleteBuffers(1, &m_handle);
+
+    m_handle = 0;
+    m_mapped = NULL;
+    m_shadow.clear();
+    m_head = m_rangeBegin = m_flushedUpTo = 0;
+    m_frameBytes = m_frameSpan = 0;
+}
+
+/**
+    Hands out space for this frame's data
+    @param size - bytes
+    @param alignment - required offset alignment, a power of two
+    @return an invalid allocation if the frame has used up its share of the ring
+*/
+StreamAllocation StreamBuffer::allocate(GLsizeiptr size, GLsizeiptr alignment)
+{
+    StreamAllocation allocation;
+
+    GLintptr offset = (m_head + alignment - 1) & ~(GLintptr)(alignment - 1);
+    GLsizeiptr needed = (offset - m_head) + size;
+    GLsizeiptr span = needed;
+    bool bWrap = offset + size > m_size;
+    if (bWrap)
+    {
+        // The skipped tail holds nothing, but this frame cannot reuse it either
+        offset = 0;
+        needed = size;
+        span = (m_size - m_head) + size;
+    }
+
+    // Stay within the frame's share, and never overwrite what this frame has already written
+    if (m_frameBytes + needed > m_frameSize || m_frameSpan + span > m_size)
+    {
+        return allocation;
+    }
+
+    if (bWrap)
+    {
+        if (m_head > m_rangeBegin)
+        {
+            FencedRange range = { 0, m_rangeBegin, m_head };
+            m_pendingRanges.push_back(range);
+        }
+        if (!m_persistent)
+        {
+            uploadShadow(m_flushedUpTo, m_head);
+            m_flushedUpTo = 0;
+        }
+        m_rangeBegin = 0;
+    }
+
+    waitForRange(offset, offset + size);
+
+    m_head = offset + size;
+    m_frameBytes += needed;
+    m_frameSpan += span;
+
+    allocation.pointer = m_mapped + offset;
+    allocation.offset = offset;
+    allocation.size = size;
+    return allocation;
+}
+
+/**
+    Makes everything allocated so far visible to the GPU. Only the fallback path has
+    work to do here; call it before issuing draws that read this frame's data.
+*/
+void StreamBuffer::flush()
+{
+    if (!m_persistent && m_head > m_flushedUpTo)
+    {
+        uploadShadow(m_flushedUpTo, m_head);
+        m_flushedUpTo = m_head;
+    }
+}
+
+/**
+    Fences the ranges written this frame so they are not reused while the GPU reads them
+*/
+void StreamBuffer::endFrame()
+{
+    flush();
+
+    if (m_head > m_rangeBegin)
+    {
+        FencedRange range = { 0, m_rangeBegin, m_head };
+        m_pendingRanges.push_back(range);
+    }
+
+    if (!m_pendingRanges.empty() && m_persistent)
+    {
+        // One fence covers all of this frame's ranges, the first one to be waited on deletes it
+        GLsync fence = gl::FenceSync(gl::SYNC_GPU_COMMANDS_COMPLETE, 0);
+        for (size_t i = 0; i < m_pendingRanges.size(); i++)
+        {
+            m_pendingRanges[i].fence = fence;
+            m_fences.push_back(m_pendingRanges[i]);
+        }
+    }
+
+    m_pendingRanges.clear();
+    m_rangeBegin = m_head;
+    m_frameBytes = m_frameSpan = 0;
+}
+
+void StreamBuffer::waitForRange(GLintptr begin, GLintptr end)
+{
+    // A lap that wrapped early leaves the older lap's tail ranges ahead of younger ones, so
+    // every range is checked. Fences signal in order, so waiting on the youngest overlapping
+    // one also covers every range fenced before it.
+    size_t retire = 0;
+    for (size_t i = 0; i < m_fences.size(); i++)
+    {
+        if (m_fences[i].end > begin && m_fences[i].begin < end)
+        {
+            retire = i + 1;
+        }
+    }
+    if (retire == 0)
+    {
+        return;
+    }
+
+    GLsync youngest = 0;
+    for (size_t i = retire; i-- > 0 && !youngest;)
+    {
+        youngest = m_fences[i].fence;
+    }
+    if (youngest)
+    {
+        GLenum result = gl::ClientWaitSync(youngest, 0, 0);
+        if (result != gl::ALREADY_SIGNALED && result != gl::CONDITION_SATISFIED)
+        {
+            ++m_stalls;
+            gl::ClientWaitSync(youngest, gl::SYNC_FLUSH_COMMANDS_BIT, gl::TIMEOUT_IGNORED);
+        }
+    }
+
+    // Ranges of one frame share a fence, it is deleted once and cleared wherever it is left
+    for (size_t i = 0; i < retire; i++)
+    {
+        GLsync fence = m_fences[i].fence;
+        if (!fence)
+        {
+            continue;
+        }
+        gl::DeleteSync(fence);
+        for (size_t j = i; j < m_fences.size(); j++)
+        {
+            if (m_fences[j].fence == fence)
+            {
+                m_fences[j].fence = 0;
+            }
+        }
+    }
+    m_fences.erase(m_fences.begin(), m_fences.begin() + retire);
+}
+
+void StreamBuffer::uploadShadow(GLintptr begin, GLintptr end)
+{
+    if (end > begin)
+    {
+        GLStateCache::get()->bindBuffer(m_target, m_handle);
+        gl::BufferSubData(m_target, begin, end - begin, &m_shadow[begin]);
+    }
+}
+
+GLuint StreamBuffer::getHandle() const
+{
+    return m_handle;
+}
+
+GLenum StreamBuffer::getTarget() const
+{
+    return m_target;
+}
+
+GLsizeiptr StreamBuffer::getSize() const
+{
+    return m_size;
+}
+
+bool StreamBuffer::isPersistent() const
+{
+    return m_persistent;
+}
+
+/**
+    Gets how often allocate had to wait for the GPU, ideally zero
+*/
+int StreamBuffer::getStallCount() const
+{
+    return m_stalls;
+}
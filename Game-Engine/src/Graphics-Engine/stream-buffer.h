@@ -0,0 +1,88 @@
+/**
+    @headerfile stream-buffer.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _STREAM_BUFFER_H
+#define _STREAM_BUFFER_H
+
+#include <gl_core_4_3.hpp>
+#include <vector>
+
+//! A piece of a StreamBuffer handed out for this frame's data.
+struct StreamAllocation
+{
+    StreamAllocation() : pointer(NULL), offset(-1), size(0) {}
+
+    bool isValid() const { return pointer != NULL; }
+
+    void * pointer;    //! CPU address to write to
+    GLintptr offset;   //! Byte offset in the GL buffer, for binding or draw calls
+    GLsizeiptr size;
+};
+
+/**
+    Ring allocator for data rewritten every frame (transforms, particles, debug
+    geometry). The storage is sized for several frames in flight and stays mapped
+    with GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT, so writing is a plain memcpy.
+    Each frame's range is fenced at endFrame and only waited on when the ring comes
+    back round to it, which normally never blocks with three frames of room.
+
+    Without ARB_buffer_storage the buffer falls back to a CPU copy that flush
+    uploads with glBufferSubData.
+*/
+class StreamBuffer
+{
+    public:
+        StreamBuffer();
+        ~StreamBuffer();
+
+        void create(GLenum target, GLsizeiptr frameSize, int framesInFlight = 3);
+        void destroy();
+
+        StreamAllocation allocate(GLsizeiptr size, GLsizeiptr alignment = 16);
+        void flush();
+        void endFrame();
+
+        GLuint getHandle() const;
+        GLenum getTarget() const;
+        GLsizeiptr getSize() const;
+        bool isPersistent() const;
+        int  getStallCount() const;
+
+    private:
+        //! Range written by an earlier frame that the GPU may still be reading.
+        struct FencedRange
+        {
+            GLsync fence;
+            GLintptr begin;
+            GLintptr end;
+        };
+
+        GLuint m_handle;
+        GLenum m_target;
+        GLsizeiptr m_size;
+        GLsizeiptr m_frameSize;     //! One frame's share of the ring
+        char * m_mapped;
+        bool m_persistent;
+        std::vector<char> m_shadow; //! Fallback storage when persistent mapping is missing
+
+        GLintptr m_head;            //! Next free byte
+        GLintptr m_rangeBegin;      //! Start of the current frame's unfenced range
+        GLintptr m_flushedUpTo;     //! Fallback only: bytes below this were uploaded
+        GLsizeiptr m_frameBytes;    //! Bytes used by the current frame, padding included, held to m_frameSize
+        GLsizeiptr m_frameSpan;     //! As m_frameBytes plus tails skipped by a wrap, held to m_size
+        std::vector<FencedRange> m_pendingRanges; //! This frame's ranges closed by a wrap
+        std::vector<FencedRange> m_fences;        //! Oldest first
+        int m_stalls;               //! Times the CPU had to wait on the GPU
+
+        void waitForRange(GLintptr begin, GLintptr end);
+        void uploadShadow(GLintptr begin, GLintptr end);
+
+        StreamBuffer(const StreamBuffer & other);
+        StreamBuffer & operator=(const StreamBuffer & other);
+};
+
+#endif // !_STREAM_BUFFER_H
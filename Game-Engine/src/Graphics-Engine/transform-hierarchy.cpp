@@ -0,0 +1,342 @@
+/**
+    @file transform-hierarchy.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\transform-hierarchy.h>
+#include <Engine-Core\frame-allocator.h>
+#include <algorithm>
+#include <cstring>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#include <xmmintrin.h>
+#endif
+
+TransformHierarchy::TransformHierarchy() : m_orderChanged(false), m_anyDirty(false)
+{
+
+}
+
+/**
+    Adds a node with an identity local matrix
+    @param parent - INVALID_TRANSFORM for a root
+    @return handle of the new node
+*/
+TransformHandle TransformHierarchy::createNode(TransformHandle parent)
+{
+    TransformHandle handle;
+    if (!m_freeHandles.empty())
+    {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    }
+    else
+    {
+        handle = (TransformHandle)m_indices.size();
+        m_indices.push_back(-1);
+    }
+
+    int parentIndex = parent != INVALID_TRANSFORM ? m_indices[parent] : -1;
+    uint32_t depth = parentIndex >= 0 ? m_depths[parentIndex] + 1 : 0;
+
+    // Appending keeps the breadth-first order unless a deeper node is already last
+    if (!m_depths.empty() && m_depths.back() > depth)
+    {
+        m_orderChanged = true;
+    }
+
+    m_indices[handle] = (int)m_handles.size();
+    m_handles.push_back(handle);
+    m_parentHandles.push_back(parentIndex >= 0 ? parent : INVALID_TRANSFORM);
+    m_parents.push_back(parentIndex);
+    m_depths.push_back(depth);
+    m_locals.push_back(glm::mat4(1.f));
+    m_worlds.push_back(glm::mat4(1.f));
+    m_dirty.push_back(1);
+    m_anyDirty = true;
+
+    return handle;
+}
+
+/**
+    Removes a node, its children become roots and keep their local matrices
+    @param node
+*/
+void TransformHierarchy::destroyNode(TransformHandle node)
+{
+    int index = m_indices[node];
+    if (index < 0)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < m_parentHandles.size(); i++)
+    {
+        if (m_parentHandles[i] == node)
+        {
+            m_parentHandles[i] = INVALID_TRANSFORM;
+        }
+    }
+
+    // Fill the hole with the last slot, reorder puts everything back in place
+    size_t last = m_handles.size() - 1;
+    m_handles[index] = m_handles[last];
+    m_parentHandles[index] = m_parentHandles[last];
+    m_locals[index] = m_locals[last];
+    m_indices[m_handles[index]] = index;
+
+    m_handles.pop_back();
+    m_parentHandles.pop_back();
+    m_parents.pop_back();
+    m_depths.pop_back();
+    m_locals.pop_back();
+    m_worlds.pop_back();
+    m_dirty.pop_back();
+
+    m_indices[node] = -1;
+    m_freeHandles.push_back(node);
+    m_orderChanged = true;
+}
+
+/**
+    Moves a node and its subtree under a new parent
+    @param node
+    @param parent - INVALID_TRANSFORM to make the node a root
+*/
+void TransformHierarchy::setParent(TransformHandle node, TransformHandle parent)
+{
+    int index = m_indices[node];
+    if (index >= 0)
+    {
+        m_parentHandles[index] = parent;
+        m_orderChanged = true;
+    }
+}
+
+/**
+    Sets a node's transform relative to its parent and marks its subtree for update
+    @param node
+    @param local
+*/
+void TransformHierarchy::setLocal(TransformHandle node, const glm::mat4 & local)
+{
+    int index = m_indices[node];
+    m_locals[index] = local;
+    m_dirty[index] = 1;
+    m_anyDirty = true;
+}
+
+const glm::mat4 & TransformHierarchy::getLocal(TransformHandle node) const
+{
+    return m_locals[m_indices[node]];
+}
+
+/**
+    Gets a node's world matrix as of the last update
+    @param node
+*/
+const glm::mat4 & TransformHierarchy::getWorld(TransformHandle node) const
+{
+    return m_worlds[m_indices[node]];
+}
+
+/**
+    Recomputes the world matrices of every changed node and its descendants. Levels are
+    processed in order, the nodes of one level are multiplied as a batch.
+*/
+void TransformHierarchy::update()
+{
+    if (m_orderChanged)
+    {
+        reorder();
+    }
+
+    m_updatedNodes.clear();
+    if (!m_anyDirty)
+    {
+        return;
+    }
+
+    m_batch.clear();
+    uint32_t level = 0;
+    for (size_t i = 0; i < m_handles.size(); i++)
+    {
+        if (m_depths[i] != level)
+        {
+            // Parents of the next level must be final first
+            multiplyBatch();
+            level = m_depths[i];
+        }
+
+        int parent = m_parents[i];
+        if (parent >= 0 && m_dirty[parent])
+        {
+            m_dirty[i] = 1;
+        }
+
+        if (!m_dirty[i])
+        {
+            continue;
+        }
+
+        if (parent < 0)
+        {
+            m_worlds[i] = m_locals[i];
+            m_updatedNodes.push_back(m_handles[i]);
+        }
+        else
+        {
+            m_batch.push_back((uint32_t)i);
+        }
+    }
+    multiplyBatch();
+
+    if (!m_dirty.empty())
+    {
+        memset(&m_dirty[0], 0, m_dirty.size());
+    }
+    m_anyDirty = false;
+}
+
+size_t TransformHierarchy::getNodeCount() const
+{
+    return m_handles.size();
+}
+
+/**
+    Gets how many world matrices the last update recomputed
+*/
+size_t TransformHierarchy::getUpdatedCount() const
+{
+    return m_updatedNodes.size();
+}
+
+/**
+    Gets the nodes whose world matrix the last update recomputed, so dependent data such
+    as bounds only has to follow those
+*/
+const std::vector<TransformHandle> & TransformHierarchy::getUpdatedNodes() const
+{
+    return m_updatedNodes;
+}
+
+/**
+    Sorts the slots by depth after the topology changed, keeping the relative order of
+    nodes on the same level. Every node is recomputed on the next update.
+*/
+void TransformHierarchy::reorder()
+{
+    size_t count = m_handles.size();
+    ScratchScope scratch;
+
+    // Depths follow from the parent chain
+    ScratchVector<uint32_t> depths(count, 0);
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t depth = 0;
+        for (TransformHandle parent = m_parentHandles[i]; parent != INVALID_TRANSFORM && depth <= count;
+            parent = m_parentHandles[m_indices[parent]])
+        {
+            ++depth;
+        }
+        depths[i] = depth;
+    }
+
+    ScratchVector<uint32_t> order(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        order[i] = (uint32_t)i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&depths](uint32_t a, uint32_t b)
+    {
+        return depths[a] < depths[b];
+    });
+
+    std::vector<TransformHandle> handles(count);
+    std::vector<TransformHandle> parentHandles(count);
+    std::vector<glm::mat4> locals(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        handles[i] = m_handles[order[i]];
+        parentHandles[i] = m_parentHandles[order[i]];
+        locals[i] = m_locals[order[i]];
+        m_depths[i] = depths[order[i]];
+    }
+    m_handles.swap(handles);
+    m_parentHandles.swap(parentHandles);
+    m_locals.swap(locals);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        m_indices[m_handles[i]] = (int)i;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        m_parents[i] = m_parentHandles[i] != INVALID_TRANSFORM ? m_indices[m_parentHandles[i]] : -1;
+    }
+
+    m_dirty.assign(count, 1);
+    m_anyDirty = count > 0;
+    m_orderChanged = false;
+}
+
+/**
+    world = parent world * local for every slot in the batch. Slots of one level do not
+    depend on each other, so with SSE four are multiplied at once: their matrices are
+    transposed so that each register holds the same element of all four, and the product
+    becomes plain lane-wise multiplies and adds with no shuffles inside the kernel.
+*/
+void TransformHierarchy::multiplyBatch()
+{
+    size_t b = 0;
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    for (; b + 4 <= m_batch.size(); b += 4)
+    {
+        const uint32_t * slots = &m_batch[b];
+
+        // parent[c][r] and local[c][r] hold element (c, r) of the four matrices.
+        // Unaligned loads, std::vector only guarantees 8 byte alignment on 32 bit builds
+        __m128 parent[4][4], local[4][4];
+        for (int c = 0; c < 4; c++)
+        {
+            for (int n = 0; n < 4; n++)
+            {
+                parent[c][n] = _mm_loadu_ps(&m_worlds[m_parents[slots[n]]][c][0]);
+                local[c][n] = _mm_loadu_ps(&m_locals[slots[n]][c][0]);
+            }
+            _MM_TRANSPOSE4_PS(parent[c][0], parent[c][1], parent[c][2], parent[c][3]);
+            _MM_TRANSPOSE4_PS(local[c][0], local[c][1], local[c][2], local[c][3]);
+        }
+
+        for (int c = 0; c < 4; c++)
+        {
+            // Column c of each world matrix: sum over k of parent column k * local[c][k]
+            __m128 world[4];
+            for (int r = 0; r < 4; r++)
+            {
+                world[r] = _mm_add_ps(
+                    _mm_add_ps(_mm_mul_ps(parent[0][r], local[c][0]), _mm_mul_ps(parent[1][r], local[c][1])),
+                    _mm_add_ps(_mm_mul_ps(parent[2][r], local[c][2]), _mm_mul_ps(parent[3][r], local[c][3])));
+            }
+            _MM_TRANSPOSE4_PS(world[0], world[1], world[2], world[3]);
+            for (int n = 0; n < 4; n++)
+            {
+                _mm_storeu_ps(&m_worlds[slots[n]][c][0], world[n]);
+            }
+        }
+    }
+#endif
+
+    // Whatever does not fill a group of four
+    for (; b < m_batch.size(); b++)
+    {
+        uint32_t i = m_batch[b];
+        m_worlds[i] = m_worlds[m_parents[i]] * m_locals[i];
+    }
+
+    for (size_t i = 0; i < m_batch.size(); i++)
+    {
+        m_updatedNodes.push_back(m_handles[m_batch[i]]);
+    }
+    m_batch.clear();
+}
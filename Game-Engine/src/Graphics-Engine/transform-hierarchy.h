@@ -0,0 +1,66 @@
+/**
+    @headerfile transform-hierarchy.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _TRANSFORM_HIERARCHY_H
+#define _TRANSFORM_HIERARCHY_H
+
+#include <cstdint>
+#include <vector>
+#include <glm\glm.hpp>
+
+typedef uint32_t TransformHandle; //! Stable id of a node, survives reordering
+
+const TransformHandle INVALID_TRANSFORM = 0xFFFFFFFF;
+
+/**
+    Parent/child transforms stored breadth-first: every array is ordered by depth, so
+    a parent's world matrix is always final before its children are visited and one
+    forward pass updates the whole tree. Only nodes whose local matrix changed, or
+    whose ancestor changed, are recomputed; a frame without changes costs nothing.
+*/
+class TransformHierarchy
+{
+    public:
+        TransformHierarchy();
+
+        TransformHandle createNode(TransformHandle parent = INVALID_TRANSFORM);
+        void destroyNode(TransformHandle node);
+        void setParent(TransformHandle node, TransformHandle parent);
+
+        void setLocal(TransformHandle node, const glm::mat4 & local);
+        const glm::mat4 & getLocal(TransformHandle node) const;
+        const glm::mat4 & getWorld(TransformHandle node) const;
+
+        void update();
+
+        size_t getNodeCount() const;
+        size_t getUpdatedCount() const;
+        const std::vector<TransformHandle> & getUpdatedNodes() const;
+
+    private:
+        // Per node, in breadth-first order
+        std::vector<int> m_parents; //! Index of the parent, -1 for roots
+        std::vector<uint32_t> m_depths;
+        std::vector<glm::mat4> m_locals;
+        std::vector<glm::mat4> m_worlds;
+        std::vector<uint8_t> m_dirty;
+        std::vector<TransformHandle> m_handles; //! Handle owning each slot
+
+        std::vector<int> m_indices; //! Handle to slot, -1 when free
+        std::vector<TransformHandle> m_freeHandles;
+        std::vector<TransformHandle> m_parentHandles; //! Parent handle per slot, used to reorder
+
+        std::vector<uint32_t> m_batch; //! Scratch list of slots recomputed per level
+        bool m_orderChanged;
+        bool m_anyDirty;
+        std::vector<TransformHandle> m_updatedNodes; //! Nodes recomputed by the last update
+
+        void reorder();
+        void multiplyBatch();
+};
+
+#endif // !_TRANSFORM_HIERARCHY_H
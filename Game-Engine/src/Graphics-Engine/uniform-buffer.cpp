@@ -0,0 +1,165 @@
+/**
+    @file uniform-buffer.cpp
+    @date 18/10/2026
+*/
+
+#include <Graphics-Engine\uniform-buffer.h>
+#include <Graphics-Engine\gl-state-cache.h>
+#include <cstring>
+
+UniformBuffer::UniformBuffer() : m_handle(0), m_target(gl::UNIFORM_BUFFER), m_binding(0), m_size(0)
+{
+
+}
+
+UniformBuffer::~UniformBuffer()
+{
+    if (m_handle != 0)
+    {
+        GLStateCache::get()->releaseBuffer(m_handle);
+        gl::DeleteBuffers(1, &m_handle);
+    }
+}
+
+/**
+    Creates the buffer and binds it to its binding point
+    @param target - gl::UNIFORM_BUFFER or gl::SHADER_STORAGE_BUFFER
+    @param binding - block binding point, see UniformBlockBinding
+    @param size - bytes
+*/
+void UniformBuffer::create(GLenum target, GLuint binding, GLsizeiptr size)
+{
+    m_target = target;
+    m_binding = binding;
+    m_size = size;
+
+    if (m_handle == 0)
+    {
+        gl::GenBuffers(1, &m_handle);
+    }
+    GLStateCache::get()->bindBuffer(m_target, m_handle);
+    gl::BufferData(m_target, m_size, NULL, gl::DYNAMIC_DRAW);
+    bind();
+}
+
+/**
+    Overwrites part of the buffer
+    @param data
+    @param size - bytes
+    @param offset - bytes from the start of the buffer
+*/
+void UniformBuffer::update(const void * data, GLsizeiptr size, GLintptr offset)
+{
+    GLStateCache::get()->bindBuffer(m_target, m_handle);
+    gl::BufferSubData(m_target, offset, size, data);
+}
+
+/**
+    Binds the whole buffer to its binding point
+*/
+void UniformBuffer::bind()
+{
+    GLStateCache::get()->bindBufferBase(m_target, m_binding, m_handle);
+}
+
+GLuint UniformBuffer::getHandle() const
+{
+    return m_handle;
+}
+
+UniformRingBuffer::UniformRingBuffer() :
+    m_binding(0), m_blockSize(0), m_alignment(0), m_capacity(0), m_count(0)
+{
+
+}
+
+/**
+    Creates the ring
+    @param target - gl::UNIFORM_BUFFER or gl::SHADER_STORAGE_BUFFER
+    @param binding - block binding point, see UniformBlockBinding
+    @param blockSize - bytes per block
+    @param capacity - blocks per frame, grows when a frame needs more
+*/
+void UniformRingBuffer::create(GLenum target, GLuint binding, GLsizeiptr blockSize, GLsizei capacity)
+{
+    m_binding = binding;
+    m_blockSize = blockSize;
+    m_capacity = capacity;
+
+    GLint alignment = 0;
+    gl::GetIntegerv(target == gl::UNIFORM_BUFFER ? gl::UNIFORM_BUFFER_OFFSET_ALIGNMENT :
+        gl::SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    if (alignment < 1)
+    {
+        alignment = 256;
+    }
+    m_alignment = alignment;
+
+    GLsizeiptr stride = ((blockSize + m_alignment - 1) / m_alignment) * m_alignment;
+    m_buffer.create(target, stride * m_capacity);
+}
+
+/**
+    Copies one block into the ring
+    @param data - blockSize bytes
+    @return the block's offset for bind, or -1 if this frame's capacity is used up. The
+    ring only grows at endFrame, blocks already pushed stay where they are, so a draw
+    without a block has to be skipped for this frame.
+*/
+GLintptr UniformRingBuffer::push(const void * data)
+{
+    ++m_count;
+
+    StreamAllocation allocation = m_buffer.allocate(m_blockSize, m_alignment);
+    if (!allocation.isValid())
+    {
+        return -1;
+    }
+
+    memcpy(allocation.pointer, data, m_blockSize);
+    return allocation.offset;
+}
+
+/**
+    Makes the blocks pushed so far visible to the GPU, call before drawing with them
+*/
+void UniformRingBuffer::flush()
+{
+    m_buffer.flush();
+}
+
+/**
+    Fences this frame's blocks. If the frame ran out of room the ring is recreated
+    with enough capacity, which waits for the GPU once.
+*/
+void UniformRingBuffer::endFrame()
+{
+    m_buffer.endFrame();
+
+    if (m_count > m_capacity)
+    {
+        while (m_capacity < m_count)
+        {
+            m_capacity *= 2;
+        }
+        create(m_buffer.getTarget(), m_binding, m_blockSize, m_capacity);
+    }
+    m_count = 0;
+}
+
+/**
+    Selects one block for the next draw
+    @param offset - as returned by push
+*/
+void UniformRingBuffer::bind(GLintptr offset)
+{
+    if (offset >= 0)
+    {
+        GLStateCache::get()->bindBufferRange(m_buffer.getTarget(), m_binding, m_buffer.getHandle(), offset, m_blockSize);
+    }
+}
+
+GLsizei UniformRingBuffer::getCount() const
+{
+    return m_count;
+}
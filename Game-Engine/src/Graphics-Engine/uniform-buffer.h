@@ -0,0 +1,106 @@
+/**
+    @headerfile uniform-buffer.h
+    @date 18/10/2026
+*/
+
+#pragma once
+
+#ifndef _UNIFORM_BUFFER_H
+#define _UNIFORM_BUFFER_H
+
+#include <gl_core_4_3.hpp>
+#include <glm\glm.hpp>
+#include <Graphics-Engine\stream-buffer.h>
+
+//! Binding points shared by every engine shader, see resources/Shaders.
+enum UniformBlockBinding
+{
+    CAMERA_BLOCK = 0,
+    MATERIAL_BLOCK = 1,
+    OBJECT_BLOCK = 2
+};
+
+//! std140 mirror of CameraBlock, uploaded once per frame.
+struct CameraBlock
+{
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::mat4 viewProjection;
+    glm::vec4 eyePosition;
+};
+
+//! std140 mirror of MaterialBlock, uploaded when a material changes.
+struct MaterialBlock
+{
+    glm::vec4 diffuse;
+    glm::vec4 ambient;
+    glm::vec4 specular; //! w holds the specular exponent
+};
+
+//! std140 mirror of ObjectBlock, one per drawn object per frame.
+struct ObjectBlock
+{
+    glm::mat4 model;
+    glm::mat4 modelView;
+    glm::mat4 normalMatrix; //! Only the upper 3x3 is used, a std140 mat3 is padded to this anyway
+};
+
+/**
+    A uniform or shader storage buffer bound to a fixed binding point, for blocks
+    that are rewritten as a whole, like the per-frame camera block.
+*/
+class UniformBuffer
+{
+    public:
+        UniformBuffer();
+        ~UniformBuffer();
+
+        void create(GLenum target, GLuint binding, GLsizeiptr size);
+        void update(const void * data, GLsizeiptr size, GLintptr offset = 0);
+        void bind();
+
+        GLuint getHandle() const;
+
+    private:
+        GLuint m_handle;
+        GLenum m_target;
+        GLuint m_binding;
+        GLsizeiptr m_size;
+
+        UniformBuffer(const UniformBuffer & other);
+        UniformBuffer & operator=(const UniformBuffer & other);
+};
+
+/**
+    Ring of equally sized blocks written once per frame, e.g. per-object transforms.
+    Every block starts on the driver's offset alignment so a single glBindBufferRange
+    selects it for a draw. Blocks live in a persistently mapped StreamBuffer, pushing
+    one is a memcpy.
+*/
+class UniformRingBuffer
+{
+    public:
+        UniformRingBuffer();
+
+        void create(GLenum target, GLuint binding, GLsizeiptr blockSize, GLsizei capacity);
+
+        GLintptr push(const void * data);
+        void flush();
+        void endFrame();
+        void bind(GLintptr offset);
+
+        GLsizei getCount() const;
+
+    private:
+        StreamBuffer m_buffer;
+        GLuint m_binding;
+        GLsizeiptr m_blockSize;
+        GLsizeiptr m_alignment;
+        GLsizei m_capacity;
+        GLsizei m_count; //! Blocks pushed this frame, including those that did not fit
+
+        UniformRingBuffer(const UniformRingBuffer & other);
+        UniformRingBuffer & operator=(const UniformRingBuffer & other);
+};
+
+#endif // !_UNIFORM_BUFFER_H
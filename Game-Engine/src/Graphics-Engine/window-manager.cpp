@@ -5,24 +5,26 @@
 */
 
 #include <Graphics-Engine\window-manager.h>
-
-
-Scene *scene;
-Camera camera;
+#include <chrono>
 
 /**
 	Contructs a window manager object
 	@param width - interger
 	@param height - interger
 	@param title - string
-	@fullScreen - boolean
+	@param contextMode - a visible window, a hidden one for benchmarks on machines nobody
+	watches, or no window and driver at all
 */
-WindowManager::WindowManager(int width, int height, std::string title)
+WindowManager::WindowManager(int width, int height, std::string title, ContextMode contextMode)
 {
 	m_width = width;
 	m_height = height;
 	m_windowID = title;
 	m_fullScreenEnabled = false;
+	m_contextMode = contextMode;
+	m_streamedObjects = 0;
+	m_fixedTimeStep = 1.0 / 60.0;
+	m_maxCatchUpSteps = 5;
 
 	initialiseWindow();
 }
@@ -38,6 +40,10 @@ WindowManager::WindowManager(std::string title, bool fullScreenMode)
 	m_height = 1080;
 	m_windowID = title;
 	m_fullScreenEnabled = fullScreenMode;
+	m_contextMode = CONTEXT_WINDOW;
+	m_streamedObjects = 0;
+	m_fixedTimeStep = 1.0 / 60.0;
+	m_maxCatchUpSteps = 5;
 
 	initialiseWindow();
 }
@@ -56,6 +62,18 @@ WindowManager::~WindowManager()
 */
 bool WindowManager::initialiseWindow()
 {
+	m_profiler.setThreadName("Main");
+	PROFILE_SCOPE("WindowManager::initialiseWindow");
+
+	// without a driver the gl:: functions only record, there is no window to create
+	if (m_contextMode == CONTEXT_NULL)
+	{
+		m_pWindow = NULL;
+		m_pGLRecorder.reset(new GLRecorder(GLRecorder::RECORD_NULL));
+		m_pGLRecorder->install();
+		return 1;
+	}
+
 	if (!glfwInit()) // exit application,
 	{
 		exit(EXIT_FAILURE);
@@ -69,6 +87,11 @@ bool WindowManager::initialiseWindow()
 	glfwWindowHint(GLFW_RESIZABLE, TRUE);
 	glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, TRUE);
 
+	// a hidden window still gives a context, rendering then goes to an offscreen target
+	if (m_contextMode == CONTEXT_HIDDEN)
+	{
+		glfwWindowHint(GLFW_VISIBLE, FALSE);
+	}
 
 	if (m_fullScreenEnabled) // create window in full screen mode,
 	{
@@ -87,15 +110,29 @@ bool WindowManager::initialiseWindow()
 	// create the current context
 	glfwMakeContextCurrent(m_pWindow);
 
-	// set callbacks
+	// set callbacks, they find this window manager through the user pointer
 	glfwSetErrorCallback(error_callback);
+	glfwSetWindowUserPointer(m_pWindow, this);
+	glfwSetKeyCallback(m_pWindow, key_callback);
 
-	// loading function pointers
-	gl::exts::LoadTest didLoad = gl::sys::LoadFunctions();
+	// loading function pointers, lazily loaded ones are looked up on their first call
+	uint64_t loadStart = Profiler::now();
+	gl::exts::LoadTest didLoad;
+	{
+		PROFILE_SCOPE("gl::sys::LoadFunctions");
+		didLoad = gl::sys::LoadFunctions();
+	}
 	if (!didLoad)
 	{
 		destroyWindow();
 	}
+	printf("GL functions: %s load in %.3f ms, %d of %d looked up, %d extensions\n",
+		gl::sys::GetLoadMode() == gl::sys::LOAD_LAZY ? "lazy" : "eager", (Profiler::now() - loadStart) / 1e6,
+		gl::sys::GetNumResolvedFunctions(), gl::sys::GetNumFunctions(), gl::sys::GetNumExtensions());
+	if (gl::sys::GetLoadMode() == gl::sys::LOAD_LAZY)
+	{
+		printf("GL functions: missing ones are only found on their first call, --eager-gl checks them now\n");
+	}
 
 	return 1;
 }
@@ -114,13 +151,24 @@ void WindowManager::destroyWindow()
 */
 void WindowManager::initialiseGL()
 {
-	gl::ClearColor(0.f, 0.4f, 0.9f, 0.5f);
+	PROFILE_SCOPE("WindowManager::initialiseGL");
+
+	// Nothing is known about a fresh context
+	m_glState.invalidate();
+	m_glState.clearColor(0.f, 0.4f, 0.9f, 0.5f);
 
 	currentCursorPosition = glm::dvec2(0, 0);
 	lastCursorPosition = glm::dvec2(0, 0);
 
-    scene = new EngineScene();
-    scene->initScene(camera);
+    EngineScene * scene = new EngineScene();
+    m_pScene.reset(scene);
+    m_pScene->initScene(m_camera);
+	if (m_streamedObjects > 0)
+	{
+		scene->streamGrid(m_streamedMesh, m_streamedObjects);
+	}
+
+	m_programCache.printReport();
 }
 
 /**
@@ -144,11 +192,12 @@ void WindowManager::error_callback(int error, const char* description)
 */
 void WindowManager::key_callback(GLFWwindow* window, int key, int cancode, int action, int mods)
 {
+    WindowManager * manager = (WindowManager *)glfwGetWindowUserPointer(window);
     if (key == GLFW_KEY_SPACE && action == GLFW_RELEASE)
     {
-        if (scene)
+        if (manager && manager->m_pScene)
         {
-            scene->animate(!(scene->animating()));
+            manager->m_pScene->animate(!(manager->m_pScene->animating()));
         }
     }
 }
@@ -165,10 +214,89 @@ void WindowManager::framebuffer_callback(GLFWwindow* window, int width, int heig
 }
 
 /**
-	Updates the current window
+	Sets how many simulation ticks run per second.
+	@param ticksPerSecond - must be above zero
+*/
+void WindowManager::setTickRate(double ticksPerSecond)
+{
+	if (ticksPerSecond > 0.0)
+	{
+		m_fixedTimeStep = 1.0 / ticksPerSecond;
+	}
+}
+
+/**
+	Caps how many simulation ticks a single frame may run to catch up. Time beyond the
+	cap is dropped, so a slow frame cannot snowball into ever longer frames.
+	@param maxSteps - at least one
+*/
+void WindowManager::setMaxCatchUpSteps(int maxSteps)
+{
+	m_maxCatchUpSteps = maxSteps < 1 ? 1 : maxSteps;
+}
+
+/**
+	Saves a Chrome trace of the last frames' profiled scopes once the main loop ends.
+	@param fileName - JSON file, opened with chrome://tracing or Perfetto
+*/
+void WindowManager::setTraceFile(const std::string & fileName)
+{
+	m_traceFile = fileName;
+}
+
+/**
+	Streams copies of a mesh into the scene once initialiseGL creates it, loading them in
+	the background while frames keep running.
+	@param meshFile - mesh file, see convertMesh
+	@param count - copies laid out in a grid, 0 for none
+*/
+void WindowManager::setStreamedScene(const std::string & meshFile, int count)
+{
+	m_streamedMesh = meshFile;
+	m_streamedObjects = count;
+}
+
+/**
+	Counts every GL call the engine makes from now on, passing them on to the driver.
+	Benchmark reports then include the calls per frame. Contexts without a driver
+	record from the start.
+*/
+void WindowManager::recordGLCalls()
+{
+	if (!m_pGLRecorder)
+	{
+		m_pGLRecorder.reset(new GLRecorder(GLRecorder::RECORD_FORWARD));
+		m_pGLRecorder->install();
+	}
+}
+
+/**
+	Writes the trace file given to setTraceFile, if any, and prints where the time went.
 */
-void WindowManager::update(float time) 
+void WindowManager::saveTrace()
 {
+	if (!m_traceFile.empty() && m_profiler.writeChromeTrace(m_traceFile))
+	{
+		std::cout << "Trace written to " << m_traceFile << std::endl;
+		m_profiler.printSummary();
+
+		// with lazy loading the rest were never looked up, their startup cost was saved
+		if (m_contextMode != CONTEXT_NULL)
+		{
+			std::cout << "GL functions looked up: " << gl::sys::GetNumResolvedFunctions()
+				<< " of " << gl::sys::GetNumFunctions() << std::endl;
+		}
+	}
+}
+
+/**
+	Updates the current window, called once per rendered frame. Timing is left to the
+	fixed step loop in mainLoop.
+*/
+void WindowManager::update()
+{
+	PROFILE_SCOPE("WindowManager::update");
+
 	// Gets the current cursor positions.
 	glfwGetCursorPos(m_pWindow, &currentCursorPosition.x, &currentCursorPosition.y);
 	
@@ -184,14 +312,271 @@ void WindowManager::update(float time)
 
 }
 
+/**
+	Writes the simulation and render rates of the last interval into the window title.
+	@param currentTime - seconds since GLFW was initialised
+*/
+void WindowManager::reportTimings(double currentTime)
+{
+	double interval = currentTime - m_lastReportTime;
+	if (interval < 1.0)
+	{
+		return;
+	}
+
+	char title[512];
+	char gpuTimes[192];
+	const GLCallStats & glCalls = m_glState.getFrameStats();
+	const FrameMemoryStats & frameMemory = m_frameAllocator.getStats();
+	m_gpuProfiler.formatAverages(gpuTimes, sizeof(gpuTimes));
+	snprintf(title, sizeof(title), "%s | sim %.0f Hz %.3f ms | render %.0f fps %.3f ms | dropped %d | gl %zu issued %zu filtered | frame mem %zu KB peak %zu KB | gpu %s",
+		m_windowID.c_str(),
+		m_simulationTicks / interval,
+		m_simulationTicks > 0 ? 1000.0 * m_simulationSeconds / m_simulationTicks : 0.0,
+		m_renderedFrames / interval,
+		m_renderedFrames > 0 ? 1000.0 * m_renderSeconds / m_renderedFrames : 0.0,
+		m_droppedTicks,
+		glCalls.issued,
+		glCalls.filtered,
+		(frameMemory.used + frameMemory.overflow) / 1024,
+		frameMemory.peak / 1024,
+		gpuTimes);
+	glfwSetWindowTitle(m_pWindow, title);
+
+	m_lastReportTime = currentTime;
+	m_simulationSeconds = 0.0;
+	m_renderSeconds = 0.0;
+	m_simulationTicks = 0;
+	m_renderedFrames = 0;
+	m_droppedTicks = 0;
+}
+
+/**
+	Runs the scene simulation at a fixed tick rate and renders as often as the display
+	allows. Rendering is handed the fraction of a tick left in the accumulator so that
+	motion can be interpolated between the last two simulation states.
+*/
 void WindowManager::mainLoop()
 {
+	double previousTime = glfwGetTime();
+	double accumulator = 0.0;
+
+	m_lastReportTime = previousTime;
+	m_simulationSeconds = 0.0;
+	m_renderSeconds = 0.0;
+	m_simulationTicks = 0;
+	m_renderedFrames = 0;
+	m_droppedTicks = 0;
+
 	while (!glfwWindowShouldClose(m_pWindow) && !glfwGetKey(m_pWindow, GLFW_KEY_ESCAPE))
 	{
-		update((float)glfwGetTime());
-        scene->render(camera);
+		PROFILE_SCOPE("frame");
+		double currentTime = glfwGetTime();
+		double frameTime = currentTime - previousTime;
+		previousTime = currentTime;
+
+		// Also reads back the GPU timings of earlier frames that have finished
+		m_gpuProfiler.beginFrame();
+
+		update();
+
+		// GL work queued by jobs since the last frame
+		{
+			PROFILE_SCOPE("main thread jobs");
+			GPU_PROFILE_SCOPE("main thread jobs");
+			m_jobSystem.processMainThreadJobs();
+		}
+
+		// Meshes finished loading, copied within the frame's upload budget
+		{
+			GPU_PROFILE_SCOPE("asset streaming");
+			m_assetStreamer.update(m_camera.getCameraPosition());
+		}
+
+		// Swap in edited shaders between frames
+		{
+			PROFILE_SCOPE("shader reload");
+			m_shaderWatcher.update();
+		}
+
+		// Simulate in fixed steps until the accumulator is drained or the cap is hit.
+		accumulator += frameTime;
+		int steps = 0;
+		while (accumulator >= m_fixedTimeStep && steps < m_maxCatchUpSteps)
+		{
+			PROFILE_SCOPE("Scene::updateScene");
+			double tickStart = glfwGetTime();
+			m_pScene->updateScene((float)m_fixedTimeStep);
+			m_simulationSeconds += glfwGetTime() - tickStart;
+
+			accumulator -= m_fixedTimeStep;
+			++steps;
+			++m_simulationTicks;
+		}
+
+		// Drop whatever the cap left behind, the simulation slows down instead of spiralling.
+		if (accumulator >= m_fixedTimeStep)
+		{
+			int dropped = (int)(accumulator / m_fixedTimeStep);
+			m_droppedTicks += dropped;
+			accumulator -= dropped * m_fixedTimeStep;
+		}
+
+		double renderStart = glfwGetTime();
+		{
+			PROFILE_SCOPE("Scene::render");
+			GPU_PROFILE_SCOPE("Scene::render");
+			m_pScene->render(m_camera, (float)(accumulator / m_fixedTimeStep));
+		}
+		m_renderSeconds += glfwGetTime() - renderStart;
+		++m_renderedFrames;
+
+		m_gpuProfiler.endFrame();
+		{
+			PROFILE_SCOPE("glfwSwapBuffers");
+			glfwSwapBuffers(m_pWindow);
+		}
+		{
+			PROFILE_SCOPE("glfwPollEvents");
+			glfwPollEvents();
+		}
+
+		m_glState.endFrame();
+		m_frameAllocator.nextFrame();
+		reportTimings(currentTime);
+	}
+
+	if (m_assetStreamer.getStats().requested > 0)
+	{
+		m_assetStreamer.printStats();
+	}
+	saveTrace();
+}
+/**
+	Renders a fixed number of frames into an offscreen target while the camera follows a
+	scripted path, then reports the frame times as JSON. Every frame runs exactly one
+	simulation tick and the path advances by one tick, so two runs render the same frames
+	whatever the machine. The CPU may run at most two frames ahead of the GPU, as it would
+	behind a swap chain, so the times include the GPU's share of the work.
+	@param settings - frames, target size, camera path, report file and budget
+	@return false if the run failed or its 95th percentile exceeded the budget
+*/
+bool WindowManager::runBenchmark(const BenchmarkSettings & settings)
+{
+	CameraPath path = CameraPath::makeDefault();
+	if (!settings.cameraPathFile.empty() && !path.load(settings.cameraPathFile))
+	{
+		return false;
+	}
+
+	OffscreenTarget target;
+	if (!target.create(settings.width, settings.height))
+	{
+		return false;
+	}
+
+	Camera camera(glm::vec3(0.f, 0.f, 5.f), glm::radians(60.f), (float)settings.width / (float)settings.height, 0.1f, 100.f);
+	GLsync fences[2] = { 0, 0 };
+	std::vector<double> frameTimes;
+	frameTimes.reserve(settings.frames > 0 ? settings.frames : 0);
+
+	// Only the averages of the measured frames end up in the report
+	std::vector<GpuTiming> gpuAverages;
+	int gpuDropped = 0;
+	int totalFrames = settings.warmupFrames + settings.frames;
+	for (int frame = 0; frame < totalFrames; frame++)
+	{
+		if (frame == settings.warmupFrames)
+		{
+			// Warmup frames still in flight would otherwise be read back into the measured averages
+			m_gpuProfiler.drain();
+			m_gpuProfiler.takeAverages(gpuAverages, gpuDropped);
+			if (m_pGLRecorder)
+			{
+				m_pGLRecorder->resetTotals();
+			}
+		}
+
+		PROFILE_SCOPE("frame");
+		std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+		m_gpuProfiler.beginFrame();
+
+		{
+			PROFILE_SCOPE("main thread jobs");
+			GPU_PROFILE_SCOPE("main thread jobs");
+			m_jobSystem.processMainThreadJobs();
+		}
+
+		// Streams towards the camera of the previous frame, as the main loop does
+		{
+			GPU_PROFILE_SCOPE("asset streaming");
+			m_assetStreamer.update(camera.getCameraPosition());
+		}
+		{
+			PROFILE_SCOPE("Scene::updateScene");
+			m_pScene->updateScene((float)m_fixedTimeStep);
+		}
+
+		path.apply(camera, (float)(frame * m_fixedTimeStep));
+		target.bind();
+		{
+			PROFILE_SCOPE("Scene::render");
+			GPU_PROFILE_SCOPE("Scene::render");
+			m_pScene->render(camera, 0.f);
+		}
+		m_gpuProfiler.endFrame();
+
+		// Stands in for the swap chain, waits for the frame before last
+		GLsync & fence = fences[frame % 2];
+		if (fence)
+		{
+			PROFILE_SCOPE("wait for GPU");
+			gl::ClientWaitSync(fence, gl::SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+			gl::DeleteSync(fence);
+		}
+		fence = gl::FenceSync(gl::SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		m_glState.endFrame();
+		m_frameAllocator.nextFrame();
+		if (m_pGLRecorder)
+		{
+			m_pGLRecorder->endFrame();
+		}
+		if (m_pWindow)
+		{
+			glfwPollEvents();
+		}
+
+		if (frame >= settings.warmupFrames)
+		{
+			frameTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+		}
+	}
 
-		glfwSwapBuffers(m_pWindow);
-		glfwPollEvents();
+	for (int i = 0; i < 2; i++)
+	{
+		if (fences[i])
+		{
+			gl::ClientWaitSync(fences[i], gl::SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+			gl::DeleteSync(fences[i]);
+		}
 	}
-}
\ No newline at end of file
+	m_glState.bindFramebuffer(gl::FRAMEBUFFER, 0);
+
+	FrameTimeStats stats = computeFrameTimeStats(frameTimes);
+	bool bPassed = settings.budgetP95 <= 0.0 || stats.p95 <= settings.budgetP95;
+	m_gpuProfiler.drain();
+	m_gpuProfiler.takeAverages(gpuAverages, gpuDropped);
+	GLRecorderStats glCalls = m_pGLRecorder ? m_pGLRecorder->getAverageStats() : GLRecorderStats();
+	bool bStreamed = m_assetStreamer.getStats().requested > 0;
+	bool bWritten = writeBenchmarkReport(settings, stats, gpuAverages, gpuDropped, m_pGLRecorder ? &glCalls : NULL,
+		bStreamed ? &m_assetStreamer.getStats() : NULL, bPassed);
+	if (bStreamed)
+	{
+		m_assetStreamer.printStats();
+	}
+
+	saveTrace();
+
+	return bWritten && bPassed;
+}
@@ -9,16 +9,36 @@
 #ifndef _WINDOW_MANAGER_H
 #define _WINDOW_MANAGER_H
 
+#include <memory>
 #include <string>
 #include <gl_core_4_3.hpp>
 #include <GLFW\glfw3.h>
 #include <glm\glm.hpp>
+#include <Engine-Core\frame-allocator.h>
+#include <Engine-Core\job-system.h>
+#include <Engine-Core\profiler.h>
+#include <Graphics-Engine\asset-streamer.h>
+#include <Graphics-Engine\benchmark.h>
+#include <Graphics-Engine\gl-recorder.h>
+#include <Graphics-Engine\gl-state-cache.h>
+#include <Graphics-Engine\gpu-profiler.h>
+#include <Graphics-Engine\program-binary-cache.h>
+#include <Graphics-Engine\render-resources.h>
+#include <Graphics-Engine\shader-watcher.h>
 #include <Graphics-Engine\engine-scene.h>
 
+//! Where the window manager's GL context comes from.
+enum ContextMode
+{
+	CONTEXT_WINDOW, //! A visible window
+	CONTEXT_HIDDEN, //! A window that is never shown, frames go to an offscreen target
+	CONTEXT_NULL //! No window or driver, GL calls are only recorded
+};
+
 class WindowManager
 {
 	public:
-		WindowManager(int, int, std::string);
+		WindowManager(int, int, std::string, ContextMode = CONTEXT_WINDOW);
 		WindowManager(std::string, bool);
 		~WindowManager();
 
@@ -30,8 +50,14 @@ class WindowManager
 		void destroyWindow();
 		void initialiseGL();
 		void mainLoop();
-		void update(float);
+		bool runBenchmark(const BenchmarkSettings &);
+		void update();
 
+		void setTickRate(double);
+		void setMaxCatchUpSteps(int);
+		void setTraceFile(const std::string &);
+		void setStreamedScene(const std::string &, int);
+		void recordGLCalls();
 
 
 	private:
@@ -40,7 +66,37 @@ class WindowManager
 		int m_height; //! Member Variable: window object height.
 		std::string m_windowID; //! Member Variable: ID / Name of window object.
 		bool m_fullScreenEnabled; //! Member Varaibles: Checks window object for full screen
+		ContextMode m_contextMode; //! Member Variable: visible, hidden or no window at all.
 		glm::dvec2 currentCursorPosition;
 		glm::dvec2 lastCursorPosition;
+		Profiler m_profiler; //! Member Variable: timed scopes of every thread, outlives the workers.
+		std::string m_traceFile; //! Member Variable: Chrome trace written when the main loop ends, empty for none.
+		std::unique_ptr<GLRecorder> m_pGLRecorder; //! Member Variable: counts GL calls when set, outlives every GL object.
+		JobSystem m_jobSystem; //! Member Variable: worker threads, this thread is the main (GL) lane.
+		FrameAllocator m_frameAllocator; //! Member Variable: transient memory, reset at every frame boundary.
+		GLStateCache m_glState; //! Member Variable: shadow of the context state, filters redundant GL calls.
+		GpuProfiler m_gpuProfiler; //! Member Variable: GPU time of each pass, read back a few frames late.
+		ProgramBinaryCache m_programCache; //! Member Variable: linked shader programs kept on disk between launches.
+		ShaderWatcher m_shaderWatcher; //! Member Variable: reloads shader programs when their files are saved.
+		RenderResources m_renderResources; //! Member Variable: pools of GL resources, referred to by handle.
+		AssetStreamer m_assetStreamer; //! Member Variable: loads meshes off the main thread, uploads them within a per frame budget.
+		std::string m_streamedMesh; //! Member Variable: mesh file streamed into the scene at startup.
+		int m_streamedObjects; //! Member Variable: copies of it streamed, 0 for none.
+		Camera m_camera; //! Member Variable: viewpoint the scene is rendered from.
+		std::unique_ptr<Scene> m_pScene; //! Member Variable: scene being run, released before the pools it uses.
+
+		double m_fixedTimeStep; //! Member Variable: length of one simulation tick in seconds.
+		int m_maxCatchUpSteps; //! Member Variable: most ticks run in one frame before the backlog is dropped.
+
+		// Timings gathered between two reports, simulation and rendering are measured separately.
+		double m_lastReportTime;
+		double m_simulationSeconds;
+		double m_renderSeconds;
+		int m_simulationTicks;
+		int m_renderedFrames;
+		int m_droppedTicks;
+
+		void reportTimings(double);
+		void saveTrace();
 };
 #endif // !_WINDOW_MANAGER_H